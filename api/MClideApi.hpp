@@ -2,7 +2,7 @@
 //! @file 			MClideApi.hpp
 //! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
 //! @created		2013-04-02
-//! @last-modified 	2014-10-07
+//! @last-modified 	2026-10-17
 //! @brief 			This header file includes all files necessary for the user to use the MClide library.
 //! @details
 //!					See README.rst in repo root dir for more info.
@@ -25,10 +25,21 @@
 #include "../include/Tx.hpp"
 #include "../include/Rx.hpp"
 #include "../include/Cmd.hpp"
+#include "../include/CmdBinding.hpp"
+#include "../include/StaticCmdTable.hpp"
+#include "../include/StaticParseResult.hpp"
+#include "../include/StaticRx.hpp"
 #include "../include/Param.hpp"
 #include "../include/Option.hpp"
 #include "../include/RxBuff.hpp"
+#include "../include/RxQueue.hpp"
+#include "../include/IoDriver.hpp"
+#include "../include/CommConfig.hpp"
+#include "../include/ParseArena.hpp"
+#include "../include/ParseResult.hpp"
 #include "../include/Print.hpp"
+#include "../include/PrintSink.hpp"
+#include "../include/ValueSpec.hpp"
 
 #endif // #ifndef MCLIDE_MCLIDE_API_H
 
@@ -0,0 +1,98 @@
+//!
+//! @file 			ArgCountBench.cpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! @created		2026-10-16
+//! @last-modified 	2026-10-16
+//! @brief 			Benchmark showing that Rx::Run() time grows linearly with the number of arguments in a message.
+//! @details
+//!					Run with "make bench". See README.rst in root dir for more info.
+
+//===== SYSTEM LIBRARIES =====//
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+
+//===== USER SOURCE =====//
+#include "../api/MClideApi.hpp"
+#include "BenchHarness.hpp"
+
+using namespace MbeddedNinja::MClideNs;
+
+static bool Callback(Cmd* cmd)
+{
+	return true;
+}
+
+//! @brief		Times Rx::Run() on the typical short message, e.g. "test param1 -a".
+static void RunCommonCaseBench()
+{
+	Rx rxController;
+	Cmd cmdTest("test", &Callback, "Benchmark command.");
+	Param cmdTestParam("Benchmark parameter.");
+	cmdTest.RegisterParam(&cmdTestParam);
+	Option cmdTestOption('a', "alpha", NULL, "Benchmark option.", false);
+	cmdTest.RegisterOption(&cmdTestOption);
+	rxController.RegisterCmd(&cmdTest);
+
+	MClideBench::Measure("ArgCountBench", "common case", 500000, [&]() { rxController.Run("test param1 -a"); });
+}
+
+//! @brief		Times Rx::Run() on a message with a command name and numParams parameters, with and without a parse arena.
+static void RunArgCountBench(uint32_t numParams)
+{
+	const uint32_t numIterations = 20000;
+
+	Rx rxController;
+	Cmd cmdTest("test", &Callback, "Benchmark command.");
+	Param** paramA = new Param*[numParams];
+	for(uint32_t x = 0; x < numParams; x++)
+	{
+		paramA[x] = new Param("Benchmark parameter.");
+		cmdTest.RegisterParam(paramA[x]);
+	}
+	rxController.RegisterCmd(&cmdTest);
+
+	char* msg = new char[5 + numParams*6 + 1];
+	strcpy(msg, "test");
+	char param[10];
+	for(uint32_t x = 0; x < numParams; x++)
+	{
+		// Always 3 digits, so every parameter is the 6 chars msg was sized for
+		snprintf(param, sizeof(param), " p%03u", (unsigned int)(x % 1000));
+		strcat(msg, param);
+	}
+
+	char caseName[50];
+	snprintf(caseName, sizeof(caseName), "args=%u/heap", (unsigned int)(numParams + 1));
+	MClideBench::Measure("ArgCountBench", caseName, numIterations, [&]() { rxController.Run(msg); });
+
+	static uint8_t arenaBuff[16384];
+	ParseArena arena(arenaBuff, sizeof(arenaBuff));
+	rxController.parseArena = &arena;
+
+	snprintf(caseName, sizeof(caseName), "args=%u/arena", (unsigned int)(numParams + 1));
+	MClideBench::Measure("ArgCountBench", caseName, numIterations, [&]() { rxController.Run(msg); });
+
+	delete[] msg;
+	for(uint32_t x = 0; x < numParams; x++)
+		delete paramA[x];
+	delete[] paramA;
+}
+
+int main()
+{
+	Print::enableCmdLinePrinting = false;
+	Print::enableErrorPrinting = false;
+	Print::enableDebugInfoPrinting = false;
+
+	RunCommonCaseBench();
+
+	// Rx::Run() latency vs. number of arguments
+	const uint32_t numArgsA[] = { 2, 5, 10, 25, 50, 100, 200 };
+	for(uint32_t x = 0; x < sizeof(numArgsA)/sizeof(numArgsA[0]); x++)
+		RunArgCountBench(numArgsA[x] - 1);
+
+	return 0;
+}
+
+// EOF
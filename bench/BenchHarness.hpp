@@ -0,0 +1,243 @@
+//!
+//! @file 			BenchHarness.hpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! @created		2026-10-16
+//! @last-modified 	2026-10-17
+//! @brief 			Timing, heap allocation counting and JSON output shared by the benchmarks in bench/.
+//! @details
+//!					Include in exactly one file of each benchmark program, since it replaces malloc() and
+//!					operator new. See README.rst in root dir for more info.
+
+#ifndef __cplusplus
+	#error Please build with C++ compiler
+#endif
+
+//===============================================================================================//
+//======================================== HEADER GUARD =========================================//
+//===============================================================================================//
+
+#ifndef MCLIDE_BENCH_HARNESS_H
+#define MCLIDE_BENCH_HARNESS_H
+
+//===============================================================================================//
+//========================================== INCLUDES ===========================================//
+//===============================================================================================//
+
+//===== SYSTEM LIBRARIES =====//
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <new>
+#include <chrono>
+#include <atomic>
+
+//===============================================================================================//
+//===================================== ALLOCATION COUNTING =====================================//
+//===============================================================================================//
+
+// Every heap allocation (operator new and malloc() from MString e.t.c.) goes through malloc(), which is
+// replaced here with a version that counts calls and the bytes in use. The counters are atomic, since some
+// benchmarks allocate from more than one thread. Only glibc exports __libc_malloc() and friends, so on
+// anything else allocs_per_op is reported as -1.
+#if defined(__GLIBC__)
+
+	#include <malloc.h>		// malloc_usable_size()
+
+	#define BENCH_ALLOC_COUNTING_SUPPORTED 1
+
+	extern "C"
+	{
+		void* __libc_malloc(size_t size);
+		void* __libc_calloc(size_t num, size_t size);
+		void* __libc_realloc(void* ptr, size_t size);
+		void __libc_free(void* ptr);
+	}
+
+	static std::atomic<uint64_t> _benchNumAllocs(0);
+
+	//! @brief		The number of heap bytes currently allocated (including malloc()'s rounding up).
+	static std::atomic<int64_t> _benchHeapBytesInUse(0);
+
+	extern "C" void* malloc(size_t size)
+	{
+		_benchNumAllocs.fetch_add(1, std::memory_order_relaxed);
+		void* ptr = __libc_malloc(size);
+		_benchHeapBytesInUse.fetch_add(malloc_usable_size(ptr), std::memory_order_relaxed);
+		return ptr;
+	}
+
+	extern "C" void* calloc(size_t num, size_t size)
+	{
+		_benchNumAllocs.fetch_add(1, std::memory_order_relaxed);
+		void* ptr = __libc_calloc(num, size);
+		_benchHeapBytesInUse.fetch_add(malloc_usable_size(ptr), std::memory_order_relaxed);
+		return ptr;
+	}
+
+	extern "C" void* realloc(void* ptr, size_t size)
+	{
+		_benchNumAllocs.fetch_add(1, std::memory_order_relaxed);
+		_benchHeapBytesInUse.fetch_sub(malloc_usable_size(ptr), std::memory_order_relaxed);
+		void* newPtr = __libc_realloc(ptr, size);
+		if(newPtr != NULL)
+			_benchHeapBytesInUse.fetch_add(malloc_usable_size(newPtr), std::memory_order_relaxed);
+		else if(size != 0)
+			// realloc() failed, so the old block is still allocated
+			_benchHeapBytesInUse.fetch_add(malloc_usable_size(ptr), std::memory_order_relaxed);
+		return newPtr;
+	}
+
+	extern "C" void free(void* ptr)
+	{
+		_benchHeapBytesInUse.fetch_sub(malloc_usable_size(ptr), std::memory_order_relaxed);
+		__libc_free(ptr);
+	}
+
+	void* operator new(size_t size)
+	{
+		void* ptr = malloc(size);
+		if(ptr == NULL)
+			throw std::bad_alloc();
+		return ptr;
+	}
+
+	void* operator new[](size_t size)
+	{
+		return operator new(size);
+	}
+
+	void operator delete(void* ptr) noexcept
+	{
+		free(ptr);
+	}
+
+	void operator delete[](void* ptr) noexcept
+	{
+		free(ptr);
+	}
+
+#else
+	#define BENCH_ALLOC_COUNTING_SUPPORTED 0
+	static std::atomic<uint64_t> _benchNumAllocs(0);
+	static std::atomic<int64_t> _benchHeapBytesInUse(0);
+#endif
+
+//===============================================================================================//
+//========================================= BENCH RUNNER ========================================//
+//===============================================================================================//
+
+namespace MClideBench
+{
+
+	//! @brief		Writes s to stdout as a JSON string (with quotes).
+	inline void PrintJsonString(const char* s)
+	{
+		putchar('"');
+		for(; *s != '\0'; s++)
+		{
+			if((*s == '"') || (*s == '\\'))
+				putchar('\\');
+			putchar(*s);
+		}
+		putchar('"');
+	}
+
+	//! @brief		Prints one line of JSON with the result of a benchmark case.
+	//! @details	Used by Measure() and MeasureEach(), and by benchmarks which have to do their own timing (e.g. ones
+	//!				with more than one thread).
+	inline void PrintResult(const char* benchName, const char* caseName, uint32_t numIterations, double nsPerOp, double allocsPerOp)
+	{
+		printf("{\"bench\": ");
+		PrintJsonString(benchName);
+		printf(", \"case\": ");
+		PrintJsonString(caseName);
+		printf(", \"iterations\": %u, \"ns_per_op\": %.1f, \"allocs_per_op\": %.2f}\n",
+			(unsigned int)numIterations,
+			nsPerOp,
+			allocsPerOp);
+	}
+
+	//! @brief		Prints one line of JSON with a count that goes with a benchmark case (e.g. the number of calls to
+	//!				an output sink per operation).
+	inline void PrintMetric(const char* benchName, const char* caseName, const char* metricName, double value)
+	{
+		printf("{\"bench\": ");
+		PrintJsonString(benchName);
+		printf(", \"case\": ");
+		PrintJsonString(caseName);
+		printf(", ");
+		PrintJsonString(metricName);
+		printf(": %.2f}\n", value);
+	}
+
+	//! @brief		Calls fn() numIterations times (after a short warm-up) and prints one line of JSON with the
+	//!				mean time and number of heap allocations per call.
+	//! @details	Output is one JSON object per line (JSON Lines), so the output of every benchmark program can be
+	//!				concatenated and still be read line by line, e.g.
+	//!				{"bench": "RxBench", "case": "params", "iterations": 500000, "ns_per_op": 98.1, "allocs_per_op": 1.00}
+	//! @param		benchName		The name of the benchmark program.
+	//! @param		caseName		The name of what is being measured, unique within the benchmark program.
+	//! @returns	The mean time per call, in ns.
+	template<typename Fn>
+	static double Measure(const char* benchName, const char* caseName, uint32_t numIterations, Fn fn)
+	{
+		// Warm up caches (and anything that allocates on first use, which is not steady state)
+		uint32_t numWarmUpIterations = (numIterations/10 > 0) ? numIterations/10 : 1;
+		for(uint32_t x = 0; x < numWarmUpIterations; x++)
+			fn();
+
+		uint64_t numAllocsAtStart = _benchNumAllocs.load(std::memory_order_relaxed);
+		auto start = std::chrono::steady_clock::now();
+		for(uint32_t x = 0; x < numIterations; x++)
+			fn();
+		auto end = std::chrono::steady_clock::now();
+		uint64_t numAllocs = _benchNumAllocs.load(std::memory_order_relaxed) - numAllocsAtStart;
+
+		double nsPerOp = std::chrono::duration<double, std::nano>(end - start).count()/numIterations;
+		double allocsPerOp = BENCH_ALLOC_COUNTING_SUPPORTED ? (double)numAllocs/numIterations : -1.0;
+
+		PrintResult(benchName, caseName, numIterations, nsPerOp, allocsPerOp);
+
+		return nsPerOp;
+	}
+
+	//! @brief		Like Measure(), but calls setupFn() before every call to fn(), and only times fn().
+	//! @details	Used to time one step on its own, e.g. the end-of-command character after the rest of a command has
+	//!				already been written. Each call is timed separately, so ns_per_op includes the overhead of reading
+	//!				the clock (tens of ns), which is the same for every case. allocs_per_op only counts fn().
+	template<typename SetupFn, typename Fn>
+	static double MeasureEach(const char* benchName, const char* caseName, uint32_t numIterations, SetupFn setupFn, Fn fn)
+	{
+		uint32_t numWarmUpIterations = (numIterations/10 > 0) ? numIterations/10 : 1;
+		for(uint32_t x = 0; x < numWarmUpIterations; x++)
+		{
+			setupFn();
+			fn();
+		}
+
+		uint64_t numAllocs = 0;
+		std::chrono::steady_clock::duration total(0);
+		for(uint32_t x = 0; x < numIterations; x++)
+		{
+			setupFn();
+			uint64_t numAllocsAtStart = _benchNumAllocs.load(std::memory_order_relaxed);
+			auto start = std::chrono::steady_clock::now();
+			fn();
+			auto end = std::chrono::steady_clock::now();
+			numAllocs += _benchNumAllocs.load(std::memory_order_relaxed) - numAllocsAtStart;
+			total += end - start;
+		}
+
+		double nsPerOp = std::chrono::duration<double, std::nano>(total).count()/numIterations;
+		double allocsPerOp = BENCH_ALLOC_COUNTING_SUPPORTED ? (double)numAllocs/numIterations : -1.0;
+
+		PrintResult(benchName, caseName, numIterations, nsPerOp, allocsPerOp);
+
+		return nsPerOp;
+	}
+
+} // namespace MClideBench
+
+#endif	// #ifndef MCLIDE_BENCH_HARNESS_H
+
+// EOF
@@ -0,0 +1,125 @@
+//!
+//! @file 			CmdLookupBench.cpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! @created		2026-10-16
+//! @last-modified 	2026-10-17
+//! @brief 			Benchmark showing that command (and option) lookup time does not grow with the number registered.
+//! @details
+//!					Run with "make bench". See README.rst in root dir for more info.
+
+//===== SYSTEM LIBRARIES =====//
+#include <stdio.h>
+#include <string.h>
+
+//===== USER SOURCE =====//
+#include "../api/MClideApi.hpp"
+#include "BenchHarness.hpp"
+
+using namespace MbeddedNinja::MClideNs;
+
+//! @brief		Registers numCmds commands with an Rx object and times the command index lookup on its own, and
+//!				Rx::Run() on the first and last (worst case for a linear search) registered commands.
+static void RunLookupBench(uint32_t numCmds)
+{
+	const uint32_t numIterations = 200000;
+
+	Rx rxController;
+
+	// Commands have to persist while registered
+	Cmd** cmdA = new Cmd*[numCmds];
+	char name[20];
+	for(uint32_t x = 0; x < numCmds; x++)
+	{
+		snprintf(name, sizeof(name), "cmd%05u", (unsigned int)x);
+		cmdA[x] = new Cmd(name, NULL, "Benchmark command.");
+		rxController.RegisterCmd(cmdA[x]);
+	}
+
+	char lastCmdMsg[20];
+	snprintf(lastCmdMsg, sizeof(lastCmdMsg), "cmd%05u", (unsigned int)(numCmds - 1));
+	uint32_t lastCmdMsgLen = strlen(lastCmdMsg);
+	const char* firstCmdMsg = "cmd00000";
+
+	char caseName[50];
+
+	// Lookup on its own
+	volatile uint32_t foundIndex = 0;
+	snprintf(caseName, sizeof(caseName), "cmds=%u/lookup", (unsigned int)numCmds);
+	MClideBench::Measure("CmdLookupBench", caseName, numIterations,
+		[&]() { foundIndex = rxController.cmdIndex.Find(lastCmdMsg, lastCmdMsgLen); });
+	(void)foundIndex;
+
+	snprintf(caseName, sizeof(caseName), "cmds=%u/run first", (unsigned int)numCmds);
+	MClideBench::Measure("CmdLookupBench", caseName, numIterations, [&]() { rxController.Run(firstCmdMsg); });
+
+	snprintf(caseName, sizeof(caseName), "cmds=%u/run last", (unsigned int)numCmds);
+	MClideBench::Measure("CmdLookupBench", caseName, numIterations, [&]() { rxController.Run(lastCmdMsg); });
+
+	for(uint32_t x = 0; x < numCmds; x++)
+		delete cmdA[x];
+	delete[] cmdA;
+}
+
+//! @brief		Registers numOptions options with a command and times finding the last one by long name, by short
+//!				name and by the handle returned by Cmd::RegisterOption().
+static void RunOptionLookupBench(uint32_t numOptions)
+{
+	const uint32_t numIterations = 200000;
+
+	Cmd cmd("cmd", NULL, "Benchmark command.");
+
+	// Options have to persist while registered. Only the first 26 get a short name.
+	Option** optionA = new Option*[numOptions];
+	OptionHandle lastOptionHandle;
+	char name[20];
+	for(uint32_t x = 0; x < numOptions; x++)
+	{
+		snprintf(name, sizeof(name), "opt%05u", (unsigned int)x);
+		optionA[x] = new Option((x < 26) ? (char)('a' + x) : '\0', name, NULL, "Benchmark option.", false);
+		lastOptionHandle = cmd.RegisterOption(optionA[x]);
+	}
+
+	const char* lastOptionName = name;
+	char lastShortName = (numOptions < 26) ? (char)('a' + numOptions - 1) : 'z';
+
+	char caseName[50];
+	Option* volatile foundOption = NULL;
+
+	snprintf(caseName, sizeof(caseName), "options=%u/find long name", (unsigned int)numOptions);
+	MClideBench::Measure("CmdLookupBench", caseName, numIterations,
+		[&]() { foundOption = cmd.FindOptionByLongName(lastOptionName); });
+
+	snprintf(caseName, sizeof(caseName), "options=%u/find short name", (unsigned int)numOptions);
+	MClideBench::Measure("CmdLookupBench", caseName, numIterations,
+		[&]() { foundOption = cmd.FindOptionByShortName(lastShortName); });
+
+	snprintf(caseName, sizeof(caseName), "options=%u/handle", (unsigned int)numOptions);
+	MClideBench::Measure("CmdLookupBench", caseName, numIterations,
+		[&]() { foundOption = cmd.GetOption(lastOptionHandle); });
+	(void)foundOption;
+
+	for(uint32_t x = 0; x < numOptions; x++)
+		delete optionA[x];
+	delete[] optionA;
+}
+
+int main()
+{
+	Print::enableCmdLinePrinting = false;
+	Print::enableErrorPrinting = false;
+	Print::enableDebugInfoPrinting = false;
+
+	// Command lookup and Rx::Run() latency vs. number of registered commands
+	RunLookupBench(10);
+	RunLookupBench(100);
+	RunLookupBench(1000);
+	RunLookupBench(10000);
+
+	// Option lookup latency vs. number of options registered with a command
+	RunOptionLookupBench(4);
+	RunOptionLookupBench(100);
+
+	return 0;
+}
+
+// EOF
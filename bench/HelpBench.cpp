@@ -0,0 +1,154 @@
+//!
+//! @file 			HelpBench.cpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! @created		2026-10-16
+//! @last-modified 	2026-10-17
+//! @brief 			Benchmark of the help command on a large registry, with and without a PrintSink buffer and the help cache.
+//! @details
+//!					Run with "make bench". See README.rst in root dir for more info.
+
+//===== SYSTEM LIBRARIES =====//
+#include <stdio.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+//===== USER SOURCE =====//
+#include "../api/MClideApi.hpp"
+#include "BenchHarness.hpp"
+
+using namespace MbeddedNinja::MClideNs;
+
+//! @brief		Writes everything to /dev/null, one write() per call like a real port, and counts the calls.
+class NullPort
+{
+	public:
+
+	NullPort()
+	{
+		this->fd = open("/dev/null", O_WRONLY);
+	}
+
+	~NullPort()
+	{
+		close(this->fd);
+	}
+
+	void Print(const char* msg)
+	{
+		this->numCalls++;
+		if(write(this->fd, msg, strlen(msg)) < 0)
+			this->numErrors++;
+	}
+
+	void Write(PrintChunk chunk)
+	{
+		this->numCalls++;
+		if(write(this->fd, chunk.chars, chunk.numChars) < 0)
+			this->numErrors++;
+	}
+
+	int fd;
+	uint64_t numCalls = 0;
+	uint64_t numErrors = 0;
+};
+
+//! @brief		Measures "help" rendered every time (the help cache cleared first) and served from the help cache.
+static void MeasureHelp(Rx* rxController, NullPort* port, const char* caseName, uint32_t numIterations)
+{
+	char fullCaseName[60];
+
+	snprintf(fullCaseName, sizeof(fullCaseName), "%s uncached", caseName);
+	port->numCalls = 0;
+	MClideBench::Measure("HelpBench", fullCaseName, numIterations,
+		[&]() { rxController->InvalidateHelpCache(); rxController->Run("help"); });
+	MClideBench::PrintMetric("HelpBench", fullCaseName, "sink_calls_per_op", (double)port->numCalls/(numIterations + numIterations/10));
+
+	snprintf(fullCaseName, sizeof(fullCaseName), "%s cached", caseName);
+	port->numCalls = 0;
+	MClideBench::Measure("HelpBench", fullCaseName, numIterations, [&]() { rxController->Run("help"); });
+	MClideBench::PrintMetric("HelpBench", fullCaseName, "sink_calls_per_op", (double)port->numCalls/(numIterations + numIterations/10));
+}
+
+//! @brief		Registers numCmds commands and times "help", with one sink call per fragment and with a buffer,
+//!				"help -g" for a small group, and "help -g" for every command rendered without the cache (frozen).
+static void RunHelpBench(uint32_t numCmds)
+{
+	const uint32_t numIterations = 2000;
+
+	Rx rxController;
+	NullPort port;
+
+	// Commands have to persist while registered
+	Cmd** cmdA = new Cmd*[numCmds];
+	char name[20];
+	for(uint32_t x = 0; x < numCmds; x++)
+	{
+		snprintf(name, sizeof(name), "cmd%05u", (unsigned int)x);
+		cmdA[x] = new Cmd(name, NULL, "Benchmark command.");
+		rxController.RegisterCmd(cmdA[x]);
+	}
+
+	char caseName[50];
+
+	// One sink call per fragment
+	rxController.printSink.cmdLinePrintCallback =
+		MCallbacks::CallbackGen<NullPort, void, const char*>(&port, &NullPort::Print);
+	snprintf(caseName, sizeof(caseName), "cmds=%u/help unbuffered", (unsigned int)numCmds);
+	MeasureHelp(&rxController, &port, caseName, numIterations);
+
+	// Collected in a buffer and written once per response (or when the buffer is full)
+	static char buff[4096];
+	rxController.printSink.cmdLineWriteCallback =
+		MCallbacks::CallbackGen<NullPort, void, PrintChunk>(&port, &NullPort::Write);
+	rxController.printSink.SetBuffer(buff, sizeof(buff));
+	snprintf(caseName, sizeof(caseName), "cmds=%u/help buffered 4KB", (unsigned int)numCmds);
+	MeasureHelp(&rxController, &port, caseName, numIterations);
+
+	// A group with 10 of the commands in it, rendered every time
+	CmdGroup cmdGroupSmall("small", "Every hundredth command.");
+	for(uint32_t x = 0; x < numCmds; x += numCmds/10)
+		cmdA[x]->AddToGroup(&cmdGroupSmall);
+	port.numCalls = 0;
+	snprintf(caseName, sizeof(caseName), "cmds=%u/help -g (10 cmds) uncached", (unsigned int)numCmds);
+	MClideBench::Measure("HelpBench", caseName, numIterations,
+		[&]() { rxController.InvalidateHelpCache(); rxController.Run("help -g small"); });
+
+	// Help that isn't cached when the Rx is frozen is printed as it is rendered, one sink call per fragment
+	// unless there is a buffer. Every command is put in a new group ("all" is cached by Freeze()), so the listing
+	// is about the same size as "help".
+	CmdGroup cmdGroupEvery("every", "Every command, in a group of its own.");
+	for(uint32_t x = 0; x < numCmds; x++)
+		cmdA[x]->AddToGroup(&cmdGroupEvery);
+	rxController.Freeze();
+
+	rxController.printSink.SetBuffer(NULL, 0);
+	port.numCalls = 0;
+	snprintf(caseName, sizeof(caseName), "cmds=%u/help -g every frozen unbuffered", (unsigned int)numCmds);
+	MClideBench::Measure("HelpBench", caseName, numIterations, [&]() { rxController.Run("help -g every"); });
+	MClideBench::PrintMetric("HelpBench", caseName, "sink_calls_per_op", (double)port.numCalls/(numIterations + numIterations/10));
+
+	rxController.printSink.SetBuffer(buff, sizeof(buff));
+	port.numCalls = 0;
+	snprintf(caseName, sizeof(caseName), "cmds=%u/help -g every frozen buffered 4KB", (unsigned int)numCmds);
+	MClideBench::Measure("HelpBench", caseName, numIterations, [&]() { rxController.Run("help -g every"); });
+	MClideBench::PrintMetric("HelpBench", caseName, "sink_calls_per_op", (double)port.numCalls/(numIterations + numIterations/10));
+
+	for(uint32_t x = 0; x < numCmds; x++)
+		delete cmdA[x];
+	delete[] cmdA;
+}
+
+int main()
+{
+	Print::enableCmdLinePrinting = false;
+	Print::enableErrorPrinting = false;
+	Print::enableDebugInfoPrinting = false;
+
+	RunHelpBench(100);
+	RunHelpBench(1000);
+
+	return 0;
+}
+
+// EOF
@@ -0,0 +1,93 @@
+//!
+//! @file 			OptionParserBench.cpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! @created		2026-10-16
+//! @last-modified 	2026-10-16
+//! @brief 			Benchmark comparing Rx::Run() with the getopt_long() and single-pass option parsers.
+//! @details
+//!					Run with "make bench". See README.rst in root dir for more info.
+
+//===== SYSTEM LIBRARIES =====//
+#include <stdio.h>
+#include <stdint.h>
+
+//===== USER SOURCE =====//
+#include "../api/MClideApi.hpp"
+#include "BenchHarness.hpp"
+
+using namespace MbeddedNinja::MClideNs;
+
+static bool Callback(Cmd* cmd)
+{
+	return true;
+}
+
+//! @brief		Times Rx::Run() on msg with the given option parser, for a command with numOptions options.
+static void TimeRun(Rx::OptionParserMode mode, uint32_t numOptions, const char* msg)
+{
+	const uint32_t numIterations = 200000;
+
+	Rx rxController;
+	rxController.optionParserMode = mode;
+
+	Cmd cmdTest("test", &Callback, "Benchmark command.");
+	Param cmdTestParam("Benchmark parameter.");
+	cmdTest.RegisterParam(&cmdTestParam);
+
+	// Options "opt00" to "optNN", the first 26 also with short names 'A' to 'Z'
+	Option** optionA = new Option*[numOptions];
+	// Big enough for any uint32_t, although only 2 digits are used
+	char longName[16];
+	for(uint32_t x = 0; x < numOptions; x++)
+	{
+		snprintf(longName, sizeof(longName), "opt%02u", (unsigned int)x);
+		optionA[x] = new Option((x < 26) ? ('A' + x) : '\0', longName, NULL, "Benchmark option.", (x % 2) == 1);
+		cmdTest.RegisterOption(optionA[x]);
+	}
+	rxController.RegisterCmd(&cmdTest);
+
+	char caseName[100];
+	snprintf(
+		caseName,
+		sizeof(caseName),
+		"%s/options=%u/%s",
+		(mode == Rx::OptionParserMode::SINGLE_PASS) ? "single" : "getopt",
+		(unsigned int)numOptions,
+		msg);
+	MClideBench::Measure("OptionParserBench", caseName, numIterations, [&]() { rxController.Run(msg); });
+
+	for(uint32_t x = 0; x < numOptions; x++)
+		delete optionA[x];
+	delete[] optionA;
+}
+
+int main()
+{
+	Print::enableCmdLinePrinting = false;
+	Print::enableErrorPrinting = false;
+	Print::enableDebugInfoPrinting = false;
+
+	struct
+	{
+		uint32_t numOptions;
+		const char* msg;
+	} caseA[] =
+	{
+		{ 2, "test param1 -A" },
+		{ 2, "test -A -B val param1" },
+		{ 10, "test -A param1 -B val --opt04 --opt05=val" },
+		{ 50, "test --opt48 --opt49 val param1" },
+		{ 50, "test -ACE -Bval param1 --opt30 --opt41 val" },
+	};
+
+	// Rx::Run() latency with each option parser
+	for(uint32_t x = 0; x < sizeof(caseA)/sizeof(caseA[0]); x++)
+	{
+		TimeRun(Rx::OptionParserMode::GETOPT, caseA[x].numOptions, caseA[x].msg);
+		TimeRun(Rx::OptionParserMode::SINGLE_PASS, caseA[x].numOptions, caseA[x].msg);
+	}
+
+	return 0;
+}
+
+// EOF
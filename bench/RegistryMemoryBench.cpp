@@ -0,0 +1,113 @@
+//!
+//! @file 			RegistryMemoryBench.cpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! @created		2026-10-17
+//! @last-modified 	2026-10-17
+//! @brief 			Benchmark of the heap used by a large command registry, with the shared built-in help option
+//!					and with a help option registered with every command (how it used to be).
+//! @details
+//!					Run with "make bench". See README.rst in root dir for more info.
+
+//===== SYSTEM LIBRARIES =====//
+#include <stdio.h>
+#include <chrono>
+
+//===== USER SOURCE =====//
+#include "../api/MClideApi.hpp"
+#include "BenchHarness.hpp"
+
+using namespace MbeddedNinja::MClideNs;
+
+//! @brief		Registers numCmds commands (each with one option and one parameter) and prints the heap bytes and
+//!				allocations they use, and how long registering them took.
+//! @param		perCmdHelpOption	If true, also registers a new "-h/--help" Option with every command, like
+//!									Cmd used to.
+//! @param		printResults		false for a warm-up run.
+static void RunRegistryBench(uint32_t numCmds, bool perCmdHelpOption, bool printResults)
+{
+	char caseName[60];
+	snprintf(caseName, sizeof(caseName), "cmds=%u/%s", (unsigned int)numCmds,
+		perCmdHelpOption ? "per-command help option" : "shared help option");
+
+	// Commands, options and parameters have to persist while registered
+	Cmd** cmdA = new Cmd*[numCmds];
+	Option** optionA = new Option*[numCmds];
+	Option** helpOptionA = new Option*[numCmds];
+	Param** paramA = new Param*[numCmds];
+
+	int64_t heapBytesAtStart = _benchHeapBytesInUse.load(std::memory_order_relaxed);
+	uint64_t numAllocsAtStart = _benchNumAllocs.load(std::memory_order_relaxed);
+	auto start = std::chrono::steady_clock::now();
+
+	Rx* rxController = new Rx();
+	char name[20];
+	for(uint32_t x = 0; x < numCmds; x++)
+	{
+		snprintf(name, sizeof(name), "cmd%05u", (unsigned int)x);
+		cmdA[x] = new Cmd(name, NULL, "Benchmark command.");
+		helpOptionA[x] = NULL;
+		if(perCmdHelpOption)
+		{
+			helpOptionA[x] = new Option('h', "help", NULL, "Prints help for the command.", false);
+			cmdA[x]->RegisterOption(helpOptionA[x]);
+		}
+		optionA[x] = new Option('v', "verbose", NULL, "Verbose.", false);
+		cmdA[x]->RegisterOption(optionA[x]);
+		paramA[x] = new Param("A parameter.");
+		cmdA[x]->RegisterParam(paramA[x]);
+		rxController->RegisterCmd(cmdA[x]);
+	}
+	rxController->Freeze();
+
+	auto end = std::chrono::steady_clock::now();
+	uint64_t numAllocs = _benchNumAllocs.load(std::memory_order_relaxed) - numAllocsAtStart;
+	int64_t heapBytes = _benchHeapBytesInUse.load(std::memory_order_relaxed) - heapBytesAtStart;
+
+	double nsPerCmd = std::chrono::duration<double, std::nano>(end - start).count()/numCmds;
+	if(printResults)
+	{
+		MClideBench::PrintResult("RegistryMemoryBench", caseName, numCmds, nsPerCmd,
+			BENCH_ALLOC_COUNTING_SUPPORTED ? (double)numAllocs/numCmds : -1.0);
+		MClideBench::PrintMetric("RegistryMemoryBench", caseName, "heap_bytes",
+			BENCH_ALLOC_COUNTING_SUPPORTED ? (double)heapBytes : -1.0);
+		MClideBench::PrintMetric("RegistryMemoryBench", caseName, "heap_bytes_per_cmd",
+			BENCH_ALLOC_COUNTING_SUPPORTED ? (double)heapBytes/numCmds : -1.0);
+	}
+
+	// Help still works the same way either way
+	Print::enableCmdLinePrinting = false;
+	rxController->Run("cmd00000 -h");
+
+	delete rxController;
+	for(uint32_t x = 0; x < numCmds; x++)
+	{
+		delete cmdA[x];
+		delete optionA[x];
+		delete helpOptionA[x];
+		delete paramA[x];
+	}
+	delete[] cmdA;
+	delete[] optionA;
+	delete[] helpOptionA;
+	delete[] paramA;
+}
+
+int main()
+{
+	Print::enableCmdLinePrinting = false;
+	Print::enableErrorPrinting = false;
+	Print::enableDebugInfoPrinting = false;
+
+	// Creates the shared help option before anything is measured (it is made once, by the first Cmd)
+	Cmd::GetHelpOption();
+
+	// The first registry gets its memory from the OS, later ones reuse it, so warm up first
+	RunRegistryBench(5000, true, false);
+
+	RunRegistryBench(5000, false, true);
+	RunRegistryBench(5000, true, true);
+
+	return 0;
+}
+
+// EOF
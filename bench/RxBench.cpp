@@ -0,0 +1,132 @@
+//!
+//! @file 			RxBench.cpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! @created		2026-10-16
+//! @last-modified 	2026-10-16
+//! @brief 			Benchmark of Rx::Run() latency by command shape, for messages and for argc/argv.
+//! @details
+//!					Run with "make bench". See README.rst in root dir for more info.
+
+//===== SYSTEM LIBRARIES =====//
+#include <stdio.h>
+#include <stdint.h>
+
+//===== USER SOURCE =====//
+#include "../api/MClideApi.hpp"
+#include "BenchHarness.hpp"
+
+using namespace MbeddedNinja::MClideNs;
+
+static bool Callback(Cmd* cmd)
+{
+	return true;
+}
+
+static bool ResultCallback(const ParseResult& result)
+{
+	return true;
+}
+
+//! @brief		A command with two parameters, two short/long options without values and two with values.
+class BenchParser
+{
+	public:
+
+	Rx rxController;
+	Cmd cmd;
+	Param param1;
+	Param param2;
+	Option optionA;
+	Option optionB;
+	Option optionC;
+	Option optionD;
+
+	BenchParser(bool frozen) :
+		cmd("test", frozen ? NULL : &Callback, "Benchmark command."),
+		param1("Benchmark parameter."),
+		param2("Benchmark parameter."),
+		optionA('a', "alpha", NULL, "Benchmark option.", false),
+		optionB('b', "bravo", NULL, "Benchmark option.", false),
+		optionC('c', "charlie", NULL, "Benchmark option with a value.", true),
+		optionD('d', "delta", NULL, "Benchmark option with a value.", true)
+	{
+		this->cmd.RegisterParam(&this->param1);
+		this->cmd.RegisterParam(&this->param2);
+		this->cmd.RegisterOption(&this->optionA);
+		this->cmd.RegisterOption(&this->optionB);
+		this->cmd.RegisterOption(&this->optionC);
+		this->cmd.RegisterOption(&this->optionD);
+		this->rxController.RegisterCmd(&this->cmd);
+
+		if(frozen)
+		{
+			this->cmd.resultFunctionCallback = &ResultCallback;
+			this->rxController.Freeze();
+		}
+	}
+};
+
+int main()
+{
+	Print::enableCmdLinePrinting = false;
+	Print::enableErrorPrinting = false;
+	Print::enableDebugInfoPrinting = false;
+
+	const uint32_t numIterations = 500000;
+
+	struct
+	{
+		const char* caseName;
+		const char* msg;
+	} shapeA[] =
+	{
+		{ "params", "test param1 param2" },
+		{ "short options", "test -a -b -c val1 -d val2 param1 param2" },
+		{ "long options", "test --alpha --bravo --charlie val1 --delta=val2 param1 param2" },
+		{ "quoted values", "test -c \"-1.5\" -d \"a b\" \"-2\" \"param 2\"" },
+	};
+
+	char caseName[100];
+
+	// Rx::Run(char*) by command shape, with each option parser, unfrozen and frozen
+	for(uint32_t frozen = 0; frozen <= 1; frozen++)
+	{
+		BenchParser parser(frozen == 1);
+		for(uint32_t mode = 0; mode <= 1; mode++)
+		{
+			parser.rxController.optionParserMode =
+				(mode == 1) ? Rx::OptionParserMode::SINGLE_PASS : Rx::OptionParserMode::GETOPT;
+			for(uint32_t x = 0; x < sizeof(shapeA)/sizeof(shapeA[0]); x++)
+			{
+				snprintf(
+					caseName,
+					sizeof(caseName),
+					"run msg/%s/%s/%s",
+					shapeA[x].caseName,
+					(mode == 1) ? "single" : "getopt",
+					(frozen == 1) ? "frozen" : "unfrozen");
+				const char* msg = shapeA[x].msg;
+				MClideBench::Measure("RxBench", caseName, numIterations, [&]() { parser.rxController.Run(msg); });
+			}
+		}
+	}
+
+	// Rx::Run(argc, argv), as passed to main()
+	{
+		BenchParser parser(false);
+		char argv0[] = "./prog";
+		char argv1[] = "test";
+		char argv2[] = "-a";
+		char argv3[] = "--charlie";
+		char argv4[] = "val1";
+		char argv5[] = "param1";
+		char argv6[] = "param2";
+		char* argv[] = { argv0, argv1, argv2, argv3, argv4, argv5, argv6, NULL };
+		int argc = 7;
+		MClideBench::Measure("RxBench", "run argv/unfrozen", numIterations, [&]() { parser.rxController.Run(argc, argv); });
+	}
+
+	return 0;
+}
+
+// EOF
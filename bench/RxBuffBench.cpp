@@ -0,0 +1,158 @@
+//!
+//! @file 			RxBuffBench.cpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! @created		2026-10-16
+//! @last-modified 	2026-10-16
+//! @brief 			Benchmark of feeding messages into an RxBuff with RxBuff::WriteChar(), RxBuff::WriteString() and RxBuff::WriteBytes().
+//! @details
+//!					Run with "make bench". See README.rst in root dir for more info.
+
+//===== SYSTEM LIBRARIES =====//
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+
+//===== USER SOURCE =====//
+#include "../api/MClideApi.hpp"
+#include "BenchHarness.hpp"
+
+using namespace MbeddedNinja::MClideNs;
+
+//! @brief		Counts the messages that make it through the RxBuff, so the work can not be optimised away.
+static uint32_t _numCallbacks = 0;
+
+static bool Callback(Cmd* cmd)
+{
+	_numCallbacks++;
+	return true;
+}
+
+int main()
+{
+	Print::enableCmdLinePrinting = false;
+	Print::enableErrorPrinting = false;
+	Print::enableDebugInfoPrinting = false;
+
+	const uint32_t numIterations = 200000;
+
+	Rx rxController;
+	Cmd cmdTest("test", &Callback, "Benchmark command.");
+	Param cmdTestParam("Benchmark parameter.");
+	cmdTest.RegisterParam(&cmdTestParam);
+	Option cmdTestOption('a', "alpha", NULL, "Benchmark option with a value.", true);
+	cmdTest.RegisterOption(&cmdTestOption);
+	rxController.RegisterCmd(&cmdTest);
+
+	RxBuff rxBuff(&rxController, '\n');
+
+	// One op is one whole message, including the end-of-command character
+	const char* msg = "test --alpha 12345 param1\n";
+	size_t msgLen = strlen(msg);
+
+	MClideBench::Measure("RxBuffBench", "WriteChar/msg", numIterations, [&]()
+	{
+		for(size_t x = 0; x < msgLen; x++)
+			rxBuff.WriteChar(msg[x]);
+	});
+
+	MClideBench::Measure("RxBuffBench", "WriteString/msg", numIterations, [&]() { rxBuff.WriteString(msg); });
+
+	MClideBench::Measure("RxBuffBench", "WriteBytes/msg", numIterations, [&]() { rxBuff.WriteBytes(msg, msgLen); });
+
+	// A 4KB chunk, as handed over by a DMA UART reader, holding as many whole messages as fit
+	char chunk[4096];
+	size_t chunkLen = 0;
+	while(chunkLen + msgLen <= sizeof(chunk))
+	{
+		memcpy(&chunk[chunkLen], msg, msgLen);
+		chunkLen += msgLen;
+	}
+
+	const uint32_t numChunkIterations = 2000;
+
+	MClideBench::Measure("RxBuffBench", "WriteChar/4KB chunk", numChunkIterations, [&]()
+	{
+		for(size_t x = 0; x < chunkLen; x++)
+			rxBuff.WriteChar(chunk[x]);
+	});
+
+	MClideBench::Measure("RxBuffBench", "WriteBytes/4KB chunk", numChunkIterations, [&]() { rxBuff.WriteBytes(chunk, chunkLen); });
+
+	// Terminator-to-callback latency: the rest of the command has already been written (not timed), only the
+	// end-of-command character is. Without streaming, the whole command is scanned once it arrives. With
+	// streaming, it has already been split and looked up.
+	const char* longMsg = "test --alpha \"-1.5\" param1 with some more words to make the command much longer";
+	Cmd cmdLong("test", &Callback, "Benchmark command.");
+
+	const uint32_t numLatencyIterations = 200000;
+
+	RxBuff streamingRxBuff(&rxController, '\n');
+	streamingRxBuff.SetStreaming(true);
+
+	Rx longRxController;
+	for(uint32_t x = 0; x < 10; x++)
+		cmdLong.RegisterParam(new Param("Benchmark parameter."));
+	cmdLong.RegisterOption(new Option('a', "alpha", NULL, "Benchmark option with a value.", true));
+	longRxController.RegisterCmd(&cmdLong);
+	RxBuff longRxBuff(&longRxController, '\n');
+	RxBuff longStreamingRxBuff(&longRxController, '\n');
+	longStreamingRxBuff.SetStreaming(true);
+
+	MClideBench::MeasureEach("RxBuffBench", "terminator latency/msg", numLatencyIterations,
+		[&]() { rxBuff.WriteBytes(msg, msgLen - 1); },
+		[&]() { rxBuff.WriteChar('\n'); });
+
+	MClideBench::MeasureEach("RxBuffBench", "terminator latency/msg, streaming", numLatencyIterations,
+		[&]() { streamingRxBuff.WriteBytes(msg, msgLen - 1); },
+		[&]() { streamingRxBuff.WriteChar('\n'); });
+
+	MClideBench::MeasureEach("RxBuffBench", "terminator latency/long msg", numLatencyIterations,
+		[&]() { longRxBuff.WriteString(longMsg); },
+		[&]() { longRxBuff.WriteChar('\n'); });
+
+	MClideBench::MeasureEach("RxBuffBench", "terminator latency/long msg, streaming", numLatencyIterations,
+		[&]() { longStreamingRxBuff.WriteString(longMsg); },
+		[&]() { longStreamingRxBuff.WriteChar('\n'); });
+
+	MClideBench::Measure("RxBuffBench", "WriteChar/msg, streaming", numIterations, [&]()
+	{
+		for(size_t x = 0; x < msgLen; x++)
+			streamingRxBuff.WriteChar(msg[x]);
+	});
+
+	MClideBench::Measure("RxBuffBench", "WriteBytes/4KB chunk, streaming", numChunkIterations, [&]()
+	{
+		streamingRxBuff.WriteBytes(chunk, chunkLen);
+	});
+
+	// A noisy serial line, one character at a time: 4KB of lines that are not commands
+	char junkChunk[4096];
+	for(size_t x = 0; x < sizeof(junkChunk); x++)
+		junkChunk[x] = (x % 64 == 63) ? '\n' : (char)('!' + (x*7919) % 90);
+
+	RxBuff rejectingRxBuff(&rxController, '\n');
+	rejectingRxBuff.SetStreaming(true);
+	rejectingRxBuff.SetEarlyRejection(true);
+
+	MClideBench::Measure("RxBuffBench", "WriteChar/4KB junk", numChunkIterations, [&]()
+	{
+		for(size_t x = 0; x < sizeof(junkChunk); x++)
+			rxBuff.WriteChar(junkChunk[x]);
+	});
+
+	MClideBench::Measure("RxBuffBench", "WriteChar/4KB junk, streaming", numChunkIterations, [&]()
+	{
+		for(size_t x = 0; x < sizeof(junkChunk); x++)
+			streamingRxBuff.WriteChar(junkChunk[x]);
+	});
+
+	MClideBench::Measure("RxBuffBench", "WriteChar/4KB junk, early rejection", numChunkIterations, [&]()
+	{
+		for(size_t x = 0; x < sizeof(junkChunk); x++)
+			rejectingRxBuff.WriteChar(junkChunk[x]);
+	});
+
+	return (_numCallbacks > 0) ? 0 : 1;
+}
+
+// EOF
@@ -0,0 +1,146 @@
+//!
+//! @file 			RxQueueBench.cpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! @created		2026-10-16
+//! @last-modified 	2026-10-16
+//! @brief 			Benchmark of RxQueue throughput and latency, with the producer and consumer on different cores.
+//! @details
+//!					Run with "make bench". See README.rst in root dir for more info.
+
+//===== SYSTEM LIBRARIES =====//
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <pthread.h>
+#include <sched.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+//===== USER SOURCE =====//
+#include "../api/MClideApi.hpp"
+#include "BenchHarness.hpp"
+
+using namespace MbeddedNinja::MClideNs;
+
+//! @brief		Counts the commands run by the consumer.
+static std::atomic<uint32_t> _numCallbacks(0);
+
+static bool ResultCallback(const ParseResult& result)
+{
+	_numCallbacks.store(_numCallbacks.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+	return true;
+}
+
+//! @brief		Pins a thread to one CPU.
+//! @returns	true if it was pinned.
+static bool PinToCpu(pthread_t thread, int cpu)
+{
+	cpu_set_t cpuSet;
+	CPU_ZERO(&cpuSet);
+	CPU_SET(cpu, &cpuSet);
+	return pthread_setaffinity_np(thread, sizeof(cpuSet), &cpuSet) == 0;
+}
+
+int main()
+{
+	Print::enableCmdLinePrinting = false;
+	Print::enableErrorPrinting = false;
+	Print::enableDebugInfoPrinting = false;
+
+	// Frozen, so nothing on the consumer side allocates
+	Rx rxController;
+	Cmd cmdTest("test", NULL, "Benchmark command.");
+	cmdTest.resultFunctionCallback = &ResultCallback;
+	Param cmdTestParam("Benchmark parameter.");
+	cmdTest.RegisterParam(&cmdTestParam);
+	Option cmdTestOption('a', "alpha", NULL, "Benchmark option with a value.", true);
+	cmdTest.RegisterOption(&cmdTestOption);
+	rxController.RegisterCmd(&cmdTest);
+	rxController.Freeze();
+
+	RxBuff rxBuff(&rxController, '\n');
+	StaticRxQueue<4096> rxQueue(&rxBuff);
+
+	const char* msg = "test --alpha 12345 param1\n";
+	uint32_t msgLen = (uint32_t)strlen(msg);
+
+	// Baseline, producer and consumer are the same thread
+	MClideBench::Measure("RxQueueBench", "same thread/msg", 200000, [&]()
+	{
+		rxQueue.Write(msg, msgLen);
+		rxQueue.Drain();
+	});
+
+	// Producer (this thread) and consumer on different cores. With only one CPU, neither can be pinned,
+	// and both give up the CPU when they have to wait rather than spinning.
+	bool pinned = (std::thread::hardware_concurrency() >= 2) && PinToCpu(pthread_self(), 0);
+
+	std::atomic<bool> stop(false);
+	std::thread consumer([&rxQueue, &stop, pinned]()
+	{
+		while(!stop.load(std::memory_order_relaxed))
+		{
+			if((rxQueue.Drain() == 0) && !pinned)
+				std::this_thread::yield();
+		}
+	});
+
+	if(pinned && !PinToCpu(consumer.native_handle(), 1))
+		pinned = false;
+
+	const char* pinning = pinned ? "pinned" : "not pinned";
+	char caseName[100];
+
+	// Throughput: the producer writes as fast as the queue lets it, one message at a time
+	const uint32_t numThroughputMsgs = 1000000;
+	uint32_t numCallbacksAtStart = _numCallbacks.load();
+	uint64_t numAllocsAtStart = _benchNumAllocs.load(std::memory_order_relaxed);
+	auto start = std::chrono::steady_clock::now();
+	for(uint32_t x = 0; x < numThroughputMsgs; x++)
+	{
+		uint32_t numWritten = 0;
+		while(numWritten < msgLen)
+		{
+			uint32_t num = rxQueue.Write(&msg[numWritten], msgLen - numWritten);
+			if((num == 0) && !pinned)
+				std::this_thread::yield();
+			numWritten += num;
+		}
+	}
+	while(_numCallbacks.load(std::memory_order_acquire) - numCallbacksAtStart < numThroughputMsgs)
+	{
+		if(!pinned)
+			std::this_thread::yield();
+	}
+	auto end = std::chrono::steady_clock::now();
+	uint64_t numAllocs = _benchNumAllocs.load(std::memory_order_relaxed) - numAllocsAtStart;
+
+	snprintf(caseName, sizeof(caseName), "throughput/msg, %s", pinning);
+	MClideBench::PrintResult(
+		"RxQueueBench",
+		caseName,
+		numThroughputMsgs,
+		std::chrono::duration<double, std::nano>(end - start).count()/numThroughputMsgs,
+		BENCH_ALLOC_COUNTING_SUPPORTED ? (double)numAllocs/numThroughputMsgs : -1.0);
+
+	// Latency: from writing the end-of-command character to the command callback on the consumer
+	snprintf(caseName, sizeof(caseName), "latency/msg, %s", pinning);
+	MClideBench::Measure("RxQueueBench", caseName, pinned ? 200000 : 2000, [&]()
+	{
+		uint32_t numCallbacks = _numCallbacks.load(std::memory_order_acquire);
+		rxQueue.Write(msg, msgLen);
+		while(_numCallbacks.load(std::memory_order_acquire) == numCallbacks)
+		{
+			if(!pinned)
+				std::this_thread::yield();
+		}
+	});
+
+	stop = true;
+	consumer.join();
+
+	return (_numCallbacks.load() > 0) ? 0 : 1;
+}
+
+// EOF
@@ -0,0 +1,132 @@
+//!
+//! @file 			StaticRxBench.cpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! @created		2026-10-17
+//! @last-modified 	2026-10-17
+//! @brief 			Benchmark comparing a command table built at runtime (Rx) with one built by the compiler (StaticRx).
+//! @details
+//!					Run with "make bench". See README.rst in root dir for more info.
+
+//===== SYSTEM LIBRARIES =====//
+#include <stdio.h>
+
+//===== USER SOURCE =====//
+#include "../api/MClideApi.hpp"
+#include "BenchHarness.hpp"
+
+using namespace MbeddedNinja::MClideNs;
+
+static const uint32_t NUM_CMDS = 8;
+
+static const char* const _cmdNameA[NUM_CMDS] = {
+	"start", "stop", "reset", "status", "set-speed", "get-speed", "log", "config" };
+
+static bool StaticCallback(const StaticParseResult& result)
+{
+	(void)result;
+	return true;
+}
+
+constexpr StaticOption _optionA[] = {
+	StaticOption('v', "verbose", "Verbose.", false),
+	StaticOption('l', "level", "The level.", true),
+	StaticOption('a', "all", "Everything.", false),
+};
+
+constexpr StaticParam _paramA[] = {
+	StaticParam("The first parameter."),
+	StaticParam("The second parameter."),
+};
+
+// The same commands as RegisterRuntimeCmds()
+constexpr StaticCmd _staticCmdA[] = {
+	StaticCmd("start", "Benchmark command.", &StaticCallback, _optionA, _paramA),
+	StaticCmd("stop", "Benchmark command.", &StaticCallback, _optionA, _paramA),
+	StaticCmd("reset", "Benchmark command.", &StaticCallback, _optionA, _paramA),
+	StaticCmd("status", "Benchmark command.", &StaticCallback, _optionA, _paramA),
+	StaticCmd("set-speed", "Benchmark command.", &StaticCallback, _optionA, _paramA),
+	StaticCmd("get-speed", "Benchmark command.", &StaticCallback, _optionA, _paramA),
+	StaticCmd("log", "Benchmark command.", &StaticCallback, _optionA, _paramA),
+	StaticCmd("config", "Benchmark command.", &StaticCallback, _optionA, _paramA),
+};
+
+constexpr StaticCmdTable<NUM_CMDS> _staticCmdTable(_staticCmdA);
+
+//! @brief		Everything that has to exist at runtime for the same commands in an Rx.
+class RuntimeCmds
+{
+	public:
+
+	RuntimeCmds()
+	{
+		for(uint32_t x = 0; x < NUM_CMDS; x++)
+		{
+			this->cmdA[x] = new Cmd(_cmdNameA[x], NULL, "Benchmark command.");
+			this->optionA[x][0] = new Option('v', "verbose", NULL, "Verbose.", false);
+			this->optionA[x][1] = new Option('l', "level", NULL, "The level.", true);
+			this->optionA[x][2] = new Option('a', "all", NULL, "Everything.", false);
+			this->paramA[x][0] = new Param("The first parameter.");
+			this->paramA[x][1] = new Param("The second parameter.");
+			for(uint32_t y = 0; y < 3; y++)
+				this->cmdA[x]->RegisterOption(this->optionA[x][y]);
+			for(uint32_t y = 0; y < 2; y++)
+				this->cmdA[x]->RegisterParam(this->paramA[x][y]);
+			this->rxController.RegisterCmd(this->cmdA[x]);
+		}
+		this->rxController.Freeze();
+	}
+
+	~RuntimeCmds()
+	{
+		for(uint32_t x = 0; x < NUM_CMDS; x++)
+		{
+			delete this->cmdA[x];
+			for(uint32_t y = 0; y < 3; y++)
+				delete this->optionA[x][y];
+			for(uint32_t y = 0; y < 2; y++)
+				delete this->paramA[x][y];
+		}
+	}
+
+	Rx rxController;
+	Cmd* cmdA[NUM_CMDS];
+	Option* optionA[NUM_CMDS][3];
+	Param* paramA[NUM_CMDS][2];
+};
+
+int main()
+{
+	Print::enableCmdLinePrinting = false;
+	Print::enableErrorPrinting = false;
+	Print::enableDebugInfoPrinting = false;
+
+	const uint32_t numStartupIterations = 2000;
+	const uint32_t numRunIterations = 200000;
+
+	// Startup: building (and tearing down) the registry vs. pointing at the table the compiler built
+	MClideBench::Measure("StaticRxBench", "startup/rx", numStartupIterations,
+		[&]() { RuntimeCmds runtimeCmds; });
+
+	MClideBench::Measure("StaticRxBench", "startup/static", numStartupIterations,
+		[&]() { volatile StaticRx staticRx(_staticCmdTable); (void)staticRx; });
+
+	// Memory: the static table is all read-only, the only RAM is the StaticRx object
+	MClideBench::PrintMetric("StaticRxBench", "memory/static", "rom_bytes",
+		(double)(sizeof(_staticCmdA) + sizeof(_staticCmdTable) + sizeof(_optionA) + sizeof(_paramA)));
+	MClideBench::PrintMetric("StaticRxBench", "memory/static", "ram_bytes", (double)sizeof(StaticRx));
+
+	// Run() latency for the same message
+	RuntimeCmds runtimeCmds;
+	StaticRx staticRx(_staticCmdTable);
+	const char* msg = "set-speed -v --level 3 a b";
+
+	MClideBench::Measure("StaticRxBench", "run/rx", numRunIterations,
+		[&]() { runtimeCmds.rxController.Run(msg); });
+
+	MClideBench::Measure("StaticRxBench", "run/static", numRunIterations,
+		[&]() { staticRx.Run(msg); });
+
+	return 0;
+}
+
+// EOF
@@ -0,0 +1,142 @@
+//!
+//! @file 			TypedParamBench.cpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! @created		2026-10-17
+//! @last-modified 	2026-10-17
+//! @brief 			Benchmark of numeric parameters converted by the handler (strtol()/strtod()), by Rx (ValueSpec), and bound with Rx::Bind().
+//! @details
+//!					Run with "make bench". See README.rst in root dir for more info.
+
+//===== SYSTEM LIBRARIES =====//
+#include <stdio.h>
+#include <stdlib.h>
+
+//===== USER SOURCE =====//
+#include "../api/MClideApi.hpp"
+#include "BenchHarness.hpp"
+
+using namespace MbeddedNinja::MClideNs;
+
+static volatile int64_t _sum = 0;
+
+//! @brief		Converts and range checks the parameters itself, like a handler written before typed parameters.
+static bool StringParamsCallback(const ParseResult& result)
+{
+	long speed = strtol(result.GetParam(0), NULL, 0);
+	unsigned long channel = strtoul(result.GetParam(1), NULL, 0);
+	double gain = strtod(result.GetParam(2), NULL);
+	if((speed < 0) || (speed > 5000) || (channel > 15) || (gain < 0.0) || (gain > 10.0))
+		return false;
+
+	_sum += speed + channel + (int64_t)gain;
+	return true;
+}
+
+//! @brief		Reads the parameters Rx has already converted and range checked.
+static bool TypedParamsCallback(const ParseResult& result)
+{
+	_sum += result.GetTypedParam(0)->int32 + result.GetTypedParam(1)->uint32 + (int64_t)result.GetTypedParam(2)->float64;
+	return true;
+}
+
+//! @brief		Bound with Rx::Bind(), takes the converted parameters as arguments.
+static void BoundSet(int32_t speed, uint32_t channel, double gain)
+{
+	_sum += speed + channel + (int64_t)gain;
+}
+
+//! @brief		Times "set 1200 7 2.5" on a frozen Rx, with the parameters converted by the callback and by Rx.
+static void RunTypedParamBench(bool isTyped)
+{
+	const uint32_t numIterations = 200000;
+
+	Rx rxController;
+	Cmd cmdSet("set", NULL, "Sets the speed, channel and gain.");
+	Param paramSpeed("Speed.");
+	Param paramChannel("Channel.");
+	Param paramGain("Gain.");
+	if(isTyped)
+	{
+		paramSpeed.valueSpec = ValueSpec::Int32(0, 5000);
+		paramChannel.valueSpec = ValueSpec::UInt32(0, 15);
+		paramGain.valueSpec = ValueSpec::Double(0.0, 10.0);
+		cmdSet.resultFunctionCallback = &TypedParamsCallback;
+	}
+	else
+		cmdSet.resultFunctionCallback = &StringParamsCallback;
+	cmdSet.RegisterParam(&paramSpeed);
+	cmdSet.RegisterParam(&paramChannel);
+	cmdSet.RegisterParam(&paramGain);
+	rxController.RegisterCmd(&cmdSet);
+	rxController.Freeze();
+
+	MClideBench::Measure("TypedParamBench", isTyped ? "params=3/typed" : "params=3/strtol in callback", numIterations,
+		[&]() { rxController.Run("set 1200 7 2.5"); });
+}
+
+//! @brief		Times "set 1200 7 2.5" on a frozen Rx, with the command bound to BoundSet().
+static void RunBoundParamBench()
+{
+	const uint32_t numIterations = 200000;
+
+	Rx rxController;
+	Cmd* cmdSet = rxController.Bind("set", &BoundSet, "Sets the speed, channel and gain.");
+	cmdSet->paramA[0]->valueSpec = ValueSpec::Int32(0, 5000);
+	cmdSet->paramA[1]->valueSpec = ValueSpec::UInt32(0, 15);
+	cmdSet->paramA[2]->valueSpec = ValueSpec::Double(0.0, 10.0);
+	rxController.Freeze();
+
+	MClideBench::Measure("TypedParamBench", "params=3/bound", numIterations,
+		[&]() { rxController.Run("set 1200 7 2.5"); });
+}
+
+//! @brief		Times converting and range checking "1200", "7" and "2.5" on their own, with strtol()/strtod() and
+//!				with ValueSpec::Convert(). The rest of Run() is the same in both cases above.
+static void RunConvertBench()
+{
+	const uint32_t numIterations = 1000000;
+
+	static const char* volatile speedStr = "1200";
+	static const char* volatile channelStr = "7";
+	static const char* volatile gainStr = "2.5";
+
+	MClideBench::Measure("TypedParamBench", "convert=3/strtol", numIterations,
+		[&]()
+		{
+			long speed = strtol(speedStr, NULL, 0);
+			unsigned long channel = strtoul(channelStr, NULL, 0);
+			double gain = strtod(gainStr, NULL);
+			if((speed >= 0) && (speed <= 5000) && (channel <= 15) && (gain >= 0.0) && (gain <= 10.0))
+				_sum += speed + channel + (int64_t)gain;
+		});
+
+	const ValueSpec speedSpec = ValueSpec::Int32(0, 5000);
+	const ValueSpec channelSpec = ValueSpec::UInt32(0, 15);
+	const ValueSpec gainSpec = ValueSpec::Double(0.0, 10.0);
+
+	MClideBench::Measure("TypedParamBench", "convert=3/value spec", numIterations,
+		[&]()
+		{
+			Value speed, channel, gain;
+			if((speedSpec.Convert(speedStr, &speed) == ValueSpec::Status::OK) &&
+				(channelSpec.Convert(channelStr, &channel) == ValueSpec::Status::OK) &&
+				(gainSpec.Convert(gainStr, &gain) == ValueSpec::Status::OK))
+				_sum += speed.int32 + channel.uint32 + (int64_t)gain.float64;
+		});
+}
+
+int main()
+{
+	Print::enableCmdLinePrinting = false;
+	Print::enableErrorPrinting = false;
+	Print::enableDebugInfoPrinting = false;
+
+	RunTypedParamBench(false);
+	RunTypedParamBench(true);
+	RunBoundParamBench();
+	RunConvertBench();
+
+	return 0;
+}
+
+// EOF
@@ -2,7 +2,7 @@
 //! @file 			Cmd.hpp
 //! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
 //! @created		2013-03-19
-//! @last-modified 	2014-10-09
+//! @last-modified 	2026-10-17
 //! @brief 			Contains the command object, which can be registered with the RX or TX controller (or both).
 //! @details
 //!					See README.rst in root dir for more info.
@@ -48,6 +48,9 @@ namespace MbeddedNinja
 #include "Option.hpp"		//!< For the Option() object
 #include "Comm.hpp"    		//!< Used for save a reference to the parent comm object in each cmd object.
 #include "CmdGroup.hpp"
+#include "GetOpt.hpp"		//!< For the compiled long option table
+#include "HashIndex.hpp"	//!< For the compiled long option index
+#include "ParseResult.hpp"	//!< Passed to the result callbacks
 
 using namespace MbeddedNinja;
 
@@ -102,6 +105,10 @@ namespace MbeddedNinja
 				//! @brief		Destructor. Deallocates memory.
 				~Cmd();
 
+				//! @brief		Copying is not supported, a command owns its compiled option tables.
+				Cmd(const Cmd&) = delete;
+				Cmd& operator=(const Cmd&) = delete;
+
 				//===============================================================================================//
 				//========================================= PUBLIC METHODS ======================================//
 				//===============================================================================================//
@@ -113,19 +120,47 @@ namespace MbeddedNinja
 
 				//! @brief		Register a option with a cmd.
 				//! @param		option	Option to register.
-				void RegisterOption(Option* option);
+				//! @returns	A handle for reading the option's result in O(1) (see ParseResult::IsDetected()),
+				//!				or an invalid handle if the command's Rx/Tx is frozen.
+				OptionHandle RegisterOption(Option* option);
+
+				//! @brief		Returns the option a handle from RegisterOption() refers to.
+				//! @returns	The option, or nullptr if the handle is invalid or not from this command.
+				Option* GetOption(OptionHandle optionHandle) const;
 
 				//! @brief		Use to find a particular option which has been registered with the command.
+				//! @details	Looked up in shortOptionIndexA, so does not search the options (unless the name is not
+				//!				7-bit ASCII).
 				//! @param		shortOptionName		The short option name to look for.
-				//! @returns	A pointer to the option if it finds a match, otherwise nullptr.
+				//! @returns	A pointer to the option if it finds a match, otherwise nullptr (including for '\0').
 				//! @sa			FindOptionByLongName
-				Option* FindOptionByShortName(char shortOptionName);
+				Option* FindOptionByShortName(char shortOptionName) const;
+
+				//! @brief		Use to find a particular option which has been registered with the command.
+				//! @details	Looked up in longOptionIndex, so does not search the options.
+				//! @param		longOptionName		The null-terminated long option name to look for.
+				//! @returns	A pointer to the option if it finds a match, otherwise nullptr (including for an empty name).
+				//! @sa			FindOptionByShortName
+				Option* FindOptionByLongName(const char* longOptionName) const;
 
 				//! @brief		Use to find a particular option which has been registered with the command.
 				//! @param		longOptionName		The long option name to look for.
 				//! @returns	A pointer to the option if it finds a match, otherwise nullptr.
-				//! @sa			FindOptionByShortName
-				Option* FindOptionByLongName(MString longOptionName);
+				Option* FindOptionByLongName(const MString& longOptionName) const;
+
+				#if(clide_ENABLE_AUTO_HELP == 1)
+					//! @brief		Returns the built-in "-h/--help" option, which every command recognises.
+					//! @details	There is one, shared by every command. It is not in any command's optionA, so it has no
+					//!				OptionHandle and is not returned by FindOptionByShortName() or FindOptionByLongName().
+					//!				The option parsers match it before the registered options.
+					static Option* GetHelpOption();
+
+					//! @brief		The short name of the built-in help option.
+					static const char HELP_SHORT_NAME = 'h';
+
+					//! @brief		The long name of the built-in help option.
+					static const char* const HELP_LONG_NAME;
+				#endif
 
 				//! @brief		Returns the number of options registered to the command which have long option names.
 				//! @returns	Number of options with long options names (i.e. longName != NULL).
@@ -133,14 +168,31 @@ namespace MbeddedNinja
 
 				//! @brief		Adds the command to the provided command group.
 				//! @param		cmdGroup	Pointer to the command group you want the command added to.
+				//! @note		Does nothing if the command is already in this group, or once the command's Rx/Tx is frozen.
 				void AddToGroup(CmdGroup *cmdGroup);
 
+				//! @brief		Returns true if the command is in a group with the same name as cmdGroup.
+				//! @details	Once registered, this is a hash lookup of the group name and a bit test.
+				//! @sa			IsInGroupId()
+				bool IsInGroup(const CmdGroup* cmdGroup) const;
+
+				//! @brief		Returns true if the command is in the group with this ID (see Comm::FindCmdGroupId()).
+				//! @details	A bit test, for checks made on every received command (e.g. access control). Always false
+				//!				for a command that is not registered.
+				bool IsInGroupId(uint32_t cmdGroupId) const;
+
 				//! @brief		Returns the number of command groups that the command belongs to.
 				uint32_t GetNumCmdGroups();
 
 				//! @brief		Returns a specific command group that the command belongs to, based of an index.
 				CmdGroup* GetCmdGroup(uint32_t cmdGroupNum);
 
+				//! @brief		True if command was detected the last time Rx.Run() was called.
+				//! @details	You can use this for basic determination if a command was received,
+				//!				without having to use a callback function.
+				//! @note		Every call to Rx.Run() clears this for ALL commands, without having to visit them.
+				bool IsDetected() const;
+
 				//===============================================================================================//
 				//======================================= PUBLIC VARIABLES ======================================//
 				//===============================================================================================//
@@ -171,11 +223,20 @@ namespace MbeddedNinja
 				//! @brief		Method (member function) callback for when the command is detected.
 				MCallbacks::Callback<void, Cmd*> methodCallback;
 
-				//! @brief		True if command was detected the last time Rx.Run() was called.
-				//! @details	You can use this for basic determination if a command was received,
-				//!				without having to use a callback function.
-				//! @note		This flag is reset for ALL commands every time Rx.Run() is called.
-				bool isDetected;
+				//! @brief		Optional callback function for when the command is detected, which is given what was received.
+				//! @details	Called after functionCallback and methodCallback. Unlike them, it does not need to read
+				//!				IsDetected(), Option::value or Param::value, so it keeps working after the Rx is frozen
+				//!				(see Comm::Freeze()). Assign after constructing the command. NULL by default.
+				bool (*resultFunctionCallback)(const ParseResult& result);
+
+				//! @brief		Method (member function) callback for when the command is detected, which is given what was received.
+				//! @details	Called after resultFunctionCallback.
+				MCallbacks::Callback<void, const ParseResult&> resultMethodCallback;
+
+				//! @brief		The parse generation (see Comm::parseGeneration) of the parent Rx in which this command
+				//!				was last detected. 0 if never detected.
+				//! @details	Written by Rx. Use IsDetected() to read the detection state.
+				uint64_t detectedGeneration;
 				
 				//! @brief		The parent Comm object that this command is registered to. Could either be a
 				//!				Tx or Rx object.
@@ -184,6 +245,46 @@ namespace MbeddedNinja
 				//! @brief		A pointer to an array of pointers to CmdGroup objects, which signify which command groups this command belongs to.
 				MVector<CmdGroup*> cmdGroupA;
 
+				//! @brief		The groups this command is in, as a bitset of the group IDs given out by parentComm (bit
+				//!				cmdGroupId%32 of element cmdGroupId/32).
+				//! @details	Written by the parent Comm object when the command is registered, and by AddToGroup().
+				//!				Use IsInGroup() or IsInGroupId() to read it.
+				MVector<uint32_t> cmdGroupBitsA;
+
+				//! @brief		The position of this command in parentComm->cmdA. Set by Comm::RegisterCmd().
+				uint32_t cmdNum;
+
+				//! @brief		The short option string passed to getopt_long(), e.g. "ha:b".
+				//! @details	Compiled by RegisterOption(), so it is not rebuilt every time the command is received.
+				//!				Sized to fit exactly, so there is no limit on the number of options.
+				char* shortOptionString;
+
+				//! @brief		The long option table passed to getopt_long(), terminated with a zero-element.
+				//! @details	Compiled by RegisterOption(). The val of each entry is LONG_OPTION_VAL_OFFSET plus the
+				//!				index of the option in optionA, except the built-in help option, whose val is
+				//!				HELP_SHORT_NAME.
+				GetOpt::option* longOptionsA;
+
+				//! @brief		Offset added to an option's index in optionA to form the val returned by getopt_long()
+				//!				for a long option. Must be larger than any short option character.
+				static const int LONG_OPTION_VAL_OFFSET = 256;
+
+				//! @brief		Maps a short option character (0-127) to 1 plus the index of the option in optionA, or
+				//!				0 if there is no option with that short name. Used by OptionParser.
+				//! @details	Compiled by RegisterOption(). Has NUM_SHORT_OPTION_INDEXES elements.
+				uint16_t* shortOptionIndexA;
+
+				//! @brief		The number of elements in shortOptionIndexA (one for each 7-bit ASCII character).
+				static const uint32_t NUM_SHORT_OPTION_INDEXES = 128;
+
+				//! @brief		Maps the long name of each option to the index of the option in optionA. Used by OptionParser.
+				//! @details	Compiled by RegisterOption().
+				HashIndex longOptionIndex;
+
+				//! @brief		This command's rendered help (see Comm::PrintHelpForCmd()), null-terminated. NULL until
+				//!				rendered, and thrown away by Comm::InvalidateHelpCache().
+				char* helpText;
+
 				//uint32_t numCmdGroups;
 
 			protected:
@@ -197,9 +298,9 @@ namespace MbeddedNinja
 				//!				depending on whether it is a function or a method.
 				void Init(MString name, MString description);
 
-				#if(clide_ENABLE_AUTO_HELP == 1)
-					Option * help;
-				#endif
+				//! @brief		Rebuilds shortOptionString, longOptionsA, shortOptionIndexA and longOptionIndex from the registered options.
+				//! @details	Called whenever an option is registered.
+				void CompileOptions();
 			
 		};
 
@@ -0,0 +1,223 @@
+//!
+//! @file 			CmdBinding.hpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! @created		2026-10-17
+//! @last-modified 	2026-10-17
+//! @brief 			A command made from a plain function, with a typed parameter for each of its arguments (see Comm::Bind()).
+//! @details
+//!					See README.rst in repo root dir for more info.
+
+#ifndef __cplusplus
+	#error Please build with C++ compiler
+#endif
+
+//===============================================================================================//
+//======================================== HEADER GUARD =========================================//
+//===============================================================================================//
+
+#ifndef MCLIDE_CMD_BINDING_H
+#define MCLIDE_CMD_BINDING_H
+
+//===============================================================================================//
+//==================================== FORWARD DECLARATION ======================================//
+//===============================================================================================//
+
+namespace MbeddedNinja
+{
+	namespace MClideNs
+	{
+		class CmdBinding;
+		class Cmd;
+		class Param;
+	}
+}
+
+//===============================================================================================//
+//========================================== INCLUDES ===========================================//
+//===============================================================================================//
+
+//===== SYSTEM LIBRARIES =====//
+#include <stdint.h>
+
+//===== USER LIBRARIES =====//
+#include "MString/api/MStringApi.hpp"
+#include "MVector/api/MVectorApi.hpp"
+
+//===== USER SOURCE =====//
+#include "ParseResult.hpp"
+#include "ValueSpec.hpp"
+
+namespace MbeddedNinja
+{
+	namespace MClideNs
+	{
+
+		//! @brief		How a function argument of type T is bound to a parameter: the ValueSpec its parameter gets,
+		//!				and how the argument is read back out of the ParseResult.
+		//! @details	Only the specialisations below exist, binding a function with any other argument type is a
+		//!				compile error.
+		template<typename T>
+		struct BindArg
+		{
+			static_assert(sizeof(T) == 0, "Comm::Bind() only supports int32_t, uint32_t, int64_t, double, float, bool and const char* arguments.");
+		};
+
+		template<>
+		struct BindArg<int32_t>
+		{
+			static ValueSpec GetValueSpec() { return ValueSpec::Int32(); }
+			static int32_t Get(const ParseResult& result, uint32_t paramNum) { return result.GetTypedParam(paramNum)->int32; }
+		};
+
+		template<>
+		struct BindArg<uint32_t>
+		{
+			static ValueSpec GetValueSpec() { return ValueSpec::UInt32(); }
+			static uint32_t Get(const ParseResult& result, uint32_t paramNum) { return result.GetTypedParam(paramNum)->uint32; }
+		};
+
+		template<>
+		struct BindArg<int64_t>
+		{
+			static ValueSpec GetValueSpec() { return ValueSpec::Int64(); }
+			static int64_t Get(const ParseResult& result, uint32_t paramNum) { return result.GetTypedParam(paramNum)->int64; }
+		};
+
+		template<>
+		struct BindArg<double>
+		{
+			static ValueSpec GetValueSpec() { return ValueSpec::Double(); }
+			static double Get(const ParseResult& result, uint32_t paramNum) { return result.GetTypedParam(paramNum)->float64; }
+		};
+
+		template<>
+		struct BindArg<float>
+		{
+			static ValueSpec GetValueSpec() { return ValueSpec::Double(); }
+			static float Get(const ParseResult& result, uint32_t paramNum) { return (float)result.GetTypedParam(paramNum)->float64; }
+		};
+
+		template<>
+		struct BindArg<bool>
+		{
+			static ValueSpec GetValueSpec() { return ValueSpec::Bool(); }
+			static bool Get(const ParseResult& result, uint32_t paramNum) { return result.GetTypedParam(paramNum)->boolean; }
+		};
+
+		//! @brief		Not converted. Only valid until the function returns, like ParseResult::GetParam().
+		template<>
+		struct BindArg<const char*>
+		{
+			static ValueSpec GetValueSpec() { return ValueSpec(); }
+			static const char* Get(const ParseResult& result, uint32_t paramNum) { return result.GetParam(paramNum); }
+		};
+
+		//! @brief		A list of argument positions, 0 to N - 1, used to expand a function's arguments
+		//!				(std::index_sequence is C++14).
+		template<uint32_t... paramNums>
+		struct BindParamNums {};
+
+		template<uint32_t numParams, uint32_t... paramNums>
+		struct MakeBindParamNums : MakeBindParamNums<numParams - 1, numParams - 1, paramNums...> {};
+
+		template<uint32_t... paramNums>
+		struct MakeBindParamNums<0, paramNums...>
+		{
+			typedef BindParamNums<paramNums...> Type;
+		};
+
+		//! @brief		Owns the command (and its parameters) created by Comm::Bind().
+		//! @details	The parts that don't depend on the function's type, so they are compiled once.
+		class CmdBinding
+		{
+
+			public:
+
+				//===============================================================================================//
+				//==================================== CONSTRUCTORS/DESTRUCTOR ==================================//
+				//===============================================================================================//
+
+				//! @brief		Constructor. The command is created by Init().
+				CmdBinding();
+
+				//! @brief		Destructor. Deletes the command and its parameters.
+				virtual ~CmdBinding();
+
+				CmdBinding(const CmdBinding&) = delete;
+				CmdBinding& operator=(const CmdBinding&) = delete;
+
+				//===============================================================================================//
+				//======================================= PUBLIC METHODS ========================================//
+				//===============================================================================================//
+
+				//! @brief		Creates the command, with one parameter for each ValueSpec, and points its
+				//!				Cmd::resultMethodCallback at Call().
+				//! @param		valueSpecA		The spec of each parameter, in argument order.
+				void Init(MString name, MString description, const ValueSpec* valueSpecA, uint32_t numParams);
+
+				//===============================================================================================//
+				//======================================= PUBLIC VARIABLES ======================================//
+				//===============================================================================================//
+
+				//! @brief		The command, created by Init().
+				Cmd* cmd;
+
+				//! @brief		The command's parameters, one for each of the function's arguments.
+				MVector<Param*> paramA;
+
+			protected:
+
+				//! @brief		Calls the function with the arguments decoded from result.
+				//! @details	Only called once Rx has converted (and range checked) every parameter.
+				virtual void Call(const ParseResult& result) = 0;
+
+			private:
+
+				//! @brief		The target of Cmd::resultMethodCallback.
+				void Invoke(const ParseResult& result);
+
+		};
+
+		//! @brief		A CmdBinding for a function with the signature R (*)(Args...).
+		//! @details	The argument types are known at compile time, so Call() reads each one straight out of the
+		//!				converted parameters, without looking at its ValueSpec or the parameter string.
+		template<typename R, typename... Args>
+		class CmdBindingFunction : public CmdBinding
+		{
+
+			public:
+
+				//! @brief		Constructor.
+				CmdBindingFunction(R (*function)(Args...))
+				{
+					this->function = function;
+				}
+
+			protected:
+
+				void Call(const ParseResult& result) override
+				{
+					this->CallWithParams(result, typename MakeBindParamNums<sizeof...(Args)>::Type());
+				}
+
+			private:
+
+				template<uint32_t... paramNums>
+				void CallWithParams(const ParseResult& result, BindParamNums<paramNums...>)
+				{
+					// Silences an unused variable warning for functions with no arguments
+					(void)result;
+					this->function(BindArg<Args>::Get(result, paramNums)...);
+				}
+
+				//! @brief		The bound function. Its return value is ignored.
+				R (*function)(Args...);
+
+		};
+
+	} // namespace MClide
+} // namespace MbeddedNinja
+
+#endif	// #ifndef MCLIDE_CMD_BINDING_H
+
+// EOF
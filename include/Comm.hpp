@@ -2,7 +2,7 @@
 //! @file 			Comm.cpp
 //! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
 //! @created		2013-12-18
-//! @last-modified 	2014-10-09
+//! @last-modified 	2026-10-17
 //! @brief			The base communications class. This is extended by both Clide::Tx and Clide::Rx which are the classes manipulated by the user.
 //! @details
 //!					See README.rst in repo root dir for more info.
@@ -47,8 +47,13 @@ namespace MbeddedNinja
 
 //===== USER SOURCE =====//
 #include "Config.hpp"
+#include "CommConfig.hpp"
 #include "Cmd.hpp"
+#include "CmdBinding.hpp"
 #include "CmdGroup.hpp"
+#include "HashIndex.hpp"
+#include "ParseResult.hpp"
+#include "PrintSink.hpp"
 
 //===============================================================================================//
 //======================================== NAMESPACE ============================================//
@@ -66,6 +71,10 @@ namespace MbeddedNinja
 		//! @note		Threadsafe, re-entrant
 		bool HelpCmdCallback(Cmd *cmd);
 
+		//! @brief		Result callback function for the help command, used by the help command Rx registers.
+		//! @details	Reads the help options from the ParseResult, so it works when the Rx is frozen.
+		bool HelpCmdResultCallback(const ParseResult& result);
+
 		//! @brief The base communications class. This is extended by both Clide::Tx and Clide::Rx which are the classes manipulated by the user.
 		class Comm
 		{
@@ -79,6 +88,22 @@ namespace MbeddedNinja
 				//! @details	This is updated everytime RegisterCmd() is called
 				MVector<Cmd*> cmdA;
 
+				//! @brief		Index from command name to the position of the command in cmdA.
+				//! @details	Updated everytime RegisterCmd() is called, and used by Rx to find a received
+				//!				command without comparing it against every registered name.
+				HashIndex cmdIndex;
+
+				//! @brief		Index of every prefix of every registered command name (e.g. "h", "he", "hel", "help").
+				//! @details	Empty until EnableCmdPrefixIndex() is called, since it takes more memory than cmdIndex.
+				HashIndex cmdPrefixIndex;
+
+				//! @brief		Incremented at the start of every Rx::Run() call.
+				//! @details	A command or option is "detected" when it has been stamped with the current value of this
+				//!				counter, so detection flags never have to be reset (resetting is free regardless of the
+				//!				number of registered commands). 0 is never a valid generation. 64 bits, so it does
+				//!				not wrap around in practice (Rx clears every stamp if it does).
+				uint64_t parseGeneration;
+
 				//! @brief		The number of registered commands
 				//! @details	Incremented everytime RegisterCmd() is called
 				//uint8_t numCmds;
@@ -98,6 +123,14 @@ namespace MbeddedNinja
 				//! @details
 				MCallbacks::Callback<void, char*> generalHelpRequestedCallback;
 
+				//! @brief		Settings for this object only, default to the values in Config.hpp.
+				CommConfig config;
+
+				//! @brief		Where this object's debug, command-line (responses and help) and error output goes.
+				//! @details	Falls back to Print until its callbacks are assigned. Command callbacks can reply through
+				//!				cmd->parentComm->printSink.
+				PrintSink printSink;
+
 				//===============================================================================================//
 				//======================================= PUBLIC METHODS ========================================//
 				//===============================================================================================//
@@ -106,20 +139,95 @@ namespace MbeddedNinja
 				~Comm();
 
 				//! @brief 		Prints out the help info.
+				//! @details	Reads the options of the help command from its IsDetected() and value fields.
 				void PrintHelp(Cmd* cmd);
 
+				//! @brief 		Prints out the help info.
+				//! @details	Reads the options of the help command from result.
+				void PrintHelp(const ParseResult& result);
+
 				void PrintHelpForCmd(Cmd* cmd);
 
 				//! @brief		Register a command with Clide.
 				//! @warning	Command must persist in memory while Rx object is used.
 				void RegisterCmd(Cmd* cmd);
 
+				//! @brief		Creates and registers a command that calls a plain function, with one typed parameter for
+				//!				each of the function's arguments (e.g. "void SetSpeed(int32_t rpm, bool ramp)" gets an
+				//!				int32 parameter and a bool parameter).
+				//! @details	Supported argument types are int32_t, uint32_t, int64_t, double, float, bool and
+				//!				const char* (not converted). Rx converts and checks every parameter before the function
+				//!				is called, and rejects the command with an error response if one is not valid. Narrow
+				//!				the range of a parameter through its valueSpec (e.g. cmd->paramA[0]->valueSpec) before
+				//!				freezing. The command and its parameters are owned (and deleted) by this object.
+				//! @param		function		Called with the decoded parameters. Its return value is ignored.
+				//! @returns	The command, or NULL if this object is frozen.
+				template<typename R, typename... Args>
+				Cmd* Bind(MString name, R (*function)(Args...), MString description)
+				{
+					// One extra, so a function with no arguments doesn't need a zero-length array
+					const ValueSpec valueSpecA[sizeof...(Args) + 1] = { BindArg<Args>::GetValueSpec()..., ValueSpec() };
+					return this->RegisterCmdBinding(new CmdBindingFunction<R, Args...>(function), name, description,
+							valueSpecA, sizeof...(Args));
+				}
+
 				//! @brief		Removes a previously registered command.
 				//! @details	Uses free().
 				//! @param		cmd		The command to de-register.
 				//! @warning	Make sure command was previously registered with Clide::Rx
 				void RemoveCmd(Cmd* cmd);
 
+				//! @brief		Makes the registered commands, options and parameters read-only.
+				//! @details	After this, commands, options and parameters can't be registered, and Rx::Run() no longer
+				//!				writes to them (Cmd::IsDetected(), Option::IsDetected(), Option::value and Param::value
+				//!				stop being updated). Use Cmd::resultFunctionCallback or Cmd::resultMethodCallback to
+				//!				get what was received instead. The same Rx can then be run from multiple threads at once,
+				//!				as long as Rx::parseArena is not shared and printSink has no buffer (see
+				//!				PrintSink::SetBuffer()), since both are written to by every Rx::Run().
+				//! @note		Can't be undone.
+				void Freeze();
+
+				//! @brief		Returns true if Freeze() has been called.
+				bool IsFrozen() const;
+
+				//! @brief		Builds cmdPrefixIndex, and keeps it up to date as more commands are registered.
+				//! @details	Called by RxBuff::SetEarlyRejection(). Does nothing if it has already been called.
+				void EnableCmdPrefixIndex();
+
+				//! @brief		Returns true if prefix is the start of (or the whole of) a registered command name.
+				//! @param		prefix			Does not need to be null-terminated.
+				//! @param		prefixLen		The number of characters in prefix.
+				//! @param		prefixHash		HashIndex::Hash() of prefix.
+				//! @returns	true if it is, or if EnableCmdPrefixIndex() has not been called (so it can't be ruled out).
+				bool IsCmdPrefix(const char* prefix, uint32_t prefixLen, uint32_t prefixHash) const;
+
+				//! @brief		Returns the ID this object has given to a command group name, for Cmd::IsInGroupId().
+				//! @details	Group names are given small integer IDs as commands are added to them, starting with
+				//!				0 for "all" (see cmdGroupAll).
+				//! @returns	The ID, or HashIndex::NOT_FOUND if no registered command has been in a group with this name.
+				uint32_t FindCmdGroupId(const char* groupName) const;
+
+				//! @brief		Returns the number of registered commands in a group.
+				//! @param		cmdGroupId		From FindCmdGroupId().
+				uint32_t GetNumCmdsInGroup(uint32_t cmdGroupId) const;
+
+				//! @brief		Returns one of the registered commands in a group, in the order they were registered.
+				//! @param		cmdGroupId		From FindCmdGroupId().
+				//! @param		cmdInGroupNum	From 0 to GetNumCmdsInGroup() - 1.
+				Cmd* GetCmdInGroup(uint32_t cmdGroupId, uint32_t cmdInGroupNum) const;
+
+				//! @brief		Records that a registered command is in a group. Called by RegisterCmd() and Cmd::AddToGroup().
+				//! @details	Gives the group's name an ID if it doesn't have one, and sets the command's bit for it.
+				void AddCmdToGroupIndex(Cmd* cmd, CmdGroup* cmdGroup);
+
+				//! @brief		Throws away all cached help text (see PrintHelp() and PrintHelpForCmd()).
+				//! @details	Help is rendered the first time it is asked for, and printed from the cache after that.
+				//!				Called by RegisterCmd(), Cmd::AddToGroup(), Cmd::RegisterOption() and Cmd::RegisterParam(),
+				//!				and when config changes. Call it after changing a registered command's name or description.
+				//!				Once frozen, the cache is read-only (it is not filled or thrown away), so the same Rx can
+				//!				still be run from multiple threads. Freeze() renders the default help listing first.
+				void InvalidateHelpCache();
+
 
 			//===============================================================================================//
 			//==================================== PROTECTED METHODS ========================================//
@@ -130,6 +238,90 @@ namespace MbeddedNinja
 			//! @brief 		Constructor.
 			Comm();
 
+			//! @brief		Prints the list of commands in a group, from the help cache if possible. Shared by both
+			//!				PrintHelp() methods.
+			void PrintCmdList(const char* selectedGroup, bool printHeader);
+
+			//! @brief		Renders the list of commands in a group, a fragment at a time.
+			void RenderCmdList(const char* selectedGroup, bool printHeader);
+
+			//! @brief		Returns the rendered list of commands in a group from the help cache, rendering it first if it
+			//!				is not there.
+			//! @returns	NULL if it can't be cached (frozen and not already cached, or no commands are in the group).
+			const char* GetCmdListHelpText(const char* selectedGroup, bool printHeader);
+
+			//! @brief		Returns true if any registered command is in the named group.
+			bool IsGroupInUse(const char* groupName) const;
+
+			//! @brief		The registered commands in one group.
+			struct CmdGroupMembers
+			{
+				//! @brief		A copy of the group name, the key in cmdGroupIndex.
+				MString name;
+				//! @brief		The positions of the commands in cmdA, in ascending order.
+				MVector<uint32_t> cmdNumA;
+			};
+
+			//! @brief		Index from command group name to its ID, the position of its members in cmdGroupMembersA.
+			HashIndex cmdGroupIndex;
+
+			//! @brief		The commands in each group, indexed by group ID.
+			MVector<CmdGroupMembers*> cmdGroupMembersA;
+
+			//! @brief		Returns the ID of a group name, giving it the next one if it doesn't have one yet.
+			uint32_t InternCmdGroup(const char* groupName);
+
+			//! @brief		Renders the help for one command, a fragment at a time.
+			void RenderHelpForCmd(Cmd* cmd);
+
+			//! @brief		Returns true if the help cache can be used with the current config. Throws the cache away
+			//!				if config has changed (unless frozen, in which case the cache is not used).
+			bool IsHelpCacheUsable();
+
+			//! @brief		A rendered list of commands in a group.
+			struct CmdListHelp
+			{
+				MString groupName;
+				bool printHeader;
+				//! @brief		Null-terminated, allocated with new[].
+				char* text;
+			};
+
+			//! @brief		Rendered lists of commands, one for each group (and header setting) asked for.
+			MVector<CmdListHelp*> cmdListHelpCacheA;
+
+			//! @brief		The number of registered commands with help text in Cmd::helpText.
+			uint32_t numCmdHelpTextsCached;
+
+			//! @brief		The config the cached help was rendered with.
+			CommConfig helpCacheConfig;
+
+			//! @brief		Returns clide_TERM_TEXT_FORMAT_BOLD, or "" if config.enableAdvTextFormatting is false.
+			const char* TextFormatBold() const;
+
+			//! @brief		Returns clide_TERM_TEXT_FORMAT_NORMAL, or "" if config.enableAdvTextFormatting is false.
+			const char* TextFormatNormal() const;
+
+			//! @brief		Returns clide_TABLE_HEADER_ROW_COLOUR_CODE, or "" if config.enableAdvTextFormatting is false.
+			const char* TextFormatTableHeaderRow() const;
+
+			//! @brief		The non-template part of Bind(). Creates the binding's command and registers it, or deletes the
+			//!				binding if this object is frozen.
+			Cmd* RegisterCmdBinding(CmdBinding* cmdBinding, MString name, MString description,
+					const ValueSpec* valueSpecA, uint32_t numParams);
+
+			//! @brief		The commands created by Bind(), deleted by the destructor.
+			MVector<CmdBinding*> cmdBindingA;
+
+			//! @brief		Set by Freeze().
+			bool isFrozen;
+
+			//! @brief		Set by EnableCmdPrefixIndex().
+			bool cmdPrefixIndexEnabled;
+
+			//! @brief		Adds every prefix of the command's name to cmdPrefixIndex.
+			void AddToCmdPrefixIndex(Cmd* cmd);
+
 		};
 	} // namespace MClide
 } // namespace MbeddedNinja
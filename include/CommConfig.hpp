@@ -0,0 +1,86 @@
+//!
+//! @file 			CommConfig.hpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! @created		2026-10-16
+//! @last-modified 	2026-10-16
+//! @brief 			Per-object settings of an Rx or Tx object, which default to the values in Config.hpp.
+//! @details
+//!					See README.rst in repo root dir for more info.
+
+#ifndef __cplusplus
+	#error Please build with C++ compiler
+#endif
+
+//===============================================================================================//
+//======================================== HEADER GUARD =========================================//
+//===============================================================================================//
+
+#ifndef MCLIDE_COMM_CONFIG_H
+#define MCLIDE_COMM_CONFIG_H
+
+//===============================================================================================//
+//==================================== FORWARD DECLARATION ======================================//
+//===============================================================================================//
+
+namespace MbeddedNinja
+{
+	namespace MClideNs
+	{
+		struct CommConfig;
+	}
+}
+
+//===============================================================================================//
+//========================================== INCLUDES ===========================================//
+//===============================================================================================//
+
+//===== SYSTEM LIBRARIES =====//
+#include <stdint.h>
+
+//===== USER SOURCE =====//
+#include "Config.hpp"
+
+namespace MbeddedNinja
+{
+	namespace MClideNs
+	{
+
+		//! @brief		Settings that used to be shared by every Rx and Tx object through Config.hpp.
+		//! @details	Each Rx and Tx object has its own copy in Comm::config, so e.g. a console and a machine-to-machine
+		//!				port in the same program can format their output differently. Settings that remove code
+		//!				(clide_ENABLE_DEBUG_CODE, clide_ENABLE_AUTO_HELP e.t.c.) stay in Config.hpp.
+		struct CommConfig
+		{
+			//! @brief		Constructor. Every setting starts at its default in Config.hpp.
+			CommConfig() :
+				enableAdvTextFormatting(clide_ENABLE_ADV_TEXT_FORMATTING == 1),
+				paddingBeforeCmdInHelp(config_PADDING_BEFORE_CMD_IN_HELP),
+				cmdPaddingForHelp(config_CMD_PADDING_FOR_HELP)
+			{
+			}
+
+			//! @brief		Set to true to format output text (bold, colours) with ANSI escape codes. Set to false for terminals
+			//!				(or programs) that don't understand them.
+			bool enableAdvTextFormatting;
+
+			//! @brief		The amount of padding before the cmd column when printing help.
+			uint8_t paddingBeforeCmdInHelp;
+
+			//! @brief		The width of the command name column when printing help. Longer names are truncated.
+			uint8_t cmdPaddingForHelp;
+
+			//! @brief		Used to tell if cached help was rendered with different settings.
+			bool operator==(const CommConfig& other) const
+			{
+				return (this->enableAdvTextFormatting == other.enableAdvTextFormatting)
+					&& (this->paddingBeforeCmdInHelp == other.paddingBeforeCmdInHelp)
+					&& (this->cmdPaddingForHelp == other.cmdPaddingForHelp);
+			}
+		};
+
+	} // namespace MClide
+} // namespace MbeddedNinja
+
+#endif	// #ifndef MCLIDE_COMM_CONFIG_H
+
+// EOF
@@ -2,7 +2,7 @@
 //! @file 			Config.hpp
 //! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
 //! @created		2013-04-02
-//! @last-modified 	2014-10-07
+//! @last-modified 	2026-10-17
 //! @brief 			Configuration file for MClide.
 //! @details
 //!				See README.rst in repo root dir for more info.
@@ -22,7 +22,10 @@
 //=============== DEBUG SWITCHES ============//
 
 //! @brief		Set to 1 to enable debug code (including debug message printing) through-out the Clide library. Set to 0 to disable all debug code, which will save memory.
-#define clide_ENABLE_DEBUG_CODE			1
+//! @details	Can be overridden from the compiler command line (e.g. -Dclide_ENABLE_DEBUG_CODE=0), the benchmarks do this.
+#ifndef clide_ENABLE_DEBUG_CODE
+	#define clide_ENABLE_DEBUG_CODE			1
+#endif
 
 //=============== CALLBACK SWITCHES ============//
 
@@ -35,12 +38,13 @@
 //! @brief		Set to 1 to enable automatic help generation.
 #define clide_ENABLE_AUTO_HELP					1
 
-//! @brief		(char*) The amount of padding before the cmd column when printing help.
+//! @brief		(uint8_t) The default amount of padding before the cmd column when printing help.
+//! @details	Can be changed for each Rx object with CommConfig::paddingBeforeCmdInHelp.
 #define config_PADDING_BEFORE_CMD_IN_HELP 		5
 
-//! @brief		(char*) The amount of padding given to the command name column when printing help.
+//! @brief		(uint8_t) The default amount of padding given to the command name column when printing help.
+//! @details	Can be changed for each Rx object with CommConfig::cmdPaddingForHelp.
 #define config_CMD_PADDING_FOR_HELP				15
-#define config_CMD_PADDING_FOR_HELP_MINUS_1		14			//!< Make sure this is always (config_CMD_PADDING_FOR_HELP - 1)
 
 //! @brief		(char*) The name of the option which prevents the help header from being printed when the help command is called.
 #define config_NO_HELP_HEADER_OPTION_NAME		"no-header"
@@ -49,25 +53,58 @@
 //! @details	All writes use snprintf() so should be safe if too small.
 #define clide_DEBUG_BUFF_SIZE				(200u)
 
-//! @brief		Set to 1 to enable advanced output text formatting using special ASCII codes.
-//! @details	Tested with the bash shell.
+//! @brief		Set to 1 to enable advanced output text formatting using special ASCII codes by default.
+//! @details	Tested with the bash shell. Can be changed for each Rx object with CommConfig::enableAdvTextFormatting.
 #define clide_ENABLE_ADV_TEXT_FORMATTING		(1u)
 
-#if clide_ENABLE_ADV_TEXT_FORMATTING == 1
-	#define clide_TERM_TEXT_FORMAT_NORMAL 	"\x1B[0m"		//!< Returns text to normal formatting. Widely supported.
-	#define clide_TERM_TEXT_FORMAT_BOLD 	"\x1B[1m"		//!< Bold text. Widely supported.
-	#define clide_TERM_TEXT_FORMAT_ITALIC	"\x1B[3m"		//!< Italic text. Not supported by many terminals.
-	#define clide_TERM_COLOUR_YELLOW 		("\x1B[33;1m")	//!< Yellow text. Widely supported.
+// Always defined, CommConfig::enableAdvTextFormatting decides whether they are printed
+#define clide_TERM_TEXT_FORMAT_NORMAL 	"\x1B[0m"		//!< Returns text to normal formatting. Widely supported.
+#define clide_TERM_TEXT_FORMAT_BOLD 	"\x1B[1m"		//!< Bold text. Widely supported.
+#define clide_TERM_TEXT_FORMAT_ITALIC	"\x1B[3m"		//!< Italic text. Not supported by many terminals.
+#define clide_TERM_COLOUR_YELLOW 		("\x1B[33;1m")	//!< Yellow text. Widely supported.
 
-	//! @brief		Defines the colour to be used for the header rows of help information.
-	//! @details	Use one of the colour macros above. Only applicable if #clide_ENABLE_ADV_TEXT_FORMATTING is 1.
-	#define clide_TABLE_HEADER_ROW_COLOUR_CODE clide_TERM_COLOUR_YELLOW
-#endif
+//! @brief		Defines the colour to be used for the header rows of help information.
+//! @details	Use one of the colour macros above. Only applicable if CommConfig::enableAdvTextFormatting is true.
+#define clide_TABLE_HEADER_ROW_COLOUR_CODE clide_TERM_COLOUR_YELLOW
+
+//=================== Rx Config =================//
+
+//! @brief		(uint32_t) The number of arguments (including the command name) that Rx can hold on the stack.
+//! @details	Messages with more arguments still work, the extra room comes from Rx::parseArena (or the heap if
+//!				no arena is assigned or it is full).
+#define clide_NUM_INLINE_ARGS				(10u)
+
+//! @brief		(uint32_t) The number of options (including the help option) a command can have before the
+//!				ParseResult for it uses Rx::parseArena (or the heap) instead of the stack.
+#define clide_NUM_INLINE_OPTIONS			(8u)
+
+//! @brief		(uint32_t) The number of parameters a command can have before the ParseResult for it stores their
+//!				converted values (see Param::valueSpec) in Rx::parseArena (or the heap) instead of on the stack.
+#define clide_NUM_INLINE_PARAMS				(8u)
+
+//! @brief		(uint32_t) Size of the stack buffer that Rx copies the arguments of a recognised command into.
+//! @details	Longer messages use Rx::parseArena (or the heap) instead.
+#define clide_ARG_BUFF_SIZE					(256u)
 
 //=================== RxBuff Config =================//
 
-//! @brief		(uint32_t) Size of the fixed-width buffer that the RxBuff class uses to store characters when RxBuff::Write() is called.
+//! @brief		(uint32_t) Size of the buffer that the RxBuff class uses to store a partial command between writes,
+//!				when it is not given a buffer in its constructor (see also StaticRxBuff).
+//! @details	Also the longest command RxBuff accepts, longer commands are truncated.
 #define clide_RX_BUFF_SIZE					(256u)
+
+//=================== IoDriver Config =================//
+
+//! @brief		(uint32_t) The most characters IoDriver reads from a channel each time it is readable. Read into a
+//!				stack buffer of this size.
+#define clide_IO_DRIVER_READ_SIZE			(4096u)
+
+//! @brief		(uint32_t) Size of the buffer IoDriver collects a channel's response in before writing it to the channel.
+#define clide_IO_DRIVER_WRITE_BUFF_SIZE		(4096u)
+
+//! @brief		(int) How long IoDriver waits for room to write a response to a channel, in milliseconds. If the channel's
+//!				file descriptor stays full for this long, the rest of the response is dropped and the channel is closed.
+#define clide_IO_DRIVER_WRITE_TIMEOUT_MS	(1000)
 		
 
 #endif	// #ifndef MCLIDE_CONFIG_H
@@ -2,7 +2,7 @@
 //! @file 			GetOpt.hpp
 //! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
 //! @created		2013-03-19
-//! @last-modified 	2014-10-07
+//! @last-modified 	2026-10-17
 //! @brief 			Header file for the getopt() function.
 //! @details
 //!					See README.rst in repo root dir for more info.
@@ -50,7 +50,9 @@ namespace MbeddedNinja
 //========================================== INCLUDES ===========================================//
 //===============================================================================================//
 
-// none
+//===== USER SOURCE =====//
+#include "Config.hpp"		//!< clide_ENABLE_DEBUG_CODE, clide_DEBUG_BUFF_SIZE
+#include "PrintSink.hpp"	//!< Debug and error messages
 
 namespace MbeddedNinja
 {
@@ -165,8 +167,6 @@ namespace MbeddedNinja
 					const struct option *__longopts,
 					int *__longind);
 
-			private:
-			
 				// Data type for reentrant functions.
 				typedef struct
 				{
@@ -238,9 +238,42 @@ namespace MbeddedNinja
 					int __first_nonopt;
 					int __last_nonopt;
 
+					#if(clide_ENABLE_DEBUG_CODE == 1)
+						//! @brief		Buffer for building debug messages, so that parsing with one
+						//!				_getopt_data does not share a buffer with any other.
+						char debugBuff[clide_DEBUG_BUFF_SIZE];
+
+						//! @brief		Where debug and error messages are printed to. If NULL, they
+						//!				are printed with the static Print.
+						const PrintSink* printSink;
+					#endif
+
 				} _getopt_data;
 
+				//! @brief		Reentrant version of getopt_long().
+				//! @details	All parsing state (optind, optarg, optopt e.t.c) is kept in the provided
+				//!				_getopt_data instead of the static variables, so multiple argument vectors
+				//!				can be parsed at the same time (e.g. from different threads). Set
+				//!				__data->optind to 0 (and __data->__initialized to 0) before the first call.
+				static int getopt_long_r(
+					int ___argc,
+					char *const *___argv,
+					const char *__shortopts,
+					const struct option *__longopts,
+					int *__longind,
+					_getopt_data *__data);
+
+			private:
+
 				static _getopt_data getopt_data;
+
+				#if(clide_ENABLE_DEBUG_CODE == 1)
+					//! @brief		Prints a debug message to d->printSink (or Print if d->printSink is NULL).
+					static void PrintDebugInfo(_getopt_data *d, const char* msg, Print::DebugPrintingLevel debugPrintingLevel);
+
+					//! @brief		Prints an error message to d->printSink (or Print if d->printSink is NULL).
+					static void PrintError(_getopt_data *d, const char* msg);
+				#endif
 				
 				static void exchange(char **argv, GetOpt::_getopt_data *d);
 				
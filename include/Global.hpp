@@ -54,8 +54,7 @@ namespace MbeddedNinja
 				//======================================= PUBLIC VARIABLES ======================================//
 				//===============================================================================================//
 			
-				//! @brief		Debug buffer for use for creating debug messages from all functions.
-				static char debugBuff[clide_DEBUG_BUFF_SIZE];
+				// none
 		};
 
 
@@ -0,0 +1,161 @@
+//!
+//! @file 			HashIndex.hpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! @created		2026-10-16
+//! @last-modified 	2026-10-17
+//! @brief 			An open-addressing hash index which maps name strings to integer values (e.g. command indexes).
+//! @details
+//!					See README.rst in repo root dir for more info.
+
+#ifndef __cplusplus
+	#error Please build with C++ compiler
+#endif
+
+//===============================================================================================//
+//======================================== HEADER GUARD =========================================//
+//===============================================================================================//
+
+#ifndef MCLIDE_HASH_INDEX_H
+#define MCLIDE_HASH_INDEX_H
+
+//===============================================================================================//
+//==================================== FORWARD DECLARATION ======================================//
+//===============================================================================================//
+
+namespace MbeddedNinja
+{
+	namespace MClideNs
+	{
+		class HashIndex;
+	}
+}
+
+//===============================================================================================//
+//========================================== INCLUDES ===========================================//
+//===============================================================================================//
+
+//===== SYSTEM LIBRARIES =====//
+#include <stdint.h>
+
+namespace MbeddedNinja
+{
+	namespace MClideNs
+	{
+
+		//! @brief		Maps name strings (e.g. command names) to integer values using open addressing with linear probing.
+		//! @details	The index does not copy the keys, it only remembers a pointer to them, so the key memory must persist
+		//!				for as long as it is in the index (the name of a registered command does). The key length is
+		//!				stored alongside the key, so keys do not have to be null-terminated, and lookups never call strlen().
+		//!				Memory is only allocated when inserting, never when finding.
+		class HashIndex
+		{
+
+			public:
+
+				//===============================================================================================//
+				//==================================== CONSTRUCTORS/DESTRUCTOR ==================================//
+				//===============================================================================================//
+
+				//! @brief		Constructor. Creates an empty index, no memory is allocated until the first insert.
+				HashIndex();
+
+				//! @brief		Destructor. Frees the slot array.
+				~HashIndex();
+
+				//! @brief		Copying is not supported, the index owns its slot array.
+				HashIndex(const HashIndex&) = delete;
+				HashIndex& operator=(const HashIndex&) = delete;
+
+				//===============================================================================================//
+				//========================================= PUBLIC METHODS ======================================//
+				//===============================================================================================//
+
+				//! @brief		Computes the hash of a key (32-bit FNV-1a).
+				//! @param		key			Pointer to the first character of the key. Does not need to be null-terminated.
+				//! @param		keyLen		The number of characters in the key.
+				static uint32_t Hash(const char* key, uint32_t keyLen);
+
+				//! @brief		Adds one more character to a hash, so a key can be hashed as it arrives.
+				//! @details	Start with HASH_SEED. HashStep() over every character of a key gives Hash(key, keyLen).
+				static inline uint32_t HashStep(uint32_t hash, char c)
+				{
+					return (hash ^ (uint8_t)c)*16777619u;
+				}
+
+				//! @brief		Hash() of a null-terminated key, worked out by the compiler if the key is a constant
+				//!				(e.g. for the names in a StaticCmdTable).
+				//! @param		hash		The hash of the characters before key, leave as the default.
+				static constexpr uint32_t ConstHash(const char* key, uint32_t hash = HASH_SEED)
+				{
+					return ((key == nullptr) || (*key == '\0')) ? hash : ConstHash(key + 1, (hash ^ (uint8_t)*key)*16777619u);
+				}
+
+				//! @brief		Inserts a key into the index.
+				//! @details	If the key is already present, the existing value is kept (so the first registered
+				//!				name wins, the same as a linear search from the start would).
+				//! @returns	true if the key was inserted, false if it was already present.
+				bool Insert(const char* key, uint32_t keyLen, uint32_t value);
+
+				//! @brief		Looks up a key.
+				//! @returns	The value associated with the key, or HashIndex::NOT_FOUND.
+				uint32_t Find(const char* key, uint32_t keyLen) const;
+
+				//! @brief		Looks up a key whose hash has already been worked out (e.g. with HashStep()).
+				//! @returns	The value associated with the key, or HashIndex::NOT_FOUND.
+				uint32_t Find(const char* key, uint32_t keyLen, uint32_t hash) const;
+
+				//! @brief		Removes all keys from the index. Does not free the slot array.
+				void Clear();
+
+				//! @brief		Returns the number of keys stored in the index.
+				uint32_t Size() const;
+
+				//===============================================================================================//
+				//======================================= PUBLIC VARIABLES ======================================//
+				//===============================================================================================//
+
+				//! @brief		Returned by Find() when the key is not in the index.
+				static const uint32_t NOT_FOUND = 0xFFFFFFFFu;
+
+				//! @brief		The hash of an empty key, the starting value for HashStep().
+				static const uint32_t HASH_SEED = 2166136261u;
+
+			private:
+
+				//===============================================================================================//
+				//================================== PRIVATE VARIABLES/STRUCTURES ===============================//
+				//===============================================================================================//
+
+				//! @brief		One slot in the open-addressing table. A slot is empty when key is NULL.
+				struct Slot
+				{
+					const char* key;
+					uint32_t keyLen;
+					uint32_t hash;
+					uint32_t value;
+				};
+
+				//! @brief		The slot array. Always a power of two in size (or NULL before the first insert).
+				Slot* slotA;
+
+				//! @brief		The number of slots in slotA.
+				uint32_t capacity;
+
+				//! @brief		The number of used slots in slotA.
+				uint32_t numUsed;
+
+				//===============================================================================================//
+				//======================================= PRIVATE METHODS =======================================//
+				//===============================================================================================//
+
+				//! @brief		Doubles the size of the slot array and re-inserts all keys.
+				void Grow();
+
+		};
+
+	} // namespace MClide
+} // namespace MbeddedNinja
+
+#endif	// #ifndef MCLIDE_HASH_INDEX_H
+
+// EOF
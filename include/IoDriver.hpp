@@ -0,0 +1,192 @@
+//!
+//! @file 			IoDriver.hpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! @created		2026-10-16
+//! @last-modified 	2026-10-16
+//! @brief 			Runs many RxBuff/Rx channels (one per file descriptor) from one epoll loop. Linux only.
+//! @details
+//!					See README.rst in repo root dir for more info.
+
+#ifndef __cplusplus
+	#error Please build with C++ compiler
+#endif
+
+//===============================================================================================//
+//======================================== HEADER GUARD =========================================//
+//===============================================================================================//
+
+#ifndef MCLIDE_IO_DRIVER_H
+#define MCLIDE_IO_DRIVER_H
+
+#if(defined __linux__)
+
+//===============================================================================================//
+//==================================== FORWARD DECLARATION ======================================//
+//===============================================================================================//
+
+namespace MbeddedNinja
+{
+	namespace MClideNs
+	{
+		class IoDriver;
+	}
+}
+
+//===============================================================================================//
+//========================================== INCLUDES ===========================================//
+//===============================================================================================//
+
+//===== SYSTEM LIBRARIES =====//
+#include <stdint.h>
+
+//===== USER LIBRARIES =====//
+#include "MCallbacks/api/MCallbacksApi.hpp"
+#include "MVector/api/MVectorApi.hpp"
+
+//===== USER SOURCE =====//
+#include "Config.hpp"
+#include "PrintSink.hpp"
+#include "RxBuff.hpp"
+
+namespace MbeddedNinja
+{
+	namespace MClideNs
+	{
+
+		//! @brief		Reads any number of file descriptors (ttys, pipes, pseudo-terminals, sockets) from one thread, and
+		//!				feeds each one to its own RxBuff.
+		//! @details	Each file descriptor is a channel. Everything read from a channel is written to that channel's
+		//!				RxBuff (with RxBuff::WriteBytes()), and whatever the commands print to the command-line through
+		//!				the Rx's printSink while that happens is written back to the same file descriptor. File descriptors are
+		//!				made non-blocking when they are added. If a channel's file descriptor stays full for
+		//!				clide_IO_DRIVER_WRITE_TIMEOUT_MS while a response is written (the peer has stopped reading),
+		//!				the rest of the response is dropped and the channel is closed, so one peer can't stall the
+		//!				others.
+		//! @note		Not thread-safe, call all methods from the thread that calls Poll() (channel callbacks may add and
+		//!				remove channels).
+		class IoDriver
+		{
+
+			public:
+
+				//===============================================================================================//
+				//==================================== PUBLIC VARIABLES/STRUCTURES ==============================//
+				//===============================================================================================//
+
+				//! @brief		Called when a channel's file descriptor closes (end-of-file, hang-up or error), or a
+				//!				write to it times out. The one parameter is the file descriptor.
+				//! @details	The channel has already been removed when this is called, and the file descriptor is not
+				//!				closed, that is up to the callback.
+				MCallbacks::Callback<void, int> channelClosedCallback;
+
+				//===============================================================================================//
+				//==================================== CONSTRUCTORS/DESTRUCTOR ==================================//
+				//===============================================================================================//
+
+				//! @brief		Constructor. Creates the epoll instance.
+				IoDriver();
+
+				//! @brief		Destructor. Does not close the channels' file descriptors.
+				~IoDriver();
+
+				//! @brief		Copying is not supported, the epoll instance is owned by the IoDriver.
+				IoDriver(const IoDriver&) = delete;
+				IoDriver& operator=(const IoDriver&) = delete;
+
+				//===============================================================================================//
+				//======================================= PUBLIC METHODS ========================================//
+				//===============================================================================================//
+
+				//! @brief		Adds a channel.
+				//! @param		fd			The file descriptor to read from and write the output to. Made non-blocking.
+				//! @param		rxBuff		The RxBuff that everything read from fd is written to. Must persist until the
+				//!							channel is removed.
+				//! @returns	false if fd could not be added (or is already added), otherwise true.
+				bool AddChannel(int fd, RxBuff* rxBuff);
+
+				//! @brief		Removes a channel. Does not close the file descriptor.
+				//! @returns	false if fd was not added, otherwise true.
+				bool RemoveChannel(int fd);
+
+				//! @brief		Returns the number of channels.
+				uint32_t GetNumChannels() const;
+
+				//! @brief		Waits for any channels to be readable, and services them.
+				//! @details	Each readable channel is read once (up to clide_IO_DRIVER_READ_SIZE characters), so a busy
+				//!				channel can't hold up the others.
+				//! @param		timeoutMs		How long to wait for a channel to be readable, in milliseconds. -1 waits forever,
+				//!								0 does not wait.
+				//! @returns	The number of channels serviced, or -1 on error.
+				int Poll(int timeoutMs);
+
+				//! @brief		Calls Poll() until Stop() is called (e.g. from a command callback) or there are no channels left.
+				void Run();
+
+				//! @brief		Makes Run() return after the current Poll().
+				void Stop();
+
+			private:
+
+				//===============================================================================================//
+				//================================== PRIVATE VARIABLES/STRUCTURES ===============================//
+				//===============================================================================================//
+
+				//! @brief		A file descriptor and the RxBuff it feeds.
+				struct Channel
+				{
+					int fd;
+					//! @brief	NULL once the channel is removed.
+					RxBuff* rxBuff;
+					//! @brief	Set when a write to fd timed out. The rest of the response is dropped, and the channel
+					//!			is closed once its commands have run.
+					bool isWriteStalled;
+				};
+
+				//! @brief		The epoll instance, -1 if it could not be created.
+				int epollFd;
+
+				//! @brief		The channels.
+				MVector<Channel*> channelA;
+
+				//! @brief		The channel being serviced, which the command-line output goes to. NULL when not in Poll().
+				Channel* currChannel;
+
+				//! @brief		Channels removed during Poll(), deleted when it returns (there may still be events for them).
+				MVector<Channel*> removedChannelA;
+
+				//! @brief		true while Poll() is servicing channels.
+				bool isPolling;
+
+				//! @brief		Collects a channel's response, so it is written with as few write() calls as possible.
+				char writeBuff[clide_IO_DRIVER_WRITE_BUFF_SIZE];
+
+				//! @brief		Set by Stop().
+				bool isStopped;
+
+				//===============================================================================================//
+				//======================================= PRIVATE METHODS =======================================//
+				//===============================================================================================//
+
+				//! @brief		Returns the index of the channel for fd in channelA, or -1.
+				int32_t FindChannel(int fd) const;
+
+				//! @brief		Services one readable channel.
+				void ServiceChannel(Channel* channel, uint32_t events);
+
+				//! @brief		Removes a channel and calls channelClosedCallback.
+				void CloseChannel(Channel* channel);
+
+				//! @brief		The channel's Rx command-line write callback while the channel is being serviced. Writes the
+				//!				chunk to the channel's file descriptor.
+				void WriteToCurrChannel(PrintChunk chunk);
+
+		};
+
+	} // namespace MClide
+} // namespace MbeddedNinja
+
+#endif	// #if(defined __linux__)
+
+#endif	// #ifndef MCLIDE_IO_DRIVER_H
+
+// EOF
@@ -2,7 +2,7 @@
 //! @file 			Option.hpp
 //! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
 //! @created		2013-04-02
-//! @last-modified 	2014-10-07
+//! @last-modified 	2026-10-17
 //! @brief 		 	The option class enables used of 'optional' parameters in the command-line interface.
 //! @details
 //!					See README.rst in repo root dir for more info.
@@ -27,6 +27,7 @@ namespace MbeddedNinja
 	namespace MClideNs
 	{
 		class Option;
+		class Cmd;
 	}
 }
 
@@ -34,14 +35,40 @@ namespace MbeddedNinja
 //========================================== INCLUDES ===========================================//
 //===============================================================================================//
 
+//===== SYSTEM LIBRARIES =====//
+#include <stdint.h>
+
 //===== USER LIBRARIES =====//
 #include "MString/api/MStringApi.hpp"
 
+//===== USER SOURCE =====//
+#include "ValueSpec.hpp"
+
 namespace MbeddedNinja
 {
 	namespace MClideNs
 	{
 
+		//! @brief		A stable reference to an option registered with a command, returned by Cmd::RegisterOption().
+		//! @details	Pass it to ParseResult::IsDetected(), ParseResult::GetValue() or Cmd::GetOption() to get to the
+		//!				option in O(1), without looking it up by name. Valid for as long as the command is.
+		struct OptionHandle
+		{
+			//! @brief		Returned by Cmd::RegisterOption() if the option could not be registered.
+			static const uint32_t INVALID = 0xFFFFFFFFu;
+
+			//! @brief		The index of the option in its command's optionA, or INVALID.
+			uint32_t index;
+
+			OptionHandle() : index(INVALID) {}
+			explicit OptionHandle(uint32_t index) : index(index) {}
+
+			bool IsValid() const
+			{
+				return this->index != INVALID;
+			}
+		};
+
 		//! @brief		Holds all option variables
 		//! @details	Object of this type is passed into Rx.RegisterOption() or Tx.RegisterOption().
 		class Option
@@ -98,7 +125,9 @@ namespace MbeddedNinja
 				//========================================= PUBLIC METHODS ======================================//
 				//===============================================================================================//
 
-				// none
+				//! @brief		True if option was present the last time the command it is registered to was detected.
+				//! @note		This is cleared whenever the command is received again by the RX controller.
+				bool IsDetected() const;
 
 				//===============================================================================================//
 				//======================================= PUBLIC VARIABLES ======================================//
@@ -119,25 +148,35 @@ namespace MbeddedNinja
 				//! @todo		Change so that dynamically allocated
 				MString value;
 
+				//! @brief		The type the option's value is converted to, and its allowed range. Not converted by default.
+				//! @details	Only used if associatedValue is true. A command with an option value that can't be converted,
+				//!				or is out of range, is rejected with an error response before its callbacks are called.
+				ValueSpec valueSpec;
+
+				//! @brief		The converted value of the option, if valueSpec has a type. Assigned to when receiving
+				//!				commands, like value (so not once the Rx is frozen, see ParseResult::GetTypedValue()).
+				Value typedValue;
+
 				//! @brief		Optional callback function for when option is discovered.
 				//! @details	Function is called before the callback function for the command that it
 				//! 			was sent in is called.
 				bool (*callBackFunc)(char* optionVal);
 
-				//! @brief		True if option was present the last time the command it is registered to was detected.
-				//! @note		This is cleared whenever the command is received again by the RX controller.
-				bool isDetected;
+				//! @brief		The parse generation in which this option was last detected. 0 if never detected.
+				//! @details	Written by Rx. Use IsDetected() to read the detection state.
+				uint64_t detectedGeneration;
+
+				//! @brief		The command this option is registered to. Set by Cmd::RegisterOption().
+				Cmd* parentCmd;
+
+				//! @brief		The index of this option in its command's optionA. Set by Cmd::RegisterOption(),
+				//!				OptionHandle::INVALID until then.
+				uint32_t index;
 
 				//! @brief		Set to true if option has an associated value.
 				//! @details	An option without an associated value follows the syntax "-s" while an option with an associated value follows the syntax "-s 20". Default value is false.
 				bool associatedValue;
 
-				//! @brief		Passed into getopt_long() so that it can be set if the function
-				// 				detects the long option.
-				//! @details	If this is set, than isDetected is set. isDetected cannot be passed
-				//!				directly into getopt_long() (incompatible types).
-				int longOptionDetected;
-
 			private:
 			
 				//! @brief		All constructors end up calling this function.
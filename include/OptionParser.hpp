@@ -0,0 +1,438 @@
+//!
+//! @file 			OptionParser.hpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! @created		2026-10-16
+//! @last-modified 	2026-10-17
+//! @brief 			A single-pass option parser, used by Rx in place of getopt_long() when selected, and by StaticRx.
+//! @details
+//!					See README.rst in repo root dir for more info.
+
+#ifndef __cplusplus
+	#error Please build with C++ compiler
+#endif
+
+//===============================================================================================//
+//======================================== HEADER GUARD =========================================//
+//===============================================================================================//
+
+#ifndef MCLIDE_OPTION_PARSER_H
+#define MCLIDE_OPTION_PARSER_H
+
+//===============================================================================================//
+//==================================== FORWARD DECLARATION ======================================//
+//===============================================================================================//
+
+namespace MbeddedNinja
+{
+	namespace MClideNs
+	{
+		struct ArgView;
+		template<typename CmdOptionsT> class BasicOptionParser;
+		class CmdOptions;
+	}
+}
+
+//===============================================================================================//
+//========================================== INCLUDES ===========================================//
+//===============================================================================================//
+
+//===== SYSTEM LIBRARIES =====//
+#include <stdint.h>
+#include <string.h>		// strncmp(), memcpy()
+
+//===== USER SOURCE =====//
+#include "Config.hpp"
+#include "Option.hpp"
+#include "Cmd.hpp"
+
+namespace MbeddedNinja
+{
+	namespace MClideNs
+	{
+
+		//! @brief		One argument given to the option parser, as a view into the received message (or into an argv string).
+		struct ArgView
+		{
+			//! @brief		The first character of the argument. Not null-terminated.
+			const char* chars;
+
+			//! @brief		The number of characters in the argument.
+			uint32_t length;
+		};
+
+		//! @brief		Finds the options of a recognised command in one pass over its arguments.
+		//! @details	Follows the same (GNU) rules as getopt_long() does with the option string and long option table
+		//!				compiled by the Cmd: options and parameters can be mixed in any order, "--" ends the options,
+		//!				"--name=value" and "--name value" both work, long names can be abbreviated as long as the
+		//!				abbreviation is unique, "-abc" is the same as "-a -b -c", "-bvalue" and "-b value" both work,
+		//!				and anything that does not start with '-' (e.g. "\"-8\"") or is just "-" is a parameter. When
+		//!				clide_ENABLE_AUTO_HELP is 1, "-h" and "--help" are the built-in help option of every command.
+		//!
+		//!				The arguments are only read, so they can be views into a read-only message. Nothing is
+		//!				permuted, and only what is handed on (option values and parameters) is copied to be
+		//!				null-terminated, unless the arguments already are.
+		//!
+		//!				Rx uses OptionParser (commands registered at runtime), StaticRx uses it with StaticCmdOptions
+		//!				(commands declared constexpr), so both follow exactly the same rules.
+		//! @tparam		CmdOptionsT		How the options of the recognised command are found, e.g. CmdOptions. Has:
+		//!								- OptionRef, the type Next() returns options as (e.g. Option* or an index).
+		//!								- static OptionRef NoOption() and static OptionRef HelpOption().
+		//!								- OptionRef FindShortOption(char shortName) const.
+		//!								- OptionRef FindLongOption(const char* name, uint32_t nameLen) const, for
+		//!								  an exact long name (name is not null-terminated).
+		//!								- uint32_t GetNumOptions() const, const char* GetLongName(uint32_t optionNum)
+		//!								  const and OptionRef GetOption(uint32_t optionNum) const, which are only used
+		//!								  to check abbreviations of long names.
+		//!								- bool HasValue(OptionRef option) const.
+		template<typename CmdOptionsT>
+		class BasicOptionParser
+		{
+
+			public:
+
+				//! @brief		What Next() returns options as.
+				typedef typename CmdOptionsT::OptionRef OptionRef;
+
+				//! @brief		Returned by Next().
+				enum class Status
+				{
+					OPTION_FOUND,		//!< An option was found.
+					ERROR,				//!< Unknown or ambiguous option, or a missing or unexpected option value. Parsing can continue.
+					FINISHED			//!< There are no more options.
+				};
+
+				//===============================================================================================//
+				//==================================== CONSTRUCTORS/DESTRUCTOR ==================================//
+				//===============================================================================================//
+
+				//! @brief		Constructor.
+				//! @param		cmdOptions	The options of the recognised command.
+				//! @param		numArgs		The number of arguments, including the command name.
+				//! @param		argA		The arguments, starting with the command name.
+				//! @param		argBuff		Where option values and parameters are copied to (null-terminated) as they are
+				//!							found. Needs room for the characters of every argument plus one each. NULL if
+				//!							every argument is already followed by a null character (e.g. argv strings), in
+				//!							which case values and parameters point straight into the arguments.
+				//! @param		paramA		Where the parameters are stored as they are found. Needs room for numArgs - 1.
+				BasicOptionParser(const CmdOptionsT& cmdOptions, uint32_t numArgs, const ArgView* argA, char* argBuff, char** paramA) :
+					cmdOptions(cmdOptions),
+					numArgs(numArgs),
+					argA(argA),
+					argBuff(argBuff),
+					argBuffPos(0),
+					paramA(paramA),
+					numParams(0),
+					// argA[0] is the command name
+					argPos(1),
+					nextChar(NULL)
+				{
+					this->errorArg.chars = NULL;
+					this->errorArg.length = 0;
+				}
+
+				//===============================================================================================//
+				//========================================= PUBLIC METHODS ======================================//
+				//===============================================================================================//
+
+				//! @brief		Finds the next option.
+				//! @param		option		Set to the found option when OPTION_FOUND is returned.
+				//! @param		value		Set to the option's null-terminated value when OPTION_FOUND is returned, or
+				//!							NULL if it does not have an associated value.
+				Status Next(OptionRef* option, char** value)
+				{
+					// Part way through "-abc"?
+					if(this->nextChar != NULL)
+						return this->NextShort(option, value);
+
+					while(this->argPos < this->numArgs)
+					{
+						const ArgView& arg = this->argA[this->argPos];
+
+						// Parameter (anything that doesn't start with '-', or is just "-")
+						if((arg.length < 2) || (arg.chars[0] != '-'))
+						{
+							this->paramA[this->numParams++] = this->Terminate(arg.chars, arg.length);
+							this->argPos++;
+							continue;
+						}
+
+						// "--" ends the options, everything after it is a parameter
+						if((arg.chars[1] == '-') && (arg.length == 2))
+						{
+							this->argPos++;
+							while(this->argPos < this->numArgs)
+							{
+								const ArgView& paramArg = this->argA[this->argPos++];
+								this->paramA[this->numParams++] = this->Terminate(paramArg.chars, paramArg.length);
+							}
+							break;
+						}
+
+						if(arg.chars[1] == '-')
+							return this->NextLong(option, value);
+
+						this->nextChar = &arg.chars[1];
+						return this->NextShort(option, value);
+					}
+
+					return Status::FINISHED;
+				}
+
+				//! @brief		Returns the number of parameters stored in paramA so far. Complete once Next() has
+				//!				returned FINISHED.
+				uint32_t GetNumParams() const
+				{
+					return this->numParams;
+				}
+
+				//! @brief		Returns the argument that caused the last ERROR.
+				ArgView GetErrorArg() const
+				{
+					return this->errorArg;
+				}
+
+			private:
+
+				//===============================================================================================//
+				//======================================= PRIVATE METHODS =======================================//
+				//===============================================================================================//
+
+				//! @brief		Handles an argument starting with "--".
+				Status NextLong(OptionRef* option, char** value)
+				{
+					const ArgView& arg = this->argA[this->argPos++];
+					this->errorArg = arg;
+
+					// Name is everything after "--" up to '=' (if any)
+					const char* argEnd = &arg.chars[arg.length];
+					const char* name = &arg.chars[2];
+					const char* nameEnd = name;
+					while((nameEnd != argEnd) && (*nameEnd != '='))
+						nameEnd++;
+					uint32_t nameLen = (uint32_t)(nameEnd - name);
+
+					OptionRef foundOption = CmdOptionsT::NoOption();
+
+					#if(clide_ENABLE_AUTO_HELP == 1)
+						// The built-in help option is matched before the registered options
+						if((strncmp(name, Cmd::HELP_LONG_NAME, nameLen) == 0) && (Cmd::HELP_LONG_NAME[nameLen] == '\0'))
+							foundOption = CmdOptionsT::HelpOption();
+					#endif
+
+					if(foundOption == CmdOptionsT::NoOption())
+					{
+						// Exact names are the common case, abbreviations are only checked if there isn't one
+						foundOption = this->cmdOptions.FindLongOption(name, nameLen);
+						if(foundOption == CmdOptionsT::NoOption())
+							foundOption = this->FindLongOptionByPrefix(name, nameLen);
+					}
+
+					if(foundOption == CmdOptionsT::NoOption())
+						return Status::ERROR;
+
+					if(nameEnd != argEnd)
+					{
+						// "--name=value"
+						if(!this->cmdOptions.HasValue(foundOption))
+							return Status::ERROR;
+						*value = this->Terminate(nameEnd + 1, (uint32_t)(argEnd - (nameEnd + 1)));
+					}
+					else if(this->cmdOptions.HasValue(foundOption))
+					{
+						// "--name value", the next argument is always the value, even if it starts with '-'
+						if(this->argPos == this->numArgs)
+							return Status::ERROR;
+						const ArgView& valueArg = this->argA[this->argPos++];
+						*value = this->Terminate(valueArg.chars, valueArg.length);
+					}
+					else
+						*value = NULL;
+
+					*option = foundOption;
+					return Status::OPTION_FOUND;
+				}
+
+				//! @brief		Handles the next character in a short option argument (e.g. "-abc").
+				Status NextShort(OptionRef* option, char** value)
+				{
+					const ArgView& arg = this->argA[this->argPos];
+					this->errorArg = arg;
+
+					const char* argEnd = &arg.chars[arg.length];
+					char c = *this->nextChar++;
+
+					// Move onto the next argument once the last character in this one has been read
+					bool lastChar = (this->nextChar == argEnd);
+					if(lastChar)
+					{
+						this->nextChar = NULL;
+						this->argPos++;
+					}
+
+					OptionRef foundOption = this->cmdOptions.FindShortOption(c);
+
+					#if(clide_ENABLE_AUTO_HELP == 1)
+						// The built-in help option wins over a registered option with the same short name
+						if(c == Cmd::HELP_SHORT_NAME)
+							foundOption = CmdOptionsT::HelpOption();
+					#endif
+
+					// ':' and ';' have special meanings in the getopt_long() option string, so they are never valid
+					if((foundOption == CmdOptionsT::NoOption()) || (c == ':') || (c == ';'))
+						return Status::ERROR;
+
+					if(this->cmdOptions.HasValue(foundOption))
+					{
+						if(!lastChar)
+						{
+							// "-bvalue", the rest of the argument is the value
+							*value = this->Terminate(this->nextChar, (uint32_t)(argEnd - this->nextChar));
+							this->nextChar = NULL;
+							this->argPos++;
+						}
+						else
+						{
+							// "-b value", the next argument is always the value, even if it starts with '-'
+							if(this->argPos == this->numArgs)
+								return Status::ERROR;
+							const ArgView& valueArg = this->argA[this->argPos++];
+							*value = this->Terminate(valueArg.chars, valueArg.length);
+						}
+					}
+					else
+						*value = NULL;
+
+					*option = foundOption;
+					return Status::OPTION_FOUND;
+				}
+
+				//! @brief		Returns the characters as a null-terminated string, copying them into argBuff if it is not NULL.
+				char* Terminate(const char* chars, uint32_t length)
+				{
+					// Already followed by a null character (a value at the end of an argument ends where the argument does)
+					if(this->argBuff == NULL)
+						return (char*)chars;
+
+					char* str = &this->argBuff[this->argBuffPos];
+					memcpy(str, chars, length);
+					str[length] = '\0';
+					this->argBuffPos += length + 1;
+					return str;
+				}
+
+				//! @brief		Finds a long option by an abbreviation of its name (including the built-in help option).
+				//! @returns	The option, or NoOption() if no option, or more than one option, starts with name.
+				OptionRef FindLongOptionByPrefix(const char* name, uint32_t nameLen) const
+				{
+					// Only called when there is no exact match, so at most one option may start with name
+					OptionRef foundOption = CmdOptionsT::NoOption();
+
+					#if(clide_ENABLE_AUTO_HELP == 1)
+						if(strncmp(Cmd::HELP_LONG_NAME, name, nameLen) == 0)
+							foundOption = CmdOptionsT::HelpOption();
+					#endif
+
+					for(uint32_t x = 0; x < this->cmdOptions.GetNumOptions(); x++)
+					{
+						const char* longName = this->cmdOptions.GetLongName(x);
+						if((longName[0] == '\0') || (strncmp(longName, name, nameLen) != 0))
+							continue;
+
+						if(foundOption != CmdOptionsT::NoOption())
+							return CmdOptionsT::NoOption();
+
+						foundOption = this->cmdOptions.GetOption(x);
+					}
+
+					return foundOption;
+				}
+
+				//===============================================================================================//
+				//================================== PRIVATE VARIABLES/STRUCTURES ===============================//
+				//===============================================================================================//
+
+				//! @brief		The options of the recognised command.
+				CmdOptionsT cmdOptions;
+
+				//! @brief		The number of arguments, including the command name.
+				uint32_t numArgs;
+
+				//! @brief		The arguments.
+				const ArgView* argA;
+
+				//! @brief		Where values and parameters are copied to, or NULL if the arguments are null-terminated.
+				char* argBuff;
+
+				//! @brief		The number of characters used in argBuff.
+				uint32_t argBuffPos;
+
+				//! @brief		The parameters found so far.
+				char** paramA;
+
+				//! @brief		The number of parameters found so far.
+				uint32_t numParams;
+
+				//! @brief		The index of the next argument to read.
+				uint32_t argPos;
+
+				//! @brief		The next short option character to read in the current argument, or NULL if not
+				//!				part way through a short option argument.
+				const char* nextChar;
+
+				//! @brief		The argument that caused the last ERROR.
+				ArgView errorArg;
+
+		};
+
+		//! @brief		The options of a Cmd, for BasicOptionParser. Options are returned as Option pointers.
+		//! @details	Short options are found with the command's 128 element short option table instead of searching
+		//!				the option string, and exact long names with the command's long option index instead of
+		//!				comparing every long name, so Rx does not have to search optionA for the returned Option.
+		class CmdOptions
+		{
+
+			public:
+
+				typedef Option* OptionRef;
+
+				//! @brief		Constructor.
+				//! @param		cmd		The recognised command. Its options must have been compiled (they are when registered).
+				explicit CmdOptions(const Cmd* cmd);
+
+				static Option* NoOption();
+
+				#if(clide_ENABLE_AUTO_HELP == 1)
+					//! @brief		Returns Cmd::GetHelpOption().
+					static Option* HelpOption();
+				#endif
+
+				//! @brief		Looks the option up in Cmd::shortOptionIndexA.
+				Option* FindShortOption(char shortName) const;
+
+				//! @brief		Looks the option up in Cmd::longOptionIndex.
+				Option* FindLongOption(const char* name, uint32_t nameLen) const;
+
+				uint32_t GetNumOptions() const;
+
+				const char* GetLongName(uint32_t optionNum) const;
+
+				Option* GetOption(uint32_t optionNum) const;
+
+				bool HasValue(Option* option) const;
+
+			private:
+
+				//! @brief		The recognised command.
+				const Cmd* cmd;
+
+		};
+
+		//! @brief		The single-pass option parser used by Rx.
+		typedef BasicOptionParser<CmdOptions> OptionParser;
+
+	} // namespace MClide
+} // namespace MbeddedNinja
+
+#endif	// #ifndef MCLIDE_OPTION_PARSER_H
+
+// EOF
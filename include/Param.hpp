@@ -2,7 +2,7 @@
 //! @file 			Param.hpp
 //! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
 //! @created		2013-04-02
-//! @last-modified 	2014-10-08
+//! @last-modified 	2026-10-17
 //! @brief 		 
 //! @details
 //!				See README.rst in root dir for more info.
@@ -39,6 +39,7 @@ namespace MbeddedNinja
 
 //===== USER SOURCE =====//
 #include "Config.hpp"
+#include "ValueSpec.hpp"
 
 //===============================================================================================//
 //======================================== NAMESPACE ============================================//
@@ -87,6 +88,15 @@ namespace MbeddedNinja
 				//! @note		Parameters have no names
 				MString value;
 
+				//! @brief		The type the parameter is converted to, and its allowed range. Not converted by default.
+				//! @details	e.g. param.valueSpec = ValueSpec::Int32(0, 5000). A command with a parameter that can't be
+				//!				converted, or is out of range, is rejected with an error response before its callbacks are called.
+				ValueSpec valueSpec;
+
+				//! @brief		The converted value of the parameter, if valueSpec has a type. Assigned to when receiving
+				//!				commands, like value (so not once the Rx is frozen, see ParseResult::GetTypedParam()).
+				Value typedValue;
+
 				//! @brief		Optional callback function for when parameter is discovered.
 				//! @details	Function is called before the callback function for the command that it
 				//! 			was sent in is called.
@@ -0,0 +1,109 @@
+//!
+//! @file 			ParseArena.hpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! @created		2026-10-16
+//! @last-modified 	2026-10-16
+//! @brief 			A simple bump allocator over caller-supplied memory, used by Rx when parsing long messages.
+//! @details
+//!					See README.rst in repo root dir for more info.
+
+#ifndef __cplusplus
+	#error Please build with C++ compiler
+#endif
+
+//===============================================================================================//
+//======================================== HEADER GUARD =========================================//
+//===============================================================================================//
+
+#ifndef MCLIDE_PARSE_ARENA_H
+#define MCLIDE_PARSE_ARENA_H
+
+//===============================================================================================//
+//==================================== FORWARD DECLARATION ======================================//
+//===============================================================================================//
+
+namespace MbeddedNinja
+{
+	namespace MClideNs
+	{
+		class ParseArena;
+	}
+}
+
+//===============================================================================================//
+//========================================== INCLUDES ===========================================//
+//===============================================================================================//
+
+//===== SYSTEM LIBRARIES =====//
+#include <stdint.h>
+#include <stddef.h>		// size_t
+
+namespace MbeddedNinja
+{
+	namespace MClideNs
+	{
+
+		//! @brief		Hands out memory from a buffer supplied by the caller (e.g. a static array), without ever calling malloc().
+		//! @details	Memory is not freed individually. Instead, remember GetUsed() and pass it to Release() to free
+		//!				everything allocated since (this is what ParseContext does at the end of every Rx::Run()).
+		//!				Assign one to Rx::parseArena to stop long messages from using the heap.
+		class ParseArena
+		{
+
+			public:
+
+				//===============================================================================================//
+				//==================================== CONSTRUCTORS/DESTRUCTOR ==================================//
+				//===============================================================================================//
+
+				//! @brief		Constructor.
+				//! @param		buff		The memory to hand out. Must persist for as long as the arena is used.
+				//! @param		buffSize	The number of bytes in buff.
+				ParseArena(void* buff, size_t buffSize);
+
+				//! @brief		Copying is not supported, two arenas would hand out the same memory.
+				ParseArena(const ParseArena&) = delete;
+				ParseArena& operator=(const ParseArena&) = delete;
+
+				//===============================================================================================//
+				//========================================= PUBLIC METHODS ======================================//
+				//===============================================================================================//
+
+				//! @brief		Allocates memory from the arena.
+				//! @param		size		The number of bytes to allocate.
+				//! @param		align		The required alignment. Must be a power of 2.
+				//! @returns	Pointer to the memory, or NULL if there is not enough room left in the arena.
+				void* Alloc(size_t size, size_t align);
+
+				//! @brief		Returns the number of bytes used so far (including alignment padding).
+				size_t GetUsed() const;
+
+				//! @brief		Frees everything that was allocated after GetUsed() returned used.
+				void Release(size_t used);
+
+				//! @brief		Frees everything.
+				void Reset();
+
+			private:
+
+				//===============================================================================================//
+				//================================== PRIVATE VARIABLES/STRUCTURES ===============================//
+				//===============================================================================================//
+
+				//! @brief		The caller-supplied memory.
+				uint8_t* buff;
+
+				//! @brief		The number of bytes in buff.
+				size_t buffSize;
+
+				//! @brief		The number of bytes that have been handed out.
+				size_t used;
+
+		};
+
+	} // namespace MClide
+} // namespace MbeddedNinja
+
+#endif	// #ifndef MCLIDE_PARSE_ARENA_H
+
+// EOF
@@ -0,0 +1,102 @@
+//!
+//! @file 			ParseContext.hpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! @created		2026-10-16
+//! @last-modified 	2026-10-17
+//! @brief 			Holds all of the state used while Rx is parsing one command message.
+//! @details
+//!					See README.rst in repo root dir for more info.
+
+#ifndef __cplusplus
+	#error Please build with C++ compiler
+#endif
+
+//===============================================================================================//
+//======================================== HEADER GUARD =========================================//
+//===============================================================================================//
+
+#ifndef MCLIDE_PARSE_CONTEXT_H
+#define MCLIDE_PARSE_CONTEXT_H
+
+//===============================================================================================//
+//==================================== FORWARD DECLARATION ======================================//
+//===============================================================================================//
+
+namespace MbeddedNinja
+{
+	namespace MClideNs
+	{
+		class ParseContext;
+	}
+}
+
+//===============================================================================================//
+//========================================== INCLUDES ===========================================//
+//===============================================================================================//
+
+//===== USER SOURCE =====//
+#include "Config.hpp"
+#include "GetOpt.hpp"
+#include "ParseArena.hpp"
+
+namespace MbeddedNinja
+{
+	namespace MClideNs
+	{
+
+		//! @brief		Holds all of the state used while parsing a single command message.
+		//! @details	Each call to Rx::Run() creates its own ParseContext, and passes it down to everything it calls.
+		//!				Nothing on the parse path uses static variables, so different Rx objects can run at the same
+		//!				time (e.g. one Rx per serial port, each on its own thread).
+		//! @note		A single Rx object is still not safe to run from multiple threads at once, since it writes to the
+		//!				commands, options and parameters that are registered with it.
+		class ParseContext
+		{
+
+			public:
+
+				//===============================================================================================//
+				//==================================== CONSTRUCTORS/DESTRUCTOR ==================================//
+				//===============================================================================================//
+
+				//! @brief		Constructor. Resets the getopt_long() state so it is ready for a new argument vector.
+				//! @param		arena		The arena to take memory for long messages from. Can be NULL.
+				explicit ParseContext(ParseArena* arena = NULL);
+
+				//! @brief		Destructor. Gives back everything that was taken from the arena during the parse.
+				~ParseContext();
+
+				//! @brief		Copying is not supported, both copies would release the arena.
+				ParseContext(const ParseContext&) = delete;
+				ParseContext& operator=(const ParseContext&) = delete;
+
+				//===============================================================================================//
+				//======================================= PUBLIC VARIABLES ======================================//
+				//===============================================================================================//
+
+				//! @brief		Used by GetOpt::getopt_long_r() in place of the static GetOpt::optind, GetOpt::optarg e.t.c.
+				GetOpt::_getopt_data getoptData;
+
+				//! @brief		The arena to take memory for long messages from. Can be NULL.
+				ParseArena* arena;
+
+				//! @brief		How much of the arena was used when the parse started.
+				size_t arenaMark;
+
+				//! @brief		Set when a received option or parameter value is rejected (see ValueSpec). The command's
+				//!				callbacks are not called.
+				bool isRejected;
+
+				#if(clide_ENABLE_DEBUG_CODE == 1)
+					//! @brief		Buffer for building debug messages while parsing.
+					char debugBuff[clide_DEBUG_BUFF_SIZE];
+				#endif
+
+		};
+
+	} // namespace MClide
+} // namespace MbeddedNinja
+
+#endif	// #ifndef MCLIDE_PARSE_CONTEXT_H
+
+// EOF
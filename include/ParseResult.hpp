@@ -0,0 +1,188 @@
+//!
+//! @file 			ParseResult.hpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! @created		2026-10-16
+//! @last-modified 	2026-10-17
+//! @brief 			Holds what Rx found in one received command (detected options, option values and parameters).
+//! @details
+//!					See README.rst in repo root dir for more info.
+
+#ifndef __cplusplus
+	#error Please build with C++ compiler
+#endif
+
+//===============================================================================================//
+//======================================== HEADER GUARD =========================================//
+//===============================================================================================//
+
+#ifndef MCLIDE_PARSE_RESULT_H
+#define MCLIDE_PARSE_RESULT_H
+
+//===============================================================================================//
+//==================================== FORWARD DECLARATION ======================================//
+//===============================================================================================//
+
+namespace MbeddedNinja
+{
+	namespace MClideNs
+	{
+		class ParseResult;
+		class Cmd;
+		class Option;
+	}
+}
+
+//===============================================================================================//
+//========================================== INCLUDES ===========================================//
+//===============================================================================================//
+
+//===== SYSTEM LIBRARIES =====//
+#include <stdint.h>
+
+//===== USER SOURCE =====//
+#include "Config.hpp"
+#include "Option.hpp"
+#include "ParseArena.hpp"
+#include "SmallBuff.hpp"
+#include "ValueSpec.hpp"
+
+namespace MbeddedNinja
+{
+	namespace MClideNs
+	{
+
+		//! @brief		The result of parsing one received command, passed to Cmd::resultFunctionCallback and
+		//!				Cmd::resultMethodCallback.
+		//! @details	Each call to Rx::Run() has its own ParseResult, so handlers that read from it (rather than from
+		//!				Cmd::IsDetected(), Option::value e.t.c.) do not depend on anything shared between parses.
+		//!				Option values and parameters point into memory owned by Rx::Run(), so they are only valid
+		//!				until the callback returns. Copy them if they are needed for longer.
+		class ParseResult
+		{
+
+			public:
+
+				//===============================================================================================//
+				//==================================== CONSTRUCTORS/DESTRUCTOR ==================================//
+				//===============================================================================================//
+
+				//! @brief		Constructor. No options detected and no parameters.
+				//! @param		cmd			The received command.
+				//! @param		arena		Where to store the option results if the command has more than
+				//!							clide_NUM_INLINE_OPTIONS options. Can be NULL.
+				ParseResult(Cmd* cmd, ParseArena* arena);
+
+				//! @brief		Copying is not supported, option results may be stored inline.
+				ParseResult(const ParseResult&) = delete;
+				ParseResult& operator=(const ParseResult&) = delete;
+
+				//===============================================================================================//
+				//========================================= PUBLIC METHODS ======================================//
+				//===============================================================================================//
+
+				//! @brief		Returns the received command.
+				Cmd* GetCmd() const;
+
+				//! @brief		Returns true if the option was received.
+				//! @param		option		An option registered with the received command. Any other option
+				//!							returns false.
+				bool IsDetected(const Option* option) const;
+
+				//! @brief		Returns the value the option was received with.
+				//! @returns	The null-terminated value, or NULL if the option was not received or has no
+				//!				associated value.
+				const char* GetValue(const Option* option) const;
+
+				//! @brief		Returns true if the option was received.
+				//! @param		optionHandle	Returned by Cmd::RegisterOption() for an option of the received command.
+				//!								Looks the option up by position, without following the Option pointer.
+				bool IsDetected(OptionHandle optionHandle) const;
+
+				//! @brief		Returns the value the option was received with.
+				//! @param		optionHandle	Returned by Cmd::RegisterOption() for an option of the received command.
+				//! @returns	The null-terminated value, or NULL if the option was not received or has no
+				//!				associated value.
+				const char* GetValue(OptionHandle optionHandle) const;
+
+				//! @brief		Returns the number of received parameters (always the number registered with the command
+				//!				by the time any callback is called).
+				uint32_t GetNumParams() const;
+
+				//! @brief		Returns a received parameter, in the order they were registered with the command.
+				//! @returns	The null-terminated parameter, or NULL if paramNum is out of range.
+				const char* GetParam(uint32_t paramNum) const;
+
+				//! @brief		Returns the converted value the option was received with (see Option::valueSpec).
+				//! @returns	NULL if the option was not received, has no associated value, or is not converted.
+				const Value* GetTypedValue(const Option* option) const;
+
+				//! @brief		Returns the converted value the option was received with (see Option::valueSpec).
+				//! @param		optionHandle	Returned by Cmd::RegisterOption() for an option of the received command.
+				//! @returns	NULL if the option was not received, has no associated value, or is not converted.
+				const Value* GetTypedValue(OptionHandle optionHandle) const;
+
+				//! @brief		Returns a converted parameter (see Param::valueSpec), e.g. result.GetTypedParam(0)->int32.
+				//! @returns	NULL if paramNum is out of range or the parameter is not converted.
+				const Value* GetTypedParam(uint32_t paramNum) const;
+
+				//! @brief		Records that an option was received. Called by Rx.
+				//! @param		value		The option's value, or NULL if it has none.
+				void SetDetected(const Option* option, const char* value);
+
+				//! @brief		Records the received parameters. Called by Rx.
+				void SetParams(char* const* paramA, uint32_t numParams);
+
+				//! @brief		Records the converted value of a received option. Called by Rx, after SetDetected().
+				void SetTypedValue(const Option* option, const Value& value);
+
+				//! @brief		Records the converted value of a received parameter. Called by Rx, after SetParams().
+				void SetTypedParam(uint32_t paramNum, const Value& value);
+
+			private:
+
+				//===============================================================================================//
+				//================================== PRIVATE VARIABLES/STRUCTURES ===============================//
+				//===============================================================================================//
+
+				//! @brief		What was received for one option.
+				struct OptionResult
+				{
+					bool isDetected;
+					const char* value;
+					//! @brief		Only valid if isTyped is true.
+					Value typedValue;
+					bool isTyped;
+				};
+
+				//! @brief		Returns the index of option in the received command's optionA, or -1 if it is not
+				//!				registered with the received command.
+				int32_t GetOptionIndex(const Option* option) const;
+
+				//! @brief		Returns the index of the option in the received command's optionA, or -1 if the handle is
+				//!				invalid or out of range.
+				int32_t GetOptionIndex(OptionHandle optionHandle) const;
+
+				//! @brief		The received command.
+				Cmd* cmd;
+
+				//! @brief		One element for each option registered with the command, in the same order as Cmd::optionA.
+				SmallBuff<OptionResult, clide_NUM_INLINE_OPTIONS> optionResultA;
+
+				//! @brief		The received parameters. Points into the argument buffer of Rx::Run().
+				char* const* paramA;
+
+				//! @brief		The number of elements in paramA.
+				uint32_t numParams;
+
+				//! @brief		The converted parameters, one element for each parameter registered with the command. Only
+				//!				valid for parameters whose Param::valueSpec has a type.
+				SmallBuff<Value, clide_NUM_INLINE_PARAMS> typedParamA;
+
+		};
+
+	} // namespace MClide
+} // namespace MbeddedNinja
+
+#endif	// #ifndef MCLIDE_PARSE_RESULT_H
+
+// EOF
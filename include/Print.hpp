@@ -2,7 +2,7 @@
 //! @file 			Print.hpp
 //! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
 //! @created		2013-03-19
-//! @last-modified 	2014-10-07
+//! @last-modified 	2026-10-16
 //! @brief 			Contains callbacks for port-specific print operations.
 //! @details
 //!					See README.rst in root dir for more info.
@@ -0,0 +1,152 @@
+//!
+//! @file 			PrintSink.hpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! @created		2026-10-16
+//! @last-modified 	2026-10-16
+//! @brief 			Where one Rx/Tx object's output goes.
+//! @details
+//!					See README.rst in repo root dir for more info.
+
+#ifndef __cplusplus
+	#error Please build with C++ compiler
+#endif
+
+//===============================================================================================//
+//======================================== HEADER GUARD =========================================//
+//===============================================================================================//
+
+#ifndef MCLIDE_PRINT_SINK_H
+#define MCLIDE_PRINT_SINK_H
+
+//===============================================================================================//
+//==================================== FORWARD DECLARATION ======================================//
+//===============================================================================================//
+
+namespace MbeddedNinja
+{
+	namespace MClideNs
+	{
+		class PrintSink;
+	}
+}
+
+//===============================================================================================//
+//========================================== INCLUDES ===========================================//
+//===============================================================================================//
+
+//===== SYSTEM LIBRARIES =====//
+#include <stddef.h>		// size_t
+
+//===== USER LIBRARIES =====//
+#include "MCallbacks/api/MCallbacksApi.hpp"		//!< Callbacks.
+
+//===== USER SOURCE =====//
+#include "Print.hpp"
+
+namespace MbeddedNinja
+{
+	namespace MClideNs
+	{
+
+		//! @brief		A run of characters passed to PrintSink::cmdLineWriteCallback. Not null-terminated.
+		struct PrintChunk
+		{
+			const char* chars;
+			size_t numChars;
+		};
+
+		//! @brief		The debug, command-line and error output of one object (see Comm::printSink).
+		//! @details	Each callback that is not assigned falls back to the one in Print (and the matching
+		//!				Print::enable*Printing flag), so nothing changes for code that only uses Print::AssignCallbacks().
+		//!				Once assigned, the object's output only touches this sink, so objects on different threads
+		//!				(or different ports) don't share anything.
+		class PrintSink
+		{
+
+			public:
+
+				//===============================================================================================//
+				//==================================== PUBLIC VARIABLES/STRUCTURES ==============================//
+				//===============================================================================================//
+
+				//! @brief		Callback for debug messages. Print's is used if not assigned.
+				MCallbacks::Callback<void, const char*> debugPrintCallback;
+
+				//! @brief		Callback for command-line messages (responses and help text). Print's is used if not assigned.
+				MCallbacks::Callback<void, const char*> cmdLinePrintCallback;
+
+				//! @brief		Callback for command-line output as (characters, length) chunks. Used instead of
+				//!				cmdLinePrintCallback when assigned.
+				//! @details	With a buffer (see SetBuffer()), command-line output is collected and passed on in one chunk
+				//!				per response (Rx::Run() flushes when it returns), or when the buffer is full. Without one, each
+				//!				message is passed on as it is printed.
+				MCallbacks::Callback<void, PrintChunk> cmdLineWriteCallback;
+
+				//! @brief		Callback for error messages. Print's is used if not assigned.
+				MCallbacks::Callback<void, const char*> errorPrintCallback;
+
+				//! @brief		Set to false to turn off this object's debug messages. Defaults to true.
+				bool enableDebugInfoPrinting;
+
+				//! @brief		Set to false to turn off this object's command-line messages. Defaults to true.
+				bool enableCmdLinePrinting;
+
+				//! @brief		Set to false to turn off this object's error messages. Defaults to true.
+				bool enableErrorPrinting;
+
+				//===============================================================================================//
+				//==================================== CONSTRUCTORS/DESTRUCTOR ==================================//
+				//===============================================================================================//
+
+				//! @brief		Constructor. No callbacks are assigned, so everything goes to Print.
+				PrintSink();
+
+				//===============================================================================================//
+				//======================================= PUBLIC METHODS ========================================//
+				//===============================================================================================//
+
+				//! @brief		Assigns all three callbacks at once, like Print::AssignCallbacks().
+				void AssignCallbacks(
+						MCallbacks::Callback<void, const char*> debugPrintCallback,
+						MCallbacks::Callback<void, const char*> cmdLinePrintCallback,
+						MCallbacks::Callback<void, const char*> errorPrintCallback);
+
+				//! @brief		Sets the buffer that command-line output is collected in before being passed to cmdLineWriteCallback.
+				//! @param		buff		The buffer. Must persist for as long as it is set. NULL to stop buffering.
+				//! @param		buffSize	The number of characters in buff.
+				//! @note		Anything already buffered is flushed first. A sink with a buffer must not be printed to from
+				//!				more than one thread at once, so don't set one on a frozen Rx that is run on several threads.
+				void SetBuffer(char* buff, size_t buffSize);
+
+				//! @brief		Passes any buffered command-line output to cmdLineWriteCallback.
+				//! @details	Called by Rx at the end of every response. Call it after printing outside of Rx::Run()
+				//!				(e.g. after calling Comm::PrintHelp() directly).
+				void Flush();
+
+				void PrintDebugInfo(const char* msg, Print::DebugPrintingLevel debugPrintingLevel) const;
+				void PrintError(const char* msg) const;
+				void PrintToCmdLine(const char* msg);
+
+			private:
+
+				//===============================================================================================//
+				//================================== PRIVATE VARIABLES/STRUCTURES ===============================//
+				//===============================================================================================//
+
+				//! @brief		Command-line output waiting to be passed to cmdLineWriteCallback, NULL if not buffering.
+				char* buff;
+
+				//! @brief		The number of characters in buff.
+				size_t buffSize;
+
+				//! @brief		The number of characters waiting in buff.
+				size_t buffWritePos;
+
+		};
+
+	} // namespace MClide
+} // namespace MbeddedNinja
+
+#endif	// #ifndef MCLIDE_PRINT_SINK_H
+
+// EOF
@@ -2,7 +2,7 @@
 //! @file 			Rx.hpp
 //! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
 //! @created		2012-03-19
-//! @last-modified 	2014-10-09
+//! @last-modified 	2026-10-17
 //! @brief 			Clide RX controller. The main logic of the RX (decoding) part of Clide. Commands can be registered with the controller.
 //! @details
 //!					See README.rst in repo root dir for more info.
@@ -43,6 +43,10 @@ namespace MbeddedNinja
 #include "Option.hpp"
 #include "Cmd.hpp"
 #include "GetOpt.hpp"
+#include "ParseArena.hpp"
+#include "ParseContext.hpp"
+#include "ParseResult.hpp"
+#include "OptionParser.hpp"
 #include "Comm.hpp"
 
 
@@ -65,6 +69,13 @@ namespace MbeddedNinja
 					CMD_NOT_RECOGNISED
 				};
 
+				//! @brief		Selects how Rx finds the options of a received command.
+				enum class OptionParserMode
+				{
+					GETOPT,			//!< The ported getopt_long() (GetOpt::getopt_long_r()).
+					SINGLE_PASS		//!< OptionParser, which walks the arguments once. Same rules as GETOPT.
+				};
+
 				//===============================================================================================//
 				//=================================== PUBLIC VARIABLES/STRUCTURES ===============================//
 				//===============================================================================================//
@@ -80,6 +91,15 @@ namespace MbeddedNinja
 				//! @details	Only applicable when calling Run(int argc, char* argv[]). Defaults to true.
 				bool ignoreFirstArgvElement;
 
+				//! @brief		Memory used for messages with more than clide_NUM_INLINE_ARGS arguments, or more than
+				//!				clide_ARG_BUFF_SIZE characters. Everything taken from it is given back before Run() returns.
+				//! @details	Defaults to NULL, in which case such messages use the heap.
+				ParseArena* parseArena;
+
+				//! @brief		How the options of a received command are found.
+				//! @details	Defaults to OptionParserMode::GETOPT.
+				OptionParserMode optionParserMode;
+
 				//===============================================================================================//
 				//======================================= PUBLIC METHODS ========================================//
 				//===============================================================================================//
@@ -94,17 +114,51 @@ namespace MbeddedNinja
 				~Rx();
 
 				//! @brief		Runs the algorithm. Call this with the received command msg (array of characters).
-				//! @details	In a Linux environment, cmdMsg could be equal to a read line of cin. Calls Rx::Run2().
-				//! @param		cmdMsg	The message to process.
+				//! @details	In a Linux environment, cmdMsg could be equal to a read line of cin.
+				//!				Calls Run(const char* cmdMsg, size_t cmdMsgLen).
+				//! @param		cmdMsg	The null-terminated message to process. Not modified.
 				//! @returns	true is the command processing of cmdMsg was successful, otherwise false.
 				//! @sa			bool Run(int argc, char* argv[])
-				bool Run(char * cmdMsg);
+				bool Run(const char * cmdMsg);
+
+				//! @brief		Runs the algorithm on a message of known length.
+				//! @details	The message is split into token views without being copied or modified, so it can be
+				//!				in read-only or memory-mapped memory, and does not need to be null-terminated.
+				//! @param		cmdMsg		The message to process.
+				//! @param		cmdMsgLen	The number of characters in cmdMsg.
+				//! @returns	true is the command processing of cmdMsg was successful, otherwise false.
+				bool Run(const char * cmdMsg, size_t cmdMsgLen);
 
 				//! @brief		Runs the algorithm, using standard main() variables (argc, argv) as input. Use this function when you are calling a program from the command-line and are passing in variables to argc and argv. These can be passed directly to this function.
 				//! @details	Calls Rx::Run2().
-				//! @sa			bool Run(char * cmdMsg)
+				//! @sa			bool Run(const char * cmdMsg)
 				bool Run(int argc, char * argv[]);
 
+				//! @brief		Looks up a registered command by name, using a hash of the name that has already been worked out.
+				//! @details	Used by a streaming RxBuff, which hashes the command name while it is still arriving.
+				//! @param		cmdName		The command name. Does not need to be null-terminated.
+				//! @param		cmdNameLen	The number of characters in cmdName.
+				//! @param		cmdNameHash	HashIndex::Hash() of cmdName.
+				//! @returns	The command, or NULL if no command with that name is registered.
+				Cmd * FindCmd(const char * cmdName, uint32_t cmdNameLen, uint32_t cmdNameHash) const;
+
+				//! @brief		Runs a message that has already been split into arguments, and whose command has already been looked up.
+				//! @details	Skips the tokenizing, command look-up and argument copying done by Run(const char*, size_t), which a
+				//!				streaming RxBuff has already done while the message was arriving.
+				//! @param		foundCmd	The command named by args[0] (from FindCmd()), or NULL if it is not registered.
+				//! @param		numArgs		The number of arguments, including the command name.
+				//! @param		args		The null-terminated arguments, followed by a NULL pointer (like argv). The order of
+				//!							the pointers may be changed by the option parser.
+				//! @returns	true is the command processing was successful, otherwise false.
+				bool RunArgs(Cmd * foundCmd, int numArgs, char * args[]);
+
+				//! @brief		Reports a command that is not registered, and calls cmdUnrecogCallback if assigned.
+				//! @details	Also called by a streaming RxBuff when it rejects a command before it has finished arriving.
+				//! @param		cmdName		The received command name. Does not need to be null-terminated.
+				//! @param		cmdNameLen	The number of characters in cmdName.
+				//! @returns	Always false.
+				bool CmdNotRecognised(const char * cmdName, uint32_t cmdNameLen);
+
 			private:
 
 
@@ -115,26 +169,75 @@ namespace MbeddedNinja
 				//! @brief		Initialisation method called by all of Rx constructors.
 				void Init(bool enableHelpNoHeaderOption);
 
-				//! @brief		Internal run command, called by the public Run() functions after some specific processing.
-				int Run2(uint8_t numArgs, char * _args[]);
+				//! @brief		Does the work of Run(const char*, size_t), which then flushes printSink.
+				bool RunMsg(const char * cmdMsg, size_t cmdMsgLen);
+
+				//! @brief		Internal run command, called by Run(int argc, char* argv[]).
+				int Run2(ParseContext& context, int numArgs, char * _args[]);
+
+				//! @brief		Processes the options and parameters of a recognised command, and calls the command's callbacks.
+				//! @param		_argsPtr	The arguments, starting with the command name. Re-arranged by getopt_long().
+				bool RunCmd(ParseContext& context, Cmd * foundCmd, int numArgs, char * _argsPtr[]);
+
+				//! @brief		Like RunCmd() above, but always with OptionParser, which reads the arguments as views.
+				//! @param		argA		The arguments, starting with the command name.
+				//! @param		argBuff		See OptionParser::OptionParser(). NULL if the arguments are null-terminated.
+				bool RunCmd(ParseContext& context, Cmd * foundCmd, uint32_t numArgs, const ArgView argA[], char * argBuff);
+
+				//! @brief		Checks and converts the parameters of a recognised command once its options are parsed,
+				//!				and calls the command's callbacks.
+				bool FinishCmd(ParseContext& context, Cmd * foundCmd, ParseResult& result, char * paramA[], uint32_t numParams);
+
+				//! @brief		Finds and handles the options of a recognised command with getopt_long().
+				//! @param		paramA		Set to the parameters.
+				//! @param		numParams	Set to the number of parameters.
+				//! @returns	true if the help option was received (and help printed) or an option value was rejected
+				//!				(context.isRejected is set), otherwise false.
+				bool ParseOptionsGetOpt(ParseContext& context, Cmd * foundCmd, ParseResult& result, int numArgs, char * _argsPtr[], char *** paramA, uint32_t * numParams);
+
+				//! @brief		Finds and handles the options of a recognised command with OptionParser.
+				//! @param		argBuff		See OptionParser::OptionParser().
+				//! @param		paramA		The parameters are stored here. Needs room for numArgs - 1.
+				//! @param		numParams	Set to the number of parameters.
+				//! @returns	true if the help option was received (and help printed) or an option value was rejected
+				//!				(context.isRejected is set), otherwise false.
+				bool ParseOptionsSinglePass(ParseContext& context, Cmd * foundCmd, ParseResult& result, uint32_t numArgs, const ArgView argA[], char * argBuff, char * paramA[], uint32_t * numParams);
+
+				//! @brief		Marks a received option as detected in result (and, until frozen, in the option itself),
+				//!				saves its value and calls its callback.
+				//! @param		foundOption		The received option, or NULL if it is not registered with the command.
+				//! @param		optionValue		The option's value, or NULL if it has none.
+				//! @param		optionArg		The argument the option was received in, used for the error message if
+				//!								foundOption is NULL (otherwise it can be NULL).
+				//! @returns	true if the option was the help option (and help printed), or its value was rejected
+				//!				(context.isRejected is set), otherwise false.
+				bool HandleOption(ParseContext& context, Cmd * foundCmd, ParseResult& result, Option * foundOption, const char * optionValue, const char * optionArg);
+
+				//! @brief		Converts the typed parameters (see Param::valueSpec) into result (and, until frozen, into
+				//!				the parameters themselves).
+				//! @returns	false if one was rejected (and the error response printed).
+				bool ConvertParams(ParseContext& context, Cmd * foundCmd, ParseResult& result, char * const * paramA);
+
+				//! @brief		Prints the error response for a value that ValueSpec::Convert() rejected.
+				//! @param		valueName		What the value is, e.g. "Param 1" or "Option '--speed'".
+				void PrintValueError(const char * valueName, const char * valueStr, const ValueSpec& valueSpec, ValueSpec::Status status);
 
 				//! @brief		Validates command.
-				//! @details	Makes sure cmd is in the registered command list
-				Cmd * ValidateCmd(char * cmdName, MVector<Cmd*> cmdA);
-
-				//! @brief		Checks for option in registered command
-				Option * ValidateOption(Cmd * detectedCmd, char * optionName);
-
-				//! @brief		Splits packet into arguments, which can be options and/or parameters.
-				//! @returns	Number of arguments found
-				int SplitPacket(char * packet, char * argv[]);
-
-				//! @brief		Builds the short option string for the getopt_long() function from the list
-				//!				of the registered commands.
-				void BuildShortOptionString(char * optionString, Cmd * cmd);
-
-				//! @brief		Builds the structure of long options that is required by getopt_long().
-				void BuildLongOptionStruct(GetOpt::option * longOptStructA, Cmd * cmd);
+				//! @details	Makes sure cmd is in the registered command list. Uses the command index,
+				//!				so the cost does not depend on the number of registered commands.
+				//! @param		cmdName		The received command name. Does not need to be null-terminated.
+				//! @param		cmdNameLen	The number of characters in cmdName.
+				Cmd * ValidateCmd(ParseContext& context, const char * cmdName, uint32_t cmdNameLen);
+
+				//! @brief		Checks for option in registered command.
+				//! @details	Uses Cmd::FindOptionByShortName() and Cmd::FindOptionByLongName(), so the cost does not
+				//!				depend on the number of registered options.
+				//! @param		optionName	A one character name is a short name, anything longer is a long name.
+				Option * ValidateOption(ParseContext& context, Cmd * detectedCmd, char * optionName);
+
+				//! @brief		Starts a new parse by advancing Comm::parseGeneration.
+				//! @details	This clears the detected state of every registered command and option in O(1).
+				void NextParseGeneration();
 
 				//===============================================================================================//
 				//================================== PRIVATE VARIABLES/STRUCTURES ===============================//
@@ -2,8 +2,8 @@
 //! @file 			RxBuff.hpp
 //! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
 //! @created		2014-01-09
-//! @last-modified 	2014-10-07
-//! @brief 			An input buffer for the Rx engine. This can accept a stream of characters and call Rx::Go when the CR character is detected.
+//! @last-modified 	2026-10-16
+//! @brief 			An input buffer for the Rx engine. This can accept a stream of characters and call Rx::Run() when the end-of-command character is detected.
 //! @details
 //!					See README.rst in repo root dir for more info.
 
@@ -37,9 +37,14 @@ namespace MbeddedNinja
 
 //===== SYSTEM LIBRARIES =====//
 #include <stdint.h>
+#include <stddef.h>		// size_t
+
+//===== USER LIBRARIES =====//
+#include "MCallbacks/api/MCallbacksApi.hpp"		//!< Callbacks.
 
 //===== USER SOURCE =====//
 #include "Config.hpp"
+#include "SmallBuff.hpp"
 
 
 namespace MbeddedNinja
@@ -58,6 +63,11 @@ namespace MbeddedNinja
 				//! @details	'\r' and '\n' are common choices for this value. Set in the constructor.
 				char endOfCmdChar;
 
+				//! @brief		Called once for each command that is discarded because it is longer than the buffer.
+				//! @details	Only used when early rejection is on (see SetEarlyRejection()), otherwise long commands are
+				//!				truncated. The one parameter is this RxBuff.
+				MCallbacks::Callback<void, RxBuff*> overflowCallback;
+
 				//===============================================================================================//
 				//==================================== CONSTRUCTORS/DESTRUCTOR ==================================//
 				//===============================================================================================//
@@ -68,20 +78,77 @@ namespace MbeddedNinja
 				//! @param		endOfCmdChar	Set to the character you want to use for end-of-command recognition. When this command is
 				//!								detected in the input buffer, the command is send to the Clide::Rx object for processing.
 				//!								Can be changed by writing to RxBuff::endOfCmdChar.
+				//! @note		The buffer is clide_RX_BUFF_SIZE characters long, and is allocated on the heap. Use the other
+				//!				constructor (or StaticRxBuff) to choose the size and where the buffer lives.
 				RxBuff(Rx* rxController, char endOfCmdChar);
 
+				//! @brief		Constructor which uses a buffer provided by the caller.
+				//! @param		buff		The buffer. Must persist for as long as the RxBuff does.
+				//! @param		buffSize	The number of characters in buff, at least 2. Also the longest command RxBuff accepts.
+				RxBuff(Rx* rxController, char endOfCmdChar, char* buff, size_t buffSize);
+
+				//! @brief		Destructor. Frees the buffer if it was allocated by the constructor.
+				~RxBuff();
+
+				//! @brief		Copying is not supported, the buffer may be owned by the RxBuff.
+				RxBuff(const RxBuff&) = delete;
+				RxBuff& operator=(const RxBuff&) = delete;
+
 				//===============================================================================================//
 				//======================================= PUBLIC METHODS ========================================//
 				//===============================================================================================//
 
 				//! @brief		Write a single character to the RxBuff.
-				//! @sa			WriteString()
+				//! @sa			WriteString(), WriteBytes()
 				bool WriteChar(const char character);
 
 				//! @brief		Writes a null-terminated string of characters to the RxBuff.
-				//! @sa			WriteChar()
+				//! @sa			WriteChar(), WriteBytes()
 				bool WriteString(const char* characters);
 
+				//! @brief		Writes a chunk of characters (e.g. from a DMA buffer) to the RxBuff, running every complete command in it.
+				//! @details	Commands that are completely inside the chunk are passed straight to Rx::Run() without being copied.
+				//!				Only the start of a command that is not finished by the end of the chunk is kept in the buffer.
+				//! @param		bytes		The characters. Do not need to be null-terminated, and can contain null characters.
+				//! @param		numBytes	The number of characters.
+				//! @returns	false if a command was longer than the buffer (it is truncated), otherwise true.
+				//! @sa			WriteChar(), WriteString()
+				bool WriteBytes(const char* bytes, size_t numBytes);
+
+				//! @brief		Returns the size of the buffer, which is the longest command RxBuff accepts.
+				//! @note		In streaming mode, the longest command is one character shorter (see SetStreaming()).
+				size_t GetCapacity() const;
+
+				//! @brief		Returns the Rx that commands are passed to.
+				Rx* GetRx() const;
+
+				//! @brief		Turns streaming mode on or off.
+				//! @details	In streaming mode, commands are split into arguments (in place, in the buffer) and the command
+				//!				name is hashed and looked up while the characters are still arriving, so when the end-of-command
+				//!				character arrives the command is passed straight to Rx::RunArgs() without being scanned again.
+				//!				Commands that arrive whole in one WriteBytes() call are still passed to Rx::Run(), since there is
+				//!				no waiting to make use of. The splitting rules are the same as Rx::Run().
+				//!				One character of the buffer is kept for the null character that ends the last argument.
+				//! @note		Any partial command in the buffer is discarded, so call this between commands.
+				void SetStreaming(bool enable);
+
+				//! @brief		Returns true if streaming mode is on.
+				bool IsStreaming() const;
+
+				//! @brief		Turns early rejection on or off. Only used in streaming mode.
+				//! @details	With early rejection, a command is discarded (everything up to the next end-of-command character
+				//!				is ignored, without being buffered) as soon as:
+				//!				- the command name so far is not the start of any registered command name. It is reported
+				//!				  once, through Rx::cmdUnrecogCallback, with the characters received so far.
+				//!				- the command name has ended and it is not a registered command (reported the same way).
+				//!				- the command is longer than the buffer. It is reported once, through overflowCallback.
+				//!				This stops noise on a serial line from being buffered, split and looked up.
+				//!				Turning it on calls Comm::EnableCmdPrefixIndex() on the Rx.
+				void SetEarlyRejection(bool enable);
+
+				//! @brief		Returns true if early rejection is on.
+				bool IsRejectingEarly() const;
+
 			private:
 
 				//===============================================================================================//
@@ -92,21 +159,99 @@ namespace MbeddedNinja
 				Rx* rxController;
 
 				//! @brief		Rx buffer for storing characters sent to RxBuff by Write().
-				char buff[clide_RX_BUFF_SIZE];
+				char* buff;
+
+				//! @brief		The number of characters in buff.
+				size_t buffSize;
+
+				//! @brief		true if buff was allocated by the constructor (and so is freed by the destructor).
+				bool ownsBuff;
+
+				//! @brief		Pointer to current write location in buffer. Also the length of the partial command in the buffer.
+				size_t buffWritePos;
+
+				//! @brief		Where the streaming parser is in the partial command.
+				enum class StreamState
+				{
+					SKIPPING_START,		//!< Skipping the non-alphanumeric characters at the start of the command.
+					IN_ARG,				//!< Inside an argument.
+					BETWEEN_ARGS,		//!< Skipping the delimiters between arguments.
+					DISCARDING			//!< The command has been rejected, ignoring everything until the end-of-command character.
+				};
+
+				//! @brief		true if streaming mode is on.
+				bool streaming;
+
+				//! @brief		true if early rejection is on.
+				bool earlyRejection;
 
-				//! @brief		Pointer to current write location in buffer
-				uint8_t buffWritePos;
+				//! @brief		Where the streaming parser is in the partial command.
+				StreamState streamState;
+
+				//! @brief		true if the streaming parser is inside quotes (delimiters do not end the argument).
+				bool streamInsideQuotes;
+
+				//! @brief		The hash of the command name so far.
+				uint32_t streamCmdNameHash;
+
+				//! @brief		The command, once the command name has been received. NULL until then, and if it is not registered.
+				Cmd* streamCmd;
+
+				//! @brief		Pointers to the start of each argument in buff. Grows onto the heap for commands with many arguments,
+				//!				and stays grown.
+				SmallBuff<char*, clide_NUM_INLINE_ARGS + 1> streamArgA;
+
+				//! @brief		The number of arguments started so far.
+				uint32_t streamNumArgs;
 
 				//===============================================================================================//
 				//======================================= PRIVATE METHODS =======================================//
 				//===============================================================================================//
 
-				// none
+				//! @brief		Appends characters to the partial command in buff.
+				//! @returns	false if they did not all fit (as many as fit are appended), otherwise true.
+				bool Append(const char* bytes, size_t numBytes);
+
+				//! @brief		Runs the command in buff, once the end-of-command character has arrived.
+				void RunBuff();
+
+				//! @brief		Runs the streaming parser over the characters in buff from pos onwards.
+				void StreamScan(size_t pos);
+
+				//! @brief		Ends the argument the streaming parser is in. Looks up the command if it was the command name.
+				void StreamEndArg(size_t pos);
+
+				//! @brief		Clears the streaming parser state, ready for the next command.
+				void StreamReset();
+
+				//! @brief		Rejects the partial command. It is reported as not recognised, with the characters from the
+				//!				start of the command name up to (not including) buff[pos] as the name. Everything up to the next
+				//!				end-of-command character is discarded.
+				void StreamRejectCmd(size_t pos);
 
 		};
 
 
-		// none
+		//! @brief		An RxBuff whose buffer is part of the object, with the size chosen at compile time.
+		//! @details	e.g. a large buffer for a bulk-upload port and a small one for a console in the same program:
+		//!				StaticRxBuff<65536> uploadRxBuff(&uploadRx, '\n');
+		//!				StaticRxBuff<128> consoleRxBuff(&consoleRx, '\r');
+		template<size_t N>
+		class StaticRxBuff : public RxBuff
+		{
+			public:
+
+				//! @brief		Constructor.
+				StaticRxBuff(Rx* rxController, char endOfCmdChar) :
+					RxBuff(rxController, endOfCmdChar, storage, N)
+				{
+				}
+
+			private:
+
+				//! @brief		The buffer, only its address is used by the RxBuff constructor.
+				char storage[N];
+		};
 
 	} // namespace MClide
 } // namespace MbeddedNinja
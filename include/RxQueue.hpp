@@ -0,0 +1,180 @@
+//!
+//! @file 			RxQueue.hpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! @created		2026-10-16
+//! @last-modified 	2026-10-16
+//! @brief 			A lock-free single-producer/single-consumer byte queue in front of an RxBuff.
+//! @details
+//!					See README.rst in repo root dir for more info.
+
+#ifndef __cplusplus
+	#error Please build with C++ compiler
+#endif
+
+//===============================================================================================//
+//======================================== HEADER GUARD =========================================//
+//===============================================================================================//
+
+#ifndef MCLIDE_RX_QUEUE_H
+#define MCLIDE_RX_QUEUE_H
+
+//===============================================================================================//
+//==================================== FORWARD DECLARATION ======================================//
+//===============================================================================================//
+
+namespace MbeddedNinja
+{
+	namespace MClideNs
+	{
+		class RxQueue;
+	}
+}
+
+//===============================================================================================//
+//========================================== INCLUDES ===========================================//
+//===============================================================================================//
+
+//===== SYSTEM LIBRARIES =====//
+#include <stdint.h>
+#include <stddef.h>		// size_t
+#include <atomic>
+
+//===== USER SOURCE =====//
+#include "RxBuff.hpp"
+
+namespace MbeddedNinja
+{
+	namespace MClideNs
+	{
+
+		//! @brief		Passes characters from one thread (or interrupt/signal handler) to an RxBuff on another thread.
+		//! @details	The producer (e.g. a thread reading a tty, or a UART interrupt) only calls Write() or WriteChar(),
+		//!				which copy into a ring buffer and never block, call Rx or allocate, so a slow command callback
+		//!				can't hold up the reader. The consumer calls Drain() on its own thread, which passes everything in the
+		//!				ring to RxBuff::WriteBytes() (where commands are found and run). Lock-free, as long as std::atomic<uint32_t>
+		//!				is (it is on anything with 32-bit atomic loads and stores).
+		//! @note		Only one thread may write, and only one thread may drain.
+		class RxQueue
+		{
+
+			public:
+
+				//===============================================================================================//
+				//==================================== CONSTRUCTORS/DESTRUCTOR ==================================//
+				//===============================================================================================//
+
+				//! @brief		Constructor. The ring buffer is allocated on the heap.
+				//! @param		rxBuff		The RxBuff that Drain() writes to.
+				//! @param		size		The number of characters the ring holds. Must be a power of two.
+				RxQueue(RxBuff* rxBuff, uint32_t size);
+
+				//! @brief		Constructor which uses a ring buffer provided by the caller.
+				//! @param		rxBuff		The RxBuff that Drain() writes to.
+				//! @param		ring		The ring buffer. Must persist for as long as the RxQueue does.
+				//! @param		size		The number of characters in ring. Must be a power of two.
+				RxQueue(RxBuff* rxBuff, char* ring, uint32_t size);
+
+				//! @brief		Destructor. Frees the ring buffer if it was allocated by the constructor.
+				~RxQueue();
+
+				//! @brief		Copying is not supported, the ring buffer may be owned by the RxQueue.
+				RxQueue(const RxQueue&) = delete;
+				RxQueue& operator=(const RxQueue&) = delete;
+
+				//===============================================================================================//
+				//===================================== PRODUCER METHODS ========================================//
+				//===============================================================================================//
+
+				//! @brief		Adds characters to the queue. Only call from the producer.
+				//! @details	Never blocks. Characters that do not fit are dropped (and counted, see GetNumDropped()).
+				//! @returns	The number of characters added.
+				uint32_t Write(const char* bytes, uint32_t numBytes);
+
+				//! @brief		Adds one character to the queue. Only call from the producer.
+				//! @returns	false if the queue was full (the character is dropped), otherwise true.
+				bool WriteChar(char character);
+
+				//===============================================================================================//
+				//===================================== CONSUMER METHODS ========================================//
+				//===============================================================================================//
+
+				//! @brief		Writes everything in the queue to the RxBuff, which runs every complete command. Only call from
+				//!				the consumer.
+				//! @returns	The number of characters drained.
+				uint32_t Drain();
+
+				//===============================================================================================//
+				//======================================= OTHER METHODS =========================================//
+				//===============================================================================================//
+
+				//! @brief		Returns the number of characters in the queue. Can be called from either side.
+				uint32_t GetNumQueued() const;
+
+				//! @brief		Returns the number of characters the ring holds.
+				uint32_t GetCapacity() const;
+
+				//! @brief		Returns the number of characters dropped because the queue was full. Can be called from either side.
+				uint32_t GetNumDropped() const;
+
+			private:
+
+				//===============================================================================================//
+				//================================== PRIVATE VARIABLES/STRUCTURES ===============================//
+				//===============================================================================================//
+
+				//! @brief		The RxBuff that Drain() writes to.
+				RxBuff* rxBuff;
+
+				//! @brief		The ring buffer.
+				char* ring;
+
+				//! @brief		The number of characters in ring, a power of two.
+				uint32_t size;
+
+				//! @brief		true if ring was allocated by the constructor (and so is freed by the destructor).
+				bool ownsRing;
+
+				//! @brief		The number of characters ever written, only written by the producer. Wraps around.
+				//! @details	On its own cache line, so the producer and consumer do not slow each other down.
+				alignas(64) std::atomic<uint32_t> writeCount;
+
+				//! @brief		The producer's last read of readCount, so it only has to read readCount (from the consumer's
+				//!				cache line) when the queue looks full.
+				uint32_t cachedReadCount;
+
+				//! @brief		The number of characters dropped because the queue was full, only written by the producer.
+				std::atomic<uint32_t> numDropped;
+
+				//! @brief		The number of characters ever drained, only written by the consumer. Wraps around.
+				alignas(64) std::atomic<uint32_t> readCount;
+
+		};
+
+
+		//! @brief		An RxQueue whose ring buffer is part of the object, with the size chosen at compile time.
+		//! @tparam		N		The number of characters the ring holds. Must be a power of two.
+		template<uint32_t N>
+		class StaticRxQueue : public RxQueue
+		{
+			public:
+
+				static_assert((N != 0) && ((N & (N - 1)) == 0), "StaticRxQueue size must be a power of two.");
+
+				//! @brief		Constructor.
+				StaticRxQueue(RxBuff* rxBuff) :
+					RxQueue(rxBuff, storage, N)
+				{
+				}
+
+			private:
+
+				//! @brief		The ring buffer, only its address is used by the RxQueue constructor.
+				char storage[N];
+		};
+
+	} // namespace MClide
+} // namespace MbeddedNinja
+
+#endif	// #ifndef MCLIDE_RX_QUEUE_H
+
+// EOF
@@ -0,0 +1,166 @@
+//!
+//! @file 			SmallBuff.hpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! @created		2026-10-16
+//! @last-modified 	2026-10-16
+//! @brief 			An array which lives on the stack while small, and spills to a ParseArena (or the heap) when it grows.
+//! @details
+//!					See README.rst in repo root dir for more info.
+
+#ifndef __cplusplus
+	#error Please build with C++ compiler
+#endif
+
+//===============================================================================================//
+//======================================== HEADER GUARD =========================================//
+//===============================================================================================//
+
+#ifndef MCLIDE_SMALL_BUFF_H
+#define MCLIDE_SMALL_BUFF_H
+
+//===============================================================================================//
+//========================================== INCLUDES ===========================================//
+//===============================================================================================//
+
+//===== SYSTEM LIBRARIES =====//
+#include <stdint.h>
+#include <stddef.h>		// size_t
+#include <string.h>		// memcpy()
+
+//===== USER LIBRARIES =====//
+#include "MAssert/api/MAssertApi.hpp"
+
+//===== USER SOURCE =====//
+#include "ParseArena.hpp"
+
+namespace MbeddedNinja
+{
+	namespace MClideNs
+	{
+
+		//! @brief		Array with room for N elements inline (e.g. on the stack), which can grow past N.
+		//! @details	When grown, the elements move to the arena (if one was given and it has room), otherwise to the heap.
+		//!				Arena memory is freed when the arena is released, heap memory when the SmallBuff is destroyed.
+		//!				T must be a plain type (it is copied with memcpy() and never constructed/destructed).
+		//! @tparam		T		The element type.
+		//! @tparam		N		The number of elements stored inline.
+		template <typename T, uint32_t N>
+		class SmallBuff
+		{
+
+			public:
+
+				//===============================================================================================//
+				//==================================== CONSTRUCTORS/DESTRUCTOR ==================================//
+				//===============================================================================================//
+
+				//! @brief		Constructor.
+				//! @param		arena		Where to grow to before using the heap. Can be NULL.
+				explicit SmallBuff(ParseArena* arena = NULL)
+				{
+					this->data = this->inlineA;
+					this->capacity = N;
+					this->arena = arena;
+					this->heapData = NULL;
+				}
+
+				//! @brief		Destructor. Frees heap memory, if used.
+				~SmallBuff()
+				{
+					delete[] this->heapData;
+				}
+
+				//! @brief		Copying is not supported, data may point at the inline elements.
+				SmallBuff(const SmallBuff&) = delete;
+				SmallBuff& operator=(const SmallBuff&) = delete;
+
+				//===============================================================================================//
+				//========================================= PUBLIC METHODS ======================================//
+				//===============================================================================================//
+
+				//! @brief		Makes sure there is room for at least newCapacity elements. Existing elements are kept.
+				void Reserve(uint32_t newCapacity)
+				{
+					if(newCapacity <= this->capacity)
+						return;
+
+					T* newData = NULL;
+					if(this->arena != NULL)
+						newData = (T*)this->arena->Alloc(sizeof(T)*newCapacity, alignof(T));
+
+					T* newHeapData = NULL;
+					if(newData == NULL)
+					{
+						// Arena full (or no arena), fall back to the heap
+						newHeapData = new T[newCapacity];
+						M_ASSERT(newHeapData);
+						newData = newHeapData;
+					}
+
+					memcpy(newData, this->data, sizeof(T)*this->capacity);
+
+					delete[] this->heapData;
+					this->heapData = newHeapData;
+					this->data = newData;
+					this->capacity = newCapacity;
+				}
+
+				//! @brief		Returns a pointer to the first element.
+				T* Data()
+				{
+					return this->data;
+				}
+
+				//! @brief		Returns a pointer to the first element.
+				const T* Data() const
+				{
+					return this->data;
+				}
+
+				//! @brief		Returns the number of elements there is room for.
+				uint32_t Capacity() const
+				{
+					return this->capacity;
+				}
+
+				//! @brief		Element access. No bounds checking.
+				T& operator[](uint32_t index)
+				{
+					return this->data[index];
+				}
+
+				//! @brief		Element access. No bounds checking.
+				const T& operator[](uint32_t index) const
+				{
+					return this->data[index];
+				}
+
+			private:
+
+				//===============================================================================================//
+				//================================== PRIVATE VARIABLES/STRUCTURES ===============================//
+				//===============================================================================================//
+
+				//! @brief		The inline elements, used until the buffer grows past N.
+				T inlineA[N];
+
+				//! @brief		Points to the elements (inlineA, arena memory or heapData).
+				T* data;
+
+				//! @brief		The number of elements data has room for.
+				uint32_t capacity;
+
+				//! @brief		Where to grow to first. Can be NULL.
+				ParseArena* arena;
+
+				//! @brief		Heap memory, if the buffer had to grow onto the heap, otherwise NULL.
+				T* heapData;
+
+		};
+
+	} // namespace MClide
+} // namespace MbeddedNinja
+
+#endif	// #ifndef MCLIDE_SMALL_BUFF_H
+
+// EOF
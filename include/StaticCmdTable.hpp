@@ -0,0 +1,303 @@
+//!
+//! @file 			StaticCmdTable.hpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! @created		2026-10-17
+//! @last-modified 	2026-10-17
+//! @brief 			A command table that is declared constexpr, so it is built by the compiler and placed in read-only
+//!					memory (see StaticRx).
+//! @details
+//!					See README.rst in repo root dir for more info.
+
+#ifndef __cplusplus
+	#error Please build with C++ compiler
+#endif
+
+//===============================================================================================//
+//======================================== HEADER GUARD =========================================//
+//===============================================================================================//
+
+#ifndef MCLIDE_STATIC_CMD_TABLE_H
+#define MCLIDE_STATIC_CMD_TABLE_H
+
+//===============================================================================================//
+//==================================== FORWARD DECLARATION ======================================//
+//===============================================================================================//
+
+namespace MbeddedNinja
+{
+	namespace MClideNs
+	{
+		struct StaticOption;
+		struct StaticParam;
+		struct StaticCmd;
+		class StaticParseResult;
+	}
+}
+
+//===============================================================================================//
+//========================================== INCLUDES ===========================================//
+//===============================================================================================//
+
+//===== SYSTEM LIBRARIES =====//
+#include <stdint.h>
+#include <stddef.h>		// size_t
+
+//===== USER SOURCE =====//
+#include "HashIndex.hpp"
+
+namespace MbeddedNinja
+{
+	namespace MClideNs
+	{
+
+		//===============================================================================================//
+		//=================================== COMPILE-TIME HELPERS ======================================//
+		//===============================================================================================//
+
+		//! @brief		A list of numbers, 0 to N - 1, used to fill the tables element by element.
+		template<uint32_t... nums>
+		struct StaticIndexSeq {};
+
+		//! @brief		Joins two lists, the second one shifted up by the length of the first.
+		template<typename Seq1, typename Seq2>
+		struct JoinStaticIndexSeq;
+
+		template<uint32_t... nums1, uint32_t... nums2>
+		struct JoinStaticIndexSeq<StaticIndexSeq<nums1...>, StaticIndexSeq<nums2...>>
+		{
+			typedef StaticIndexSeq<nums1..., (sizeof...(nums1) + nums2)...> Type;
+		};
+
+		//! @brief		Makes StaticIndexSeq<0, ..., count - 1>. Halves count each step, so it can make lists longer
+		//!				than the compiler's template nesting limit.
+		template<uint32_t count>
+		struct MakeStaticIndexSeq
+		{
+			typedef typename JoinStaticIndexSeq<
+				typename MakeStaticIndexSeq<count/2>::Type,
+				typename MakeStaticIndexSeq<count - count/2>::Type>::Type Type;
+		};
+
+		template<>
+		struct MakeStaticIndexSeq<0>
+		{
+			typedef StaticIndexSeq<> Type;
+		};
+
+		template<>
+		struct MakeStaticIndexSeq<1>
+		{
+			typedef StaticIndexSeq<0> Type;
+		};
+
+		//! @brief		Returns the length of a null-terminated string.
+		constexpr uint32_t StaticStrLen(const char* str)
+		{
+			return ((str == nullptr) || (*str == '\0')) ? 0 : 1 + StaticStrLen(str + 1);
+		}
+
+		//===============================================================================================//
+		//======================================== TABLE ENTRIES ========================================//
+		//===============================================================================================//
+
+		//! @brief		An option of a StaticCmd. The compile-time counterpart of Option.
+		struct StaticOption
+		{
+			//! @brief		Constructor.
+			//! @param		shortName			'\0' if the option only has a long name.
+			//! @param		longName			"" if the option only has a short name.
+			//! @param		associatedValue		true if the option is followed by a value (e.g. "-s 20").
+			constexpr StaticOption(char shortName, const char* longName, const char* description, bool associatedValue) :
+				shortName(shortName),
+				longName(longName),
+				longNameLen(StaticStrLen(longName)),
+				longNameHash(HashIndex::ConstHash(longName)),
+				description(description),
+				associatedValue(associatedValue)
+			{}
+
+			char shortName;
+			const char* longName;
+			uint32_t longNameLen;
+			//! @brief		HashIndex::Hash() of longName.
+			uint32_t longNameHash;
+			const char* description;
+			bool associatedValue;
+		};
+
+		//! @brief		A parameter of a StaticCmd. The compile-time counterpart of Param.
+		struct StaticParam
+		{
+			constexpr StaticParam(const char* description) :
+				description(description)
+			{}
+
+			const char* description;
+		};
+
+		//! @brief		One command in a StaticCmdTable. The compile-time counterpart of Cmd.
+		//! @details	Declare every StaticCmd, and the StaticOption and StaticParam arrays they point to, constexpr.
+		//!				The short option lookup table is built by the compiler.
+		struct StaticCmd
+		{
+			//! @brief		The number of elements in shortOptionIndexA (one for each 7-bit ASCII character).
+			static constexpr uint32_t NUM_SHORT_OPTION_INDEXES = 128;
+
+			//! @brief		Constructor for a command with no options or parameters.
+			//! @param		callback		Called with what was received. Can be nullptr.
+			constexpr StaticCmd(const char* name, const char* description, bool (*callback)(const StaticParseResult& result)) :
+				StaticCmd(name, description, callback, nullptr, 0, nullptr, 0,
+						MakeStaticIndexSeq<NUM_SHORT_OPTION_INDEXES>::Type())
+			{}
+
+			//! @brief		Constructor for a command with options.
+			template<size_t numOptions>
+			constexpr StaticCmd(const char* name, const char* description, bool (*callback)(const StaticParseResult& result),
+					const StaticOption (&optionA)[numOptions]) :
+				StaticCmd(name, description, callback, optionA, numOptions, nullptr, 0,
+						MakeStaticIndexSeq<NUM_SHORT_OPTION_INDEXES>::Type())
+			{
+				static_assert(numOptions < 255, "A StaticCmd can have at most 254 options.");
+			}
+
+			//! @brief		Constructor for a command with parameters.
+			template<size_t numParams>
+			constexpr StaticCmd(const char* name, const char* description, bool (*callback)(const StaticParseResult& result),
+					const StaticParam (&paramA)[numParams]) :
+				StaticCmd(name, description, callback, nullptr, 0, paramA, numParams,
+						MakeStaticIndexSeq<NUM_SHORT_OPTION_INDEXES>::Type())
+			{}
+
+			//! @brief		Constructor for a command with options and parameters.
+			template<size_t numOptions, size_t numParams>
+			constexpr StaticCmd(const char* name, const char* description, bool (*callback)(const StaticParseResult& result),
+					const StaticOption (&optionA)[numOptions], const StaticParam (&paramA)[numParams]) :
+				StaticCmd(name, description, callback, optionA, numOptions, paramA, numParams,
+						MakeStaticIndexSeq<NUM_SHORT_OPTION_INDEXES>::Type())
+			{
+				static_assert(numOptions < 255, "A StaticCmd can have at most 254 options.");
+			}
+
+			const char* name;
+			uint32_t nameLen;
+			//! @brief		HashIndex::Hash() of name.
+			uint32_t nameHash;
+			const char* description;
+			bool (*callback)(const StaticParseResult& result);
+			const StaticOption* optionA;
+			uint32_t numOptions;
+			const StaticParam* paramA;
+			uint32_t numParams;
+
+			//! @brief		Maps a short option character to 1 plus the index of the option in optionA, or 0 if there
+			//!				is no option with that short name. The first option with a short name wins.
+			uint8_t shortOptionIndexA[NUM_SHORT_OPTION_INDEXES];
+
+			private:
+
+			template<uint32_t... chars>
+			constexpr StaticCmd(const char* name, const char* description, bool (*callback)(const StaticParseResult& result),
+					const StaticOption* optionA, uint32_t numOptions, const StaticParam* paramA, uint32_t numParams,
+					StaticIndexSeq<chars...>) :
+				name(name),
+				nameLen(StaticStrLen(name)),
+				nameHash(HashIndex::ConstHash(name)),
+				description(description),
+				callback(callback),
+				optionA(optionA),
+				numOptions(numOptions),
+				paramA(paramA),
+				numParams(numParams),
+				shortOptionIndexA{ FindShortOption(optionA, (char)chars, 0, numOptions)... }
+			{}
+
+			//! @brief		Returns 1 plus the index of the first option in optionA[first, last) with the short name c,
+			//!				or 0. '\0' is never a short name.
+			static constexpr uint8_t FindShortOption(const StaticOption* optionA, char c, uint32_t first, uint32_t last)
+			{
+				return ((c == '\0') || (first == last)) ? 0 :
+					(optionA[first].shortName == c) ? (uint8_t)(first + 1) :
+					FindShortOption(optionA, c, first + 1, last);
+			}
+		};
+
+		//===============================================================================================//
+		//========================================= COMMAND TABLE =======================================//
+		//===============================================================================================//
+
+		//! @brief		Returns the number of hash buckets for a table of numCmds commands (a power of two, at least
+		//!				numCmds).
+		constexpr uint32_t StaticCmdTableNumBuckets(uint32_t numCmds, uint32_t numBuckets = 1)
+		{
+			return (numBuckets >= numCmds) ? numBuckets : StaticCmdTableNumBuckets(numCmds, numBuckets*2);
+		}
+
+		//! @brief		A table of commands, with a hash index of their names built by the compiler.
+		//! @details	Declare it constexpr from a constexpr array of StaticCmd, then pass it to StaticRx:
+		//!				@code
+		//!				constexpr StaticCmd cmdA[] = { StaticCmd("stop", "Stops.", &StopCallback), ... };
+		//!				constexpr StaticCmdTable<sizeof(cmdA)/sizeof(cmdA[0])> cmdTable(cmdA);
+		//!				@endcode
+		//!				The index chains the commands in each bucket together, so a lookup compares the received name
+		//!				with the (usually one) command in its bucket. If two commands have the same name, the first wins.
+		//!				The compiler's work grows with the square of the number of commands, which is fine for the few
+		//!				hundred commands a device has (use Rx for more).
+		template<size_t numCmds>
+		class StaticCmdTable
+		{
+			static_assert((numCmds > 0) && (numCmds < 0xFFFFu), "A StaticCmdTable must have between 1 and 65534 commands.");
+
+			public:
+
+				//! @brief		The number of elements in bucketA.
+				static constexpr uint32_t NUM_BUCKETS = StaticCmdTableNumBuckets(numCmds);
+
+				//! @brief		Constructor.
+				//! @param		cmdA		Must be constexpr (or at least outlive the table).
+				constexpr StaticCmdTable(const StaticCmd (&cmdA)[numCmds]) :
+					StaticCmdTable(cmdA, typename MakeStaticIndexSeq<NUM_BUCKETS>::Type(), typename MakeStaticIndexSeq<numCmds>::Type())
+				{}
+
+				//! @brief		The commands.
+				const StaticCmd* cmdA;
+
+				//! @brief		1 plus the index of the first command whose name hash is in each bucket, or 0 if none.
+				uint16_t bucketA[NUM_BUCKETS];
+
+				//! @brief		1 plus the index of the next command in the same bucket as each command, or 0 if none.
+				uint16_t nextA[numCmds];
+
+			private:
+
+				template<uint32_t... bucketNums, uint32_t... cmdNums>
+				constexpr StaticCmdTable(const StaticCmd* cmdA, StaticIndexSeq<bucketNums...>, StaticIndexSeq<cmdNums...>) :
+					cmdA(cmdA),
+					bucketA{ FindCmdInBucket(cmdA, bucketNums, 0, numCmds)... },
+					nextA{ FindCmdInBucket(cmdA, cmdA[cmdNums].nameHash & (NUM_BUCKETS - 1), cmdNums + 1, numCmds)... }
+				{}
+
+				//! @brief		Returns 1 plus the index of the first command in cmdA[first, last) in bucketNum, or 0.
+				//! @details	Splits the range in half each step, so the compiler's recursion depth only grows with
+				//!				the log of the number of commands.
+				static constexpr uint16_t FindCmdInBucket(const StaticCmd* cmdA, uint32_t bucketNum, uint32_t first, uint32_t last)
+				{
+					return (first >= last) ? 0 :
+						(last - first == 1) ? (((cmdA[first].nameHash & (NUM_BUCKETS - 1)) == bucketNum) ? (uint16_t)(first + 1) : 0) :
+						FindCmdInBucketAfter(FindCmdInBucket(cmdA, bucketNum, first, first + (last - first)/2),
+							cmdA, bucketNum, first + (last - first)/2, last);
+				}
+
+				//! @brief		Returns found if it is not 0, otherwise searches cmdA[first, last). Used by
+				//!				FindCmdInBucket() so the first half of a range is only searched once.
+				static constexpr uint16_t FindCmdInBucketAfter(uint16_t found, const StaticCmd* cmdA, uint32_t bucketNum, uint32_t first, uint32_t last)
+				{
+					return (found != 0) ? found : FindCmdInBucket(cmdA, bucketNum, first, last);
+				}
+		};
+
+	} // namespace MClide
+} // namespace MbeddedNinja
+
+#endif	// #ifndef MCLIDE_STATIC_CMD_TABLE_H
+
+// EOF
@@ -0,0 +1,139 @@
+//!
+//! @file 			StaticParseResult.hpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! @created		2026-10-17
+//! @last-modified 	2026-10-17
+//! @brief 			Holds what StaticRx found in one received command (detected options, option values and parameters).
+//! @details
+//!					See README.rst in repo root dir for more info.
+
+#ifndef __cplusplus
+	#error Please build with C++ compiler
+#endif
+
+//===============================================================================================//
+//======================================== HEADER GUARD =========================================//
+//===============================================================================================//
+
+#ifndef MCLIDE_STATIC_PARSE_RESULT_H
+#define MCLIDE_STATIC_PARSE_RESULT_H
+
+//===============================================================================================//
+//==================================== FORWARD DECLARATION ======================================//
+//===============================================================================================//
+
+namespace MbeddedNinja
+{
+	namespace MClideNs
+	{
+		class StaticParseResult;
+	}
+}
+
+//===============================================================================================//
+//========================================== INCLUDES ===========================================//
+//===============================================================================================//
+
+//===== SYSTEM LIBRARIES =====//
+#include <stdint.h>
+
+//===== USER SOURCE =====//
+#include "Config.hpp"
+#include "ParseArena.hpp"
+#include "SmallBuff.hpp"
+#include "StaticCmdTable.hpp"
+
+namespace MbeddedNinja
+{
+	namespace MClideNs
+	{
+
+		//! @brief		The result of parsing one received command, passed to StaticCmd::callback. The StaticRx
+		//!				counterpart of ParseResult.
+		//! @details	Options are referred to by their position in the command's StaticOption array, which is known
+		//!				when the table is written. Option values and parameters point into memory owned by
+		//!				StaticRx::Run(), so they are only valid until the callback returns.
+		class StaticParseResult
+		{
+
+			public:
+
+				//===============================================================================================//
+				//==================================== CONSTRUCTORS/DESTRUCTOR ==================================//
+				//===============================================================================================//
+
+				//! @brief		Constructor. No options detected and no parameters.
+				//! @param		cmd			The received command.
+				//! @param		arena		Where to store the option results if the command has more than
+				//!							clide_NUM_INLINE_OPTIONS options. Can be NULL.
+				StaticParseResult(const StaticCmd* cmd, ParseArena* arena);
+
+				//! @brief		Copying is not supported, option results may be stored inline.
+				StaticParseResult(const StaticParseResult&) = delete;
+				StaticParseResult& operator=(const StaticParseResult&) = delete;
+
+				//===============================================================================================//
+				//========================================= PUBLIC METHODS ======================================//
+				//===============================================================================================//
+
+				//! @brief		Returns the received command.
+				const StaticCmd* GetCmd() const;
+
+				//! @brief		Returns true if the option was received.
+				//! @param		optionNum		The position of the option in the command's StaticOption array.
+				bool IsDetected(uint32_t optionNum) const;
+
+				//! @brief		Returns the value the option was received with.
+				//! @param		optionNum		The position of the option in the command's StaticOption array.
+				//! @returns	The null-terminated value, or NULL if the option was not received or has no
+				//!				associated value.
+				const char* GetValue(uint32_t optionNum) const;
+
+				//! @brief		Returns the number of received parameters (always StaticCmd::numParams by the time the
+				//!				callback is called).
+				uint32_t GetNumParams() const;
+
+				//! @brief		Returns a received parameter, in the order they are in the command's StaticParam array.
+				//! @returns	The null-terminated parameter, or NULL if paramNum is out of range.
+				const char* GetParam(uint32_t paramNum) const;
+
+				//! @brief		Records that an option was received. Called by StaticRx.
+				//! @param		value		The option's value, or NULL if it has none.
+				void SetDetected(uint32_t optionNum, const char* value);
+
+				//! @brief		Records the received parameters. Called by StaticRx.
+				void SetParams(char* const* paramA, uint32_t numParams);
+
+			private:
+
+				//===============================================================================================//
+				//================================== PRIVATE VARIABLES/STRUCTURES ===============================//
+				//===============================================================================================//
+
+				//! @brief		What was received for one option.
+				struct OptionResult
+				{
+					bool isDetected;
+					const char* value;
+				};
+
+				//! @brief		The received command.
+				const StaticCmd* cmd;
+
+				//! @brief		One element for each of the command's options, in the same order as StaticCmd::optionA.
+				SmallBuff<OptionResult, clide_NUM_INLINE_OPTIONS> optionResultA;
+
+				//! @brief		The received parameters. Points into the argument buffer of StaticRx::Run().
+				char* const* paramA;
+
+				//! @brief		The number of elements in paramA.
+				uint32_t numParams;
+
+		};
+
+	} // namespace MClide
+} // namespace MbeddedNinja
+
+#endif	// #ifndef MCLIDE_STATIC_PARSE_RESULT_H
+
+// EOF
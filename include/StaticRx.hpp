@@ -0,0 +1,197 @@
+//!
+//! @file 			StaticRx.hpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! @created		2026-10-17
+//! @last-modified 	2026-10-17
+//! @brief 			Decodes received commands against a StaticCmdTable, which is built by the compiler.
+//! @details
+//!					See README.rst in repo root dir for more info.
+
+#ifndef __cplusplus
+	#error Please build with C++ compiler
+#endif
+
+//===============================================================================================//
+//======================================== HEADER GUARD =========================================//
+//===============================================================================================//
+
+#ifndef MCLIDE_STATIC_RX_H
+#define MCLIDE_STATIC_RX_H
+
+//===============================================================================================//
+//==================================== FORWARD DECLARATION ======================================//
+//===============================================================================================//
+
+namespace MbeddedNinja
+{
+	namespace MClideNs
+	{
+		class StaticCmdOptions;
+		class StaticRx;
+	}
+}
+
+//===============================================================================================//
+//========================================== INCLUDES ===========================================//
+//===============================================================================================//
+
+//===== SYSTEM LIBRARIES =====//
+#include <stdint.h>
+#include <stddef.h>		// size_t
+
+//===== USER SOURCE =====//
+#include "Config.hpp"
+#include "ParseArena.hpp"
+#include "PrintSink.hpp"
+#include "StaticCmdTable.hpp"
+#include "StaticParseResult.hpp"
+
+namespace MbeddedNinja
+{
+	namespace MClideNs
+	{
+
+		//! @brief		The options of a StaticCmd, for BasicOptionParser. Options are returned as their position in
+		//!				StaticCmd::optionA.
+		//! @details	Short options are found with the command's short option table. Long names are found by comparing
+		//!				the hash of the received name with the hashes the compiler worked out, which rules out most
+		//!				options without comparing any characters, but it does visit every option of the command (there
+		//!				is no long name index, since every StaticCmd is the same size whatever its number of options).
+		class StaticCmdOptions
+		{
+
+			public:
+
+				typedef uint32_t OptionRef;
+
+				//! @brief		Returned instead of an option number if there is no option.
+				static const uint32_t NOT_FOUND = 0xFFFFFFFFu;
+
+				//! @brief		Returned for the built-in help option ("-h" or "--help").
+				static const uint32_t HELP_OPTION = 0xFFFFFFFEu;
+
+				//! @brief		Constructor.
+				explicit StaticCmdOptions(const StaticCmd* cmd);
+
+				static uint32_t NoOption();
+
+				static uint32_t HelpOption();
+
+				//! @brief		Looks the option up in StaticCmd::shortOptionIndexA.
+				uint32_t FindShortOption(char shortName) const;
+
+				uint32_t FindLongOption(const char* name, uint32_t nameLen) const;
+
+				uint32_t GetNumOptions() const;
+
+				const char* GetLongName(uint32_t optionNum) const;
+
+				uint32_t GetOption(uint32_t optionNum) const;
+
+				bool HasValue(uint32_t optionNum) const;
+
+			private:
+
+				//! @brief		The recognised command.
+				const StaticCmd* cmd;
+
+		};
+
+		//! @brief		Decodes received commands against a StaticCmdTable. The compile-time counterpart of Rx.
+		//! @details	Nothing is registered at startup and nothing is allocated for the commands, the only state is
+		//!				a pointer to the table, the print sink and what is on the stack during Run(). Messages are
+		//!				split and options are parsed by the same parser as Rx in OptionParserMode::SINGLE_PASS
+		//!				(BasicOptionParser), including the built-in "-h"/"--help" option, which prints the command's
+		//!				help instead of calling its callback. There is no help command, and parameters are not
+		//!				converted (see ValueSpec). Like a frozen Rx, the same StaticRx can be run from multiple threads
+		//!				at once, as long as parseArena is not shared and printSink has no buffer.
+		class StaticRx
+		{
+
+			public:
+
+				//===============================================================================================//
+				//==================================== CONSTRUCTORS/DESTRUCTOR ==================================//
+				//===============================================================================================//
+
+				//! @brief		Constructor.
+				//! @param		cmdTable	Must persist while this object is used (declare it constexpr).
+				template<size_t numCmds>
+				StaticRx(const StaticCmdTable<numCmds>& cmdTable)
+				{
+					this->Init(cmdTable.cmdA, numCmds, cmdTable.bucketA, StaticCmdTable<numCmds>::NUM_BUCKETS, cmdTable.nextA);
+				}
+
+				//===============================================================================================//
+				//======================================= PUBLIC METHODS ========================================//
+				//===============================================================================================//
+
+				//! @brief		Decodes a null-terminated command message and calls the command's callback.
+				//! @details	The message is not modified, so it can be read-only.
+				//! @returns	true if a command was recognised and its callback called (or it has none).
+				bool Run(const char* cmdMsg);
+
+				//! @brief		Decodes a command message of cmdMsgLen characters (it doesn't need to be null-terminated).
+				bool Run(const char* cmdMsg, size_t cmdMsgLen);
+
+				//! @brief		Looks up a command by name in the table's hash index.
+				//! @param		cmdName		Does not need to be null-terminated.
+				//! @returns	The command, or NULL if there isn't one with that name.
+				const StaticCmd* FindCmd(const char* cmdName, uint32_t cmdNameLen) const;
+
+				//===============================================================================================//
+				//======================================= PUBLIC VARIABLES ======================================//
+				//===============================================================================================//
+
+				//! @brief		Where this object's command-line (responses) and error output goes.
+				PrintSink printSink;
+
+				//! @brief		Optional memory for messages with more than clide_NUM_INLINE_ARGS arguments, or commands
+				//!				with more than clide_NUM_INLINE_OPTIONS options. NULL (the default) uses the heap.
+				ParseArena* parseArena;
+
+			private:
+
+				//===============================================================================================//
+				//======================================= PRIVATE METHODS =======================================//
+				//===============================================================================================//
+
+				//! @brief		The non-template part of the constructor.
+				void Init(const StaticCmd* cmdA, uint32_t numCmds, const uint16_t* bucketA, uint32_t numBuckets, const uint16_t* nextA);
+
+				//! @brief		Run() without the flush.
+				bool RunMsg(const char* cmdMsg, size_t cmdMsgLen);
+
+				#if(clide_ENABLE_AUTO_HELP == 1)
+					//! @brief		Prints the description, parameters and options of a command, in the same layout as
+					//!				Comm::PrintHelpForCmd() (without text formatting).
+					void PrintHelpForCmd(const StaticCmd* cmd);
+				#endif
+
+				//===============================================================================================//
+				//================================== PRIVATE VARIABLES/STRUCTURES ===============================//
+				//===============================================================================================//
+
+				//! @brief		StaticCmdTable::cmdA.
+				const StaticCmd* cmdA;
+
+				//! @brief		The number of commands in cmdA.
+				uint32_t numCmds;
+
+				//! @brief		StaticCmdTable::bucketA.
+				const uint16_t* bucketA;
+
+				//! @brief		The number of elements in bucketA minus 1 (it is a power of two).
+				uint32_t bucketMask;
+
+				//! @brief		StaticCmdTable::nextA.
+				const uint16_t* nextA;
+
+		};
+
+	} // namespace MClide
+} // namespace MbeddedNinja
+
+#endif	// #ifndef MCLIDE_STATIC_RX_H
+
+// EOF
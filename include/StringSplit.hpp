@@ -2,7 +2,7 @@
 //! @file 			StringSplit.hpp
 //! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
 //! @created		2013-04-10
-//! @last-modified 	2014-10-07
+//! @last-modified 	2026-10-16
 //! @brief 			Features a string split function which ignores delimiters inside quotation marks.
 //! @details
 //!					See README.rst in the repo root dir for more info.
@@ -44,9 +44,13 @@ namespace MbeddedNinja
 		class StringSplit
 		{
 			public:
-				//! @brief		Based of strtok() function
-				//! @details	Calls Int();
-				static char* Run(char* s, const char* delim);
+				//! @brief		Based of strtok_r() function
+				//! @details	Calls Int(). The position in the string is remembered in *last (rather than in a
+				//!				static variable), so different strings can be split at the same time.
+				//! @param		s		Input string on the first call, NULL to continue splitting the same string.
+				//! @param		delim	Delimiters.
+				//! @param		last	Where the position in the string is saved between calls. Owned by the caller.
+				static char* Run(char* s, const char* delim, char** last);
 			private:
 				//! @brief		Internal function called by Run();
 				//! @details	Replaces "end of token" with null character and returns "start of token". Returns NULL
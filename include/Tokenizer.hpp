@@ -0,0 +1,90 @@
+//!
+//! @file 			Tokenizer.hpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! @created		2026-10-16
+//! @last-modified 	2026-10-16
+//! @brief 			Splits a command message into token views, without modifying or copying the message.
+//! @details
+//!					See README.rst in the repo root dir for more info.
+
+#ifndef __cplusplus
+	#error Please build with C++ compiler
+#endif
+
+//===============================================================================================//
+//======================================== HEADER GUARD =========================================//
+//===============================================================================================//
+
+#ifndef MCLIDE_TOKENIZER_H
+#define MCLIDE_TOKENIZER_H
+
+//===============================================================================================//
+//==================================== FORWARD DECLARATION ======================================//
+//===============================================================================================//
+
+namespace MbeddedNinja
+{
+	namespace MClideNs
+	{
+		class Tokenizer;
+		struct TokenView;
+	}
+}
+
+//===============================================================================================//
+//========================================== INCLUDES ===========================================//
+//===============================================================================================//
+
+//===== SYSTEM LIBRARIES =====//
+#include <stdint.h>
+#include <stddef.h>		// size_t
+
+namespace MbeddedNinja
+{
+	namespace MClideNs
+	{
+
+		//! @brief		Describes one token in a message, as a position and length (a view into the message).
+		struct TokenView
+		{
+			//! @brief		The index of the first character of the token in the message.
+			uint32_t offset;
+
+			//! @brief		The number of characters in the token.
+			uint32_t length;
+		};
+
+		//! @brief		Splits a message into tokens, ignoring delimiters inside quotation marks.
+		//! @details	The same splitting rules as StringSplit, except that the message is read-only (nothing is
+		//!				written into it, so read-only or memory-mapped buffers can be parsed) and it does not have to
+		//!				be null-terminated. Quotation marks stay part of the token, e.g. 'a "b c"' is split into
+		//!				'a' and '"b c"'.
+		class Tokenizer
+		{
+			public:
+
+				//! @brief		The character which stops delimiters from splitting tokens, until it is seen again.
+				static const char QUOTE_CHAR = '\"';
+
+				//! @brief		Splits msg into tokens.
+				//! @param		msg				The message to split. Does not need to be null-terminated.
+				//! @param		msgLen			The number of characters in msg.
+				//! @param		delim			The delimiter character (e.g. ' ').
+				//! @param		tokenA			Array that the token views are written to.
+				//! @param		maxNumTokens	The number of elements in tokenA. Tokens past this are counted, but not written.
+				//! @returns	The number of tokens in msg. If this is larger than maxNumTokens, only the first maxNumTokens
+				//!				tokens have been written to tokenA.
+				static uint32_t Run(
+					const char* msg,
+					size_t msgLen,
+					char delim,
+					TokenView* tokenA,
+					uint32_t maxNumTokens);
+		};
+
+	} // namespace MClide
+} // namespace MbeddedNinja
+
+#endif	// #ifndef MCLIDE_TOKENIZER_H
+
+// EOF
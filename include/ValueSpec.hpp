@@ -0,0 +1,167 @@
+//!
+//! @file 			ValueSpec.hpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! @created		2026-10-17
+//! @last-modified 	2026-10-17
+//! @brief 			The type (and allowed range) of a parameter or option value, and the conversion to it.
+//! @details
+//!					See README.rst in repo root dir for more info.
+
+#ifndef __cplusplus
+	#error Please build with C++ compiler
+#endif
+
+//===============================================================================================//
+//======================================== HEADER GUARD =========================================//
+//===============================================================================================//
+
+#ifndef MCLIDE_VALUE_SPEC_H
+#define MCLIDE_VALUE_SPEC_H
+
+//===============================================================================================//
+//==================================== FORWARD DECLARATION ======================================//
+//===============================================================================================//
+
+namespace MbeddedNinja
+{
+	namespace MClideNs
+	{
+		class ValueSpec;
+	}
+}
+
+//===============================================================================================//
+//========================================== INCLUDES ===========================================//
+//===============================================================================================//
+
+//===== SYSTEM LIBRARIES =====//
+#include <stdint.h>
+#include <stddef.h>		// size_t
+
+namespace MbeddedNinja
+{
+	namespace MClideNs
+	{
+
+		//! @brief		The types a parameter or option value can be converted to.
+		enum class ValueType
+		{
+			STRING,		//!< Not converted, the value is only available as a string.
+			INT32,
+			UINT32,
+			INT64,
+			DOUBLE,
+			BOOL,		//!< "1", "0", "true", "false", "on", "off", "yes" or "no" (any case).
+			ENUM		//!< One of a list of names, converted to its index in the list.
+		};
+
+		//! @brief		A converted value. Which member is valid depends on the ValueType it was converted to.
+		struct Value
+		{
+			union
+			{
+				int32_t int32;
+				uint32_t uint32;
+				int64_t int64;
+				double float64;
+				bool boolean;
+				uint32_t enumIndex;
+			};
+		};
+
+		//! @brief		The type of a parameter or option value, and the range it must be in (see Param::valueSpec
+		//!				and Option::valueSpec).
+		//! @details	Rx converts typed values as it parses the command, and rejects the command (with an error
+		//!				response, before any of its callbacks are called) if one is not valid or out of range.
+		//!				Create with one of the static methods, e.g. ValueSpec::Int32(0, 5000).
+		class ValueSpec
+		{
+
+			public:
+
+				//===============================================================================================//
+				//==================================== PUBLIC VARIABLES/STRUCTURES ==============================//
+				//===============================================================================================//
+
+				//! @brief		The result of Convert().
+				enum class Status
+				{
+					OK,
+					INVALID,			//!< Not a value of this type.
+					OUT_OF_RANGE		//!< A value of this type, but not within [min, max].
+				};
+
+				//! @brief		The type to convert to.
+				ValueType type;
+
+				//! @brief		The smallest and largest allowed value, for INT32, UINT32 and INT64.
+				int64_t minInt;
+				int64_t maxInt;
+
+				//! @brief		The smallest and largest allowed value, for DOUBLE.
+				double minDouble;
+				double maxDouble;
+
+				//! @brief		The allowed names, for ENUM. Must persist for as long as the ValueSpec is used.
+				const char* const* enumNameA;
+
+				//! @brief		The number of names in enumNameA.
+				uint32_t numEnumNames;
+
+				//===============================================================================================//
+				//==================================== CONSTRUCTORS/DESTRUCTOR ==================================//
+				//===============================================================================================//
+
+				//! @brief		Constructor. The value is not converted (ValueType::STRING).
+				ValueSpec();
+
+				//===============================================================================================//
+				//======================================= PUBLIC METHODS ========================================//
+				//===============================================================================================//
+
+				static ValueSpec Int32(int32_t min = INT32_MIN, int32_t max = INT32_MAX);
+				static ValueSpec UInt32(uint32_t min = 0, uint32_t max = UINT32_MAX);
+				static ValueSpec Int64(int64_t min = INT64_MIN, int64_t max = INT64_MAX);
+				static ValueSpec Double(double min, double max);
+				static ValueSpec Double();
+				static ValueSpec Bool();
+
+				//! @param		enumNameA		The allowed names. Must persist for as long as the ValueSpec is used.
+				//! @param		numEnumNames	The number of names in enumNameA.
+				static ValueSpec Enum(const char* const* enumNameA, uint32_t numEnumNames);
+
+				//! @brief		Converts a null-terminated string to this type.
+				//! @details	The whole string must be the value (no leading or trailing spaces). Integers are decimal,
+				//!				or hexadecimal with a "0x" prefix, with an optional sign.
+				//! @param		value		Set to the converted value if Status::OK is returned.
+				Status Convert(const char* str, Value* value) const;
+
+				//! @brief		Returns the name of the type, e.g. "int32", for error messages.
+				const char* GetTypeName() const;
+
+				//! @brief		Writes the allowed range (e.g. "0 to 5000") or names (e.g. "fast, slow") into buff.
+				//! @details	Truncated to fit buff, always null-terminated.
+				void GetRangeString(char* buff, size_t buffSize) const;
+
+				//! @brief		Converts a null-terminated decimal (or "0x" hexadecimal) integer, in a single pass and
+				//!				without using errno or the locale.
+				//! @param		value		Set to the converted value if Status::OK is returned.
+				//! @returns	Status::OUT_OF_RANGE if it does not fit in an int64_t.
+				static Status ParseInt64(const char* str, int64_t* value);
+
+				//! @brief		Converts a null-terminated double.
+				//! @details	Plain decimals (e.g. "2.5" or "-0.125") with no more than 15 digits are converted
+				//!				exactly without strtod(). Everything else (exponents, "inf", longer numbers) is
+				//!				passed to strtod().
+				//! @param		value		Set to the converted value if Status::OK is returned.
+				//! @returns	Status::OUT_OF_RANGE if strtod() reports ERANGE.
+				static Status ParseDouble(const char* str, double* value);
+
+		};
+
+	} // namespace MClide
+} // namespace MbeddedNinja
+
+#endif	// #ifndef MCLIDE_VALUE_SPEC_H
+
+// EOF
@@ -2,7 +2,7 @@
 //! @file 			Cmd.cpp
 //! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
 //! @created		2013-04-02
-//! @last-modified 	2014-10-09
+//! @last-modified 	2026-10-17
 //! @brief 			Command-line style communications protocol
 //! @details
 //!				See README.rst in repo root dir for more info.
@@ -20,7 +20,7 @@
 #include <stdio.h>		// snprintf()
 #include <stdlib.h>		// realloc(), malloc(), free()
 #include <cctype>		// isalnum() 
-#include <string.h>		// strlen()
+#include <string.h>		// strlen(), memset()
 #include <cinttypes>	// PRIu32
 
 //===== USER LIBRARIES =====//
@@ -28,11 +28,11 @@
 
 //===== USER SOURCE =====//
 #include "../include/Config.hpp"
-#include "../include/Global.hpp"
 #include "../include/Print.hpp"
 #include "../include/Option.hpp"
 #include "../include/Param.hpp"
 #include "../include/Cmd.hpp"
+#include "../include/Comm.hpp"
 
 
 namespace MbeddedNinja
@@ -40,6 +40,10 @@ namespace MbeddedNinja
 	namespace MClideNs
 	{
 
+		#if(clide_ENABLE_AUTO_HELP == 1)
+			const char* const Cmd::HELP_LONG_NAME = "help";
+		#endif
+
 		//===============================================================================================//
 		//======================================= PUBLIC METHODS ========================================//
 		//===============================================================================================//
@@ -88,6 +92,31 @@ namespace MbeddedNinja
 					Print::DebugPrintingLevel::VERBOSE);
 			#endif
 
+			// PARENT COMM OBJECT
+
+			// Set to null, this gets assigned when the command is registered.
+			// Will be either set to a Clide::Tx or Clide::Rx object. Must be set before
+			// any option is registered.
+			this->parentComm = NULL;
+			this->cmdNum = 0;
+
+			// HELP TEXT
+
+			// Rendered by the parent Comm object the first time it is asked for
+			this->helpText = NULL;
+
+			// RESULT CALLBACKS
+
+			// Assigned by the user after construction, if wanted
+			this->resultFunctionCallback = NULL;
+
+			// COMPILED OPTIONS
+
+			// Must be initialised before any option is registered
+			this->shortOptionString = NULL;
+			this->longOptionsA = NULL;
+			this->shortOptionIndexA = NULL;
+
 			// NAME
 
 			this->name = name;
@@ -96,28 +125,18 @@ namespace MbeddedNinja
 
 			this->description = description;
 
-			// HELP
+			// Make sure there are valid option tables, even if no options get registered. The
+			// built-in help option is recognised by the parsers, so nothing is registered for it.
+			this->CompileOptions();
 
 			#if(clide_ENABLE_AUTO_HELP == 1)
-				#if(clide_ENABLE_DEBUG_CODE == 1)
-					Print::PrintDebugInfo("CLIDE: Registering help option.\r\n", Print::DebugPrintingLevel::GENERAL);
-				#endif
-				// HELP OPTION
-				this->help = new Option('h', "help", NULL, "Prints help for the command.", false);
-
-				M_ASSERT(this->help);
-
-				this->RegisterOption(this->help);
+				// Creates the shared help option the first time a command is created, rather than during a parse
+				// (a frozen Rx never allocates in Run())
+				Cmd::GetHelpOption();
 			#endif
 
 			// DETECTED FLAG
-			this->isDetected = false;
-			
-			// PARENT COMM OBJECT
-
-			// Set to null, this gets assigned when the command is registered.
-			// Will be either set to a Clide::Tx or Clide::Rx object
-			this->parentComm = NULL;
+			this->detectedGeneration = 0;
 
 			#if(clide_ENABLE_DEBUG_CODE == 1)
 				// Description too long, do not save it
@@ -135,9 +154,10 @@ namespace MbeddedNinja
 						Print::DebugPrintingLevel::VERBOSE);
 			#endif
 
-			#if(clide_ENABLE_AUTO_HELP == 1)
-				delete this->help;
-			#endif
+			delete[] this->shortOptionString;
+			delete[] this->longOptionsA;
+			delete[] this->shortOptionIndexA;
+			delete[] this->helpText;
 
 		}
 		
@@ -149,11 +169,21 @@ namespace MbeddedNinja
 						Print::DebugPrintingLevel::VERBOSE);
 			#endif
 
+			if((this->parentComm != NULL) && this->parentComm->IsFrozen())
+			{
+				Print::PrintError("CLIDE: ERROR: Can't register a parameter once the command's Rx/Tx is frozen.\r\n");
+				return;
+			}
+
 			//this->numParams = 0;
 
 			// MALLOC
 			//this->paramA = (Param**)MemMang::AppendNewArrayElement(this->paramA, this->numParams, sizeof(Param*));
 			this->paramA.Append(param);
+
+			// Parameters are listed in the help
+			if(this->parentComm != NULL)
+				this->parentComm->InvalidateHelpCache();
 			/*
 			if(this->paramA == NULL)
 			{
@@ -172,7 +202,7 @@ namespace MbeddedNinja
 		}
 
 		// Register option
-		void Cmd::RegisterOption(Option* option)
+		OptionHandle Cmd::RegisterOption(Option* option)
 		{
 			#if(clide_ENABLE_DEBUG_CODE == 1)
 				// Description too long, do not save it
@@ -180,10 +210,31 @@ namespace MbeddedNinja
 						Print::DebugPrintingLevel::VERBOSE);
 			#endif
 
+			if((this->parentComm != NULL) && this->parentComm->IsFrozen())
+			{
+				Print::PrintError("CLIDE: ERROR: Can't register an option once the command's Rx/Tx is frozen.\r\n");
+				return OptionHandle();
+			}
+
 			// Create option pointer at end of option pointer array.
 			//this->optionA = (Option**)MemMang::AppendNewArrayElement(this->optionA, this->numOptions, sizeof(Option*));
 			this->optionA.Append(option);
 
+			// Option needs to know its command, it is only "detected" if it was found
+			// the last time this command was detected
+			option->parentCmd = this;
+
+			// Lets a ParseResult find the option's result without searching
+			option->index = this->optionA.Size() - 1;
+
+			// Options only change here, so this is the only place the getopt_long() inputs
+			// need to be rebuilt
+			this->CompileOptions();
+
+			// Options are listed in the help
+			if(this->parentComm != NULL)
+				this->parentComm->InvalidateHelpCache();
+
 			/*
 			if(this->optionA == NULL)
 			{
@@ -201,11 +252,13 @@ namespace MbeddedNinja
 			//optionA[this->numOptions - 1] = option;
 			
 			#if(clide_ENABLE_DEBUG_CODE == 1)
+				// On the stack, so that commands can be built on different threads at the same time
+				char debugBuff[clide_DEBUG_BUFF_SIZE];
 				if(optionA[this->optionA.Size() - 1]->shortName != '\0')
 				{
 					snprintf(
-						Global::debugBuff,
-						sizeof(Global::debugBuff),
+						debugBuff,
+						sizeof(debugBuff),
 						"CLIDE: Option short name = '%c'. Option long name = '%s'.\r\n",
 						optionA[this->optionA.Size() - 1]->shortName,
 						optionA[this->optionA.Size() - 1]->longName.cStr);
@@ -213,21 +266,45 @@ namespace MbeddedNinja
 				else
 				{
 					snprintf(
-						Global::debugBuff,
-						sizeof(Global::debugBuff),
+						debugBuff,
+						sizeof(debugBuff),
 						"CLIDE: Option short name = '%s'. Option long name = '%s'.\r\n",
 						"none",
 						optionA[this->optionA.Size() - 1]->longName.cStr);
 				}
 
-				Print::PrintDebugInfo(Global::debugBuff,
+				Print::PrintDebugInfo(debugBuff,
 						Print::DebugPrintingLevel::VERBOSE);
 
 			#endif
+
+			return OptionHandle(option->index);
+		}
+
+		Option* Cmd::GetOption(OptionHandle optionHandle) const
+		{
+			if(optionHandle.index >= this->optionA.Size())
+				return NULL;
+
+			return this->optionA[optionHandle.index];
 		}
 
-		Option* Cmd::FindOptionByShortName(char shortOptionName)
+		Option* Cmd::FindOptionByShortName(char shortOptionName) const
 		{
+			// '\0' means no short name, so never matches
+			uint8_t shortName = (uint8_t)shortOptionName;
+			if(shortName == 0)
+				return NULL;
+
+			// Only 7-bit ASCII names are in the table
+			if(shortName < NUM_SHORT_OPTION_INDEXES)
+			{
+				if((this->shortOptionIndexA == NULL) || (this->shortOptionIndexA[shortName] == 0))
+					return NULL;
+
+				return this->optionA[this->shortOptionIndexA[shortName] - 1];
+			}
+
 			for(uint32_t x = 0; x < this->optionA.Size(); x++)
 			{
 				if(this->optionA[x]->shortName == shortOptionName)
@@ -238,18 +315,33 @@ namespace MbeddedNinja
 			return NULL;
 		}
 
-		Option* Cmd::FindOptionByLongName(MString longOptionName)
+		Option* Cmd::FindOptionByLongName(const char* longOptionName) const
 		{
-			for(uint32_t x = 0; x < this->optionA.Size(); x++)
-			{
-				if(this->optionA[x]->longName == longOptionName)
-					return this->optionA[x];
-			}
+			if(longOptionName == NULL)
+				return NULL;
 
-			// Option must of not been found, so return NULL
-			return NULL;
+			uint32_t optionIndex = this->longOptionIndex.Find(longOptionName, (uint32_t)strlen(longOptionName));
+			if(optionIndex == HashIndex::NOT_FOUND)
+				return NULL;
+
+			return this->optionA[optionIndex];
 		}
 
+		Option* Cmd::FindOptionByLongName(const MString& longOptionName) const
+		{
+			return this->FindOptionByLongName(longOptionName.cStr);
+		}
+
+		#if(clide_ENABLE_AUTO_HELP == 1)
+			Option* Cmd::GetHelpOption()
+			{
+				// Created the first time it is needed, then shared by every command. It is never registered, so
+				// a ParseResult never has a result for it.
+				static Option helpOption(HELP_SHORT_NAME, HELP_LONG_NAME, NULL, "Prints help for the command.", false);
+				return &helpOption;
+			}
+		#endif
+
 		uint32_t Cmd::NumLongOptions()
 		{
 			#if(clide_ENABLE_DEBUG_CODE == 1)
@@ -268,12 +360,13 @@ namespace MbeddedNinja
 			}
 
 			#if(clide_ENABLE_DEBUG_CODE == 1)
+				char debugBuff[clide_DEBUG_BUFF_SIZE];
 				snprintf(
-					Global::debugBuff,
-					sizeof(Global::debugBuff),
+					debugBuff,
+					sizeof(debugBuff),
 					"CLIDE: Num. long options = '%" PRIu32 "'.\r\n",
 					numLongOptions);
-				Print::PrintDebugInfo(Global::debugBuff,
+				Print::PrintDebugInfo(debugBuff,
 						Print::DebugPrintingLevel::VERBOSE);
 			#endif
 
@@ -287,10 +380,31 @@ namespace MbeddedNinja
 						Print::DebugPrintingLevel::VERBOSE);
 			#endif
 
+			if((this->parentComm != NULL) && this->parentComm->IsFrozen())
+			{
+				Print::PrintError("CLIDE: ERROR: Can't add a command to a group once the command's Rx/Tx is frozen.\r\n");
+				return;
+			}
+
+			for(uint32_t x = 0; x < this->cmdGroupA.Size(); x++)
+			{
+				if(this->cmdGroupA[x] == cmdGroup)
+					return;
+			}
+
 			// Create option pointer at end of option pointer array.
 			//this->cmdGroupA = (CmdGroup**)MemMang::AppendNewArrayElement(this->cmdGroupA, this->numCmdGroups, sizeof(CmdGroup*));
 			this->cmdGroupA.Append(cmdGroup);
 
+			// Commands not registered yet are added to the index by Comm::RegisterCmd()
+			if(this->parentComm != NULL)
+			{
+				this->parentComm->AddCmdToGroupIndex(this, cmdGroup);
+
+				// Changes which group listings the command is in
+				this->parentComm->InvalidateHelpCache();
+			}
+
 			/*
 			if(this->cmdGroupA == NULL)
 			{
@@ -326,12 +440,185 @@ namespace MbeddedNinja
 			return this->cmdGroupA[cmdGroupNum];
 		}
 
+		bool Cmd::IsInGroup(const CmdGroup* cmdGroup) const
+		{
+			if(this->parentComm != NULL)
+				return this->IsInGroupId(this->parentComm->FindCmdGroupId(cmdGroup->name.cStr));
+
+			// Not registered, so there are no group IDs yet
+			for(uint32_t x = 0; x < this->cmdGroupA.Size(); x++)
+			{
+				if(strcmp(this->cmdGroupA[x]->name.cStr, cmdGroup->name.cStr) == 0)
+					return true;
+			}
+			return false;
+		}
+
+		bool Cmd::IsInGroupId(uint32_t cmdGroupId) const
+		{
+			uint32_t wordNum = cmdGroupId/32;
+			if(wordNum >= this->cmdGroupBitsA.Size())
+				return false;
+
+			return (this->cmdGroupBitsA[wordNum] & ((uint32_t)1 << (cmdGroupId%32))) != 0;
+		}
+
+		bool Cmd::IsDetected() const
+		{
+			// Detected only if stamped during the most recent parse of the Rx it is registered with
+			return (this->parentComm != NULL)
+				&& (this->detectedGeneration != 0)
+				&& (this->detectedGeneration == this->parentComm->parseGeneration);
+		}
+
 		//===============================================================================================//
 		//==================================== PRIVATE FUNCTIONS ========================================//
 		//===============================================================================================//
 
 		// none
 
+		//===============================================================================================//
+		//===================================== PROTECTED METHODS =======================================//
+		//===============================================================================================//
+
+		void Cmd::CompileOptions()
+		{
+			#if(clide_ENABLE_DEBUG_CODE == 1)
+				Print::PrintDebugInfo("CLIDE: Compiling option string and long option structure...\r\n",
+					Print::DebugPrintingLevel::VERBOSE);
+			#endif
+
+			uint32_t x;
+
+			// Work out the exact sizes first. Each short option needs one char, plus one more if it
+			// has an associated value (the ':'), plus the null char at the end.
+			uint32_t shortOptionStringLen = 0;
+			uint32_t numLongOptions = 0;
+
+			// The built-in help option goes first, so it is matched before any registered option
+			#if(clide_ENABLE_AUTO_HELP == 1)
+				shortOptionStringLen++;
+				numLongOptions++;
+			#endif
+
+			for(x = 0; x < this->optionA.Size(); x++)
+			{
+				if(this->optionA[x]->shortName != '\0')
+				{
+					shortOptionStringLen++;
+					if(this->optionA[x]->associatedValue == true)
+						shortOptionStringLen++;
+				}
+
+				if(this->optionA[x]->longName.GetLength() > 0)
+					numLongOptions++;
+			}
+
+			delete[] this->shortOptionString;
+			this->shortOptionString = new char[shortOptionStringLen + 1];
+			M_ASSERT(this->shortOptionString);
+
+			delete[] this->longOptionsA;
+			this->longOptionsA = new GetOpt::option[numLongOptions + 1];
+			M_ASSERT(this->longOptionsA);
+
+			// The option index tables are always the same size, so only allocate once
+			if(this->shortOptionIndexA == NULL)
+			{
+				this->shortOptionIndexA = new uint16_t[NUM_SHORT_OPTION_INDEXES];
+				M_ASSERT(this->shortOptionIndexA);
+			}
+			memset(this->shortOptionIndexA, 0, sizeof(uint16_t)*NUM_SHORT_OPTION_INDEXES);
+			this->longOptionIndex.Clear();
+
+			uint32_t optionStringPos = 0;
+			uint32_t longOptionIndex = 0;
+
+			#if(clide_ENABLE_AUTO_HELP == 1)
+				// getopt_long() returns HELP_SHORT_NAME for both "-h" and "--help"
+				this->shortOptionString[optionStringPos++] = HELP_SHORT_NAME;
+				this->longOptionsA[longOptionIndex].name = HELP_LONG_NAME;
+				this->longOptionsA[longOptionIndex].has_arg = no_argument;
+				this->longOptionsA[longOptionIndex].flag = NULL;
+				this->longOptionsA[longOptionIndex].val = HELP_SHORT_NAME;
+				longOptionIndex++;
+			#endif
+
+			for(x = 0; x < this->optionA.Size(); x++)
+			{
+				// SHORT OPTION
+
+				// Make sure short name exists
+				if(this->optionA[x]->shortName != '\0')
+				{
+					// Get character from each name
+					this->shortOptionString[optionStringPos++] = this->optionA[x]->shortName;
+					// Add ':' if option is expected with associated value
+					if(this->optionA[x]->associatedValue == true)
+						this->shortOptionString[optionStringPos++] = ':';
+
+					// Add to the short option table. The first option registered with a short name wins,
+					// the same as searching the short option string does. Non-ASCII short names are not indexed.
+					uint8_t shortName = (uint8_t)this->optionA[x]->shortName;
+					if((shortName < NUM_SHORT_OPTION_INDEXES)
+						&& (this->shortOptionIndexA[shortName] == 0)
+						&& (x < 0xFFFFu))
+					{
+						this->shortOptionIndexA[shortName] = (uint16_t)(x + 1);
+					}
+				}
+
+				// LONG OPTION
+
+				// If no long name in option, skip to next one
+				if(this->optionA[x]->longName.GetLength() == 0)
+					continue;
+
+				// 1) Name. Option persists while registered, so the pointer stays valid.
+				this->longOptionsA[longOptionIndex].name = this->optionA[x]->longName.cStr;
+
+				// 2) Has Argument?
+				// Optional argument not supported
+				if(this->optionA[x]->associatedValue)
+					this->longOptionsA[longOptionIndex].has_arg = required_argument;
+				else
+					this->longOptionsA[longOptionIndex].has_arg = no_argument;
+
+				// 3) Detected flag. Not used, getopt_long() returns val instead
+				this->longOptionsA[longOptionIndex].flag = NULL;
+
+				// 4) Value returned by getopt_long(). Encodes the option's index in optionA,
+				// so the option can be found without searching for it.
+				this->longOptionsA[longOptionIndex].val = LONG_OPTION_VAL_OFFSET + x;
+
+				// Add to the long option index. Again, the first option registered with a name wins.
+				this->longOptionIndex.Insert(this->optionA[x]->longName.cStr, this->optionA[x]->longName.GetLength(), x);
+
+				longOptionIndex++;
+			}
+
+			// Add null character to terminate string
+			this->shortOptionString[optionStringPos] = '\0';
+
+			// Zero-element at end of array
+			this->longOptionsA[longOptionIndex].name = 0;
+			this->longOptionsA[longOptionIndex].has_arg = 0;
+			this->longOptionsA[longOptionIndex].flag = 0;
+			this->longOptionsA[longOptionIndex].val = 0;
+
+			#if(clide_ENABLE_DEBUG_CODE == 1)
+				char debugBuff[clide_DEBUG_BUFF_SIZE];
+				snprintf(
+					debugBuff,
+					sizeof(debugBuff),
+					"CLIDE: Compiled option string = '%s'. Num. long options = '%" PRIu32 "'.\r\n",
+					this->shortOptionString,
+					numLongOptions);
+				Print::PrintDebugInfo(debugBuff,
+						Print::DebugPrintingLevel::VERBOSE);
+			#endif
+		}
+
 	} // namespace MClide
 } // namespace MbeddedNinja
 
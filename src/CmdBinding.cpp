@@ -0,0 +1,83 @@
+//!
+//! @file 			CmdBinding.cpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! @created		2026-10-17
+//! @last-modified 	2026-10-17
+//! @brief 			A command made from a plain function, with a typed parameter for each of its arguments (see Comm::Bind()).
+//! @details
+//!					See README.rst in repo root dir for more info.
+
+#ifndef __cplusplus
+	#error Please build with C++ compiler
+#endif
+
+//===============================================================================================//
+//========================================= INCLUDES ============================================//
+//===============================================================================================//
+
+//===== SYSTEM LIBRARIES =====//
+#include <stdint.h>
+
+//===== USER LIBRARIES =====//
+#include "MAssert/api/MAssertApi.hpp"
+#include "MCallbacks/api/MCallbacksApi.hpp"
+
+//===== USER SOURCE =====//
+#include "../include/CmdBinding.hpp"
+#include "../include/Cmd.hpp"
+#include "../include/Param.hpp"
+
+namespace MbeddedNinja
+{
+	namespace MClideNs
+	{
+
+		//===============================================================================================//
+		//======================================= PUBLIC METHODS ========================================//
+		//===============================================================================================//
+
+		CmdBinding::CmdBinding()
+		{
+			this->cmd = NULL;
+		}
+
+		CmdBinding::~CmdBinding()
+		{
+			delete this->cmd;
+
+			for(uint32_t x = 0; x < this->paramA.Size(); x++)
+				delete this->paramA[x];
+		}
+
+		void CmdBinding::Init(MString name, MString description, const ValueSpec* valueSpecA, uint32_t numParams)
+		{
+			this->cmd = new Cmd(name, NULL, description);
+			M_ASSERT(this->cmd);
+
+			for(uint32_t x = 0; x < numParams; x++)
+			{
+				// The type is the best description there is
+				Param* param = new Param(valueSpecA[x].GetTypeName());
+				M_ASSERT(param);
+				param->valueSpec = valueSpecA[x];
+				this->paramA.Append(param);
+				this->cmd->RegisterParam(param);
+			}
+
+			this->cmd->resultMethodCallback =
+				MCallbacks::CallbackGen<CmdBinding, void, const ParseResult&>(this, &CmdBinding::Invoke);
+		}
+
+		//===============================================================================================//
+		//======================================= PRIVATE METHODS =======================================//
+		//===============================================================================================//
+
+		void CmdBinding::Invoke(const ParseResult& result)
+		{
+			this->Call(result);
+		}
+
+	} // namespace MClide
+} // namespace MbeddedNinja
+
+// EOF
@@ -2,7 +2,7 @@
 //! @file 			Comm.cpp
 //! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
 //! @created		2013-12-18
-//! @last-modified 	2014-10-09
+//! @last-modified 	2026-10-17
 //! @brief			The base communications class. This is extended by both Clide::Tx and Clide::Rx which are the classes manipulated by the user.
 //! @details
 //!					See README.rst in repo root dir for more info.
@@ -44,6 +44,53 @@ namespace MbeddedNinja
 
 		using namespace std;
 
+		//! @brief		Collects everything a PrintSink is given for the command-line while it exists, so help can be
+		//!				rendered once and printed from a cache after that.
+		//! @details	The sink is put back as it was by Finish().
+		class HelpTextCapture
+		{
+			public:
+
+			HelpTextCapture(PrintSink& printSink) :
+				printSink(printSink)
+			{
+				// Anything already buffered belongs before the help
+				this->printSink.Flush();
+				this->prevPrintSink = this->printSink;
+
+				// Rendered even if the command-line output is off, the cached text is printed through the real sink
+				this->printSink.enableCmdLinePrinting = true;
+				this->printSink.SetBuffer(NULL, 0);
+				this->printSink.cmdLineWriteCallback =
+					MCallbacks::CallbackGen<HelpTextCapture, void, PrintChunk>(this, &HelpTextCapture::Write);
+			}
+
+			//! @brief		Puts the sink back.
+			//! @returns	The captured text, null-terminated and allocated with new[].
+			char* Finish()
+			{
+				this->printSink = this->prevPrintSink;
+
+				char* text = new char[this->chars.Size() + 1];
+				if(this->chars.Size() != 0)
+					memcpy(text, &this->chars[0], this->chars.Size());
+				text[this->chars.Size()] = '\0';
+				return text;
+			}
+
+			void Write(PrintChunk chunk)
+			{
+				for(size_t x = 0; x < chunk.numChars; x++)
+					this->chars.Append(chunk.chars[x]);
+			}
+
+			private:
+
+			PrintSink& printSink;
+			PrintSink prevPrintSink;
+			MVector<char> chars;
+		};
+
 		bool HelpCmdCallback(Cmd *cmd)
 		{
 
@@ -53,6 +100,12 @@ namespace MbeddedNinja
 			return true;
 		}
 
+		bool HelpCmdResultCallback(const ParseResult& result)
+		{
+			result.GetCmd()->parentComm->PrintHelp(result);
+			return true;
+		}
+
 		//===============================================================================================//
 		//====================================== PUBLIC METHODS ========================================//
 		//===============================================================================================//
@@ -60,7 +113,7 @@ namespace MbeddedNinja
 		Comm::Comm()
 		{
 			#if(clide_ENABLE_DEBUG_CODE == 1)
-				Print::PrintDebugInfo("CLIDE: Comm constructor called...\r\n",
+				this->printSink.PrintDebugInfo("CLIDE: Comm constructor called...\r\n",
 						Print::DebugPrintingLevel::GENERAL);
 			#endif
 
@@ -68,17 +121,33 @@ namespace MbeddedNinja
 			//this->numCmds = 0;
 			//this->cmdA = NULL;
 
+			// No parse has happened yet
+			this->parseGeneration = 0;
+
+			// Commands can be registered until frozen
+			this->isFrozen = false;
+
+			// Only built if asked for
+			this->cmdPrefixIndexEnabled = false;
+
+			// Help is rendered when first asked for
+			this->numCmdHelpTextsCached = 0;
+			this->helpCacheConfig = this->config;
+
 			// Create a CmdGroup object that all commands will belong to
 			this->cmdGroupAll = new CmdGroup("all", "All commands belong to this group.");
 
 			M_ASSERT(this->cmdGroupAll);
 
+			// Always group ID 0
+			this->InternCmdGroup(this->cmdGroupAll->name.cStr);
+
 			// Default command group points to "all", so that if this is not reassigned, when "help"
 			// is called, all commands will be printed.
 			this->defaultCmdGroup = this->cmdGroupAll;
 
 			#if(clide_ENABLE_DEBUG_CODE == 1)
-				Print::PrintDebugInfo("CLIDE: Comm constructor finished.\r\n",
+				this->printSink.PrintDebugInfo("CLIDE: Comm constructor finished.\r\n",
 						Print::DebugPrintingLevel::GENERAL);
 			#endif
 		}
@@ -87,21 +156,55 @@ namespace MbeddedNinja
 		{
 			// Free memory allocated in constructor
 			delete this->cmdGroupAll;
+
+			for(uint32_t x = 0; x < this->cmdGroupMembersA.Size(); x++)
+				delete this->cmdGroupMembersA[x];
+
+			// The commands free their own help text, they may already be gone
+			for(uint32_t x = 0; x < this->cmdListHelpCacheA.Size(); x++)
+			{
+				delete[] this->cmdListHelpCacheA[x]->text;
+				delete this->cmdListHelpCacheA[x];
+			}
+
+			for(uint32_t x = 0; x < this->cmdBindingA.Size(); x++)
+				delete this->cmdBindingA[x];
 		}
 
 		void Comm::RegisterCmd(Cmd* cmd)
 		{
+			if(this->isFrozen)
+			{
+				this->printSink.PrintError("CLIDE: ERROR: Can't register a command once the Rx/Tx is frozen.\r\n");
+				return;
+			}
+
 			// Save this Rx object as the parent object for this command. This is used
 			// for the automatically added help command.
 			cmd->parentComm = this;
 
-			// Add "all" command group to this command
-			cmd->AddToGroup(this->cmdGroupAll);
-
 			// Add new pointer to cmd object at end of array
 			//cmdA = (Cmd**)MemMang::AppendNewArrayElement(cmdA, numCmds, sizeof(Cmd*));
+			cmd->cmdNum = cmdA.Size();
 			cmdA.Append(cmd);
 
+			// Group IDs belong to this object, so index the groups the command was added to before it was registered
+			cmd->cmdGroupBitsA.Clear();
+			for(uint32_t x = 0; x < cmd->cmdGroupA.Size(); x++)
+				this->AddCmdToGroupIndex(cmd, cmd->cmdGroupA[x]);
+
+			// Add "all" command group to this command
+			cmd->AddToGroup(this->cmdGroupAll);
+
+			// Add to the name index, so Rx can find the command in O(1). If a command with the same
+			// name is already registered, the first one keeps winning (as it did with a linear search).
+			this->cmdIndex.Insert(cmd->name.cStr, cmd->name.GetLength(), this->cmdA.Size() - 1);
+
+			if(this->cmdPrefixIndexEnabled)
+				this->AddToCmdPrefixIndex(cmd);
+
+			this->InvalidateHelpCache();
+
 			// Increment command count
 			//numCmds++;
 
@@ -110,6 +213,22 @@ namespace MbeddedNinja
 
 		}
 
+		Cmd* Comm::RegisterCmdBinding(CmdBinding* cmdBinding, MString name, MString description,
+				const ValueSpec* valueSpecA, uint32_t numParams)
+		{
+			if(this->isFrozen)
+			{
+				this->printSink.PrintError("CLIDE: ERROR: Can't bind a command once the Rx/Tx is frozen.\r\n");
+				delete cmdBinding;
+				return NULL;
+			}
+
+			cmdBinding->Init(name, description, valueSpecA, numParams);
+			this->cmdBindingA.Append(cmdBinding);
+			this->RegisterCmd(cmdBinding->cmd);
+			return cmdBinding->cmd;
+		}
+
 		void Comm::RemoveCmd(Cmd* cmd)
 		{
 			// Remove description
@@ -124,13 +243,10 @@ namespace MbeddedNinja
 		void Comm::PrintHelp(Cmd* cmd)
 		{
 			#if(clide_ENABLE_DEBUG_CODE == 1)
-				Print::PrintDebugInfo("CLIDE: Print help function called.\r\n",
+				this->printSink.PrintDebugInfo("CLIDE: Print help function called.\r\n",
 						Print::DebugPrintingLevel::GENERAL);
 			#endif
 
-			// Temp buffer for printf() calls in this function
-			char tempBuff[100];
-
 			//========== FIND SELECTED GROUP ==========//
 
 			// Points to the selected group
@@ -139,12 +255,11 @@ namespace MbeddedNinja
 			// Default group if none provided (help)
 			selectedGroup = this->defaultCmdGroup->name.cStr;
 
-			//if(cmd->optionA[1]->isDetected == true)
-			if(cmd->FindOptionByShortName('g') != nullptr)
+			Option* groupOption = cmd->FindOptionByShortName('g');
+			if((groupOption != nullptr) && groupOption->IsDetected())
 			{
-				if(cmd->FindOptionByShortName('g')->isDetected)
-					// Group option has been provided with help command (help -g groupName)
-					selectedGroup = cmd->optionA[1]->value.cStr;
+				// Group option has been provided with help command (help -g groupName)
+				selectedGroup = groupOption->value.cStr;
 			}
 
 			//============= DETERMINE IF HELP HEADER IS TO BE PRINTED ===========//
@@ -153,233 +268,469 @@ namespace MbeddedNinja
 			bool printHeader = true;
 
 			// First check to make sure the option is registered with the command
-			if(cmd->FindOptionByLongName(config_NO_HELP_HEADER_OPTION_NAME) != nullptr)
+			Option* noHeaderOption = cmd->FindOptionByLongName(config_NO_HELP_HEADER_OPTION_NAME);
+			if((noHeaderOption != nullptr) && noHeaderOption->IsDetected())
+			{
+				// In this case, we don't want to print a help header!
+				printHeader = false;
+			}
+
+			this->PrintCmdList(selectedGroup, printHeader);
+		}
+
+		void Comm::PrintHelp(const ParseResult& result)
+		{
+			#if(clide_ENABLE_DEBUG_CODE == 1)
+				this->printSink.PrintDebugInfo("CLIDE: Print help function called.\r\n",
+						Print::DebugPrintingLevel::GENERAL);
+			#endif
+
+			Cmd* cmd = result.GetCmd();
+
+			// Group option provided with help command (help -g groupName), else the default group
+			const char* selectedGroup = this->defaultCmdGroup->name.cStr;
+			const char* groupOptionValue = result.GetValue(cmd->FindOptionByShortName('g'));
+			if(groupOptionValue != NULL)
+				selectedGroup = groupOptionValue;
+
+			// Don't print the header if the --no-header option is provided to the help command
+			bool printHeader = !result.IsDetected(cmd->FindOptionByLongName(config_NO_HELP_HEADER_OPTION_NAME));
+
+			this->PrintCmdList(selectedGroup, printHeader);
+		}
+
+		void Comm::PrintCmdList(const char* selectedGroup, bool printHeader)
+		{
+			const char* helpText = this->GetCmdListHelpText(selectedGroup, printHeader);
+			if(helpText != NULL)
+				this->printSink.PrintToCmdLine(helpText);
+			else
+				this->RenderCmdList(selectedGroup, printHeader);
+
+			// Call callback function
+			if(generalHelpRequestedCallback.obj != NULL)
+				generalHelpRequestedCallback.Execute((char*)"This argument is not used.");
+		}
+
+		const char* Comm::GetCmdListHelpText(const char* selectedGroup, bool printHeader)
+		{
+			if(!this->IsHelpCacheUsable())
+				return NULL;
+
+			for(uint32_t x = 0; x < this->cmdListHelpCacheA.Size(); x++)
 			{
-				if(cmd->FindOptionByLongName(config_NO_HELP_HEADER_OPTION_NAME)->isDetected)
-					// In this case, we don't want to print a help header!
-					printHeader = false;
+				CmdListHelp* cmdListHelp = this->cmdListHelpCacheA[x];
+				if((cmdListHelp->printHeader == printHeader) && (cmdListHelp->groupName == selectedGroup))
+					return cmdListHelp->text;
 			}
 
+			// Only groups with commands in them are cached, so asking for help on made-up group names can't grow the cache
+			if(this->isFrozen || !this->IsGroupInUse(selectedGroup))
+				return NULL;
+
+			HelpTextCapture capture(this->printSink);
+			this->RenderCmdList(selectedGroup, printHeader);
+
+			CmdListHelp* cmdListHelp = new CmdListHelp;
+			cmdListHelp->groupName = selectedGroup;
+			cmdListHelp->printHeader = printHeader;
+			cmdListHelp->text = capture.Finish();
+			this->cmdListHelpCacheA.Append(cmdListHelp);
+			return cmdListHelp->text;
+		}
+
+		bool Comm::IsGroupInUse(const char* groupName) const
+		{
+			uint32_t cmdGroupId = this->FindCmdGroupId(groupName);
+			return (cmdGroupId != HashIndex::NOT_FOUND) && (this->GetNumCmdsInGroup(cmdGroupId) != 0);
+		}
+
+		void Comm::RenderCmdList(const char* selectedGroup, bool printHeader)
+		{
+			// Temp buffer for printf() calls in this function
+			char tempBuff[100];
+
 			// Print header if not set to false above
 			if(printHeader)
 			{
 				// Title
-				Print::PrintToCmdLine("********** LIST OF COMMANDS ***********\r\n");
-				Print::PrintToCmdLine("Showing commands for user group: " clide_TERM_TEXT_FORMAT_BOLD);
-				Print::PrintToCmdLine(selectedGroup);
-				Print::PrintToCmdLine(clide_TERM_TEXT_FORMAT_NORMAL "\r\n");
+				this->printSink.PrintToCmdLine("********** LIST OF COMMANDS ***********\r\n");
+				this->printSink.PrintToCmdLine("Showing commands for user group: ");
+				this->printSink.PrintToCmdLine(this->TextFormatBold());
+				this->printSink.PrintToCmdLine(selectedGroup);
+				this->printSink.PrintToCmdLine(this->TextFormatNormal());
+				this->printSink.PrintToCmdLine("\r\n");
 
-				#if(clide_ENABLE_ADV_TEXT_FORMATTING)
-					Print::PrintToCmdLine(clide_TABLE_HEADER_ROW_COLOUR_CODE);
-					Print::PrintToCmdLine(clide_TERM_TEXT_FORMAT_BOLD);
-				#endif
+				this->printSink.PrintToCmdLine(this->TextFormatTableHeaderRow());
+				this->printSink.PrintToCmdLine(this->TextFormatBold());
 
 				// Prints command name and description, with padding and truncation if required.
 				snprintf(
 					tempBuff,
 					sizeof(tempBuff),
-					"%-" STR(config_PADDING_BEFORE_CMD_IN_HELP) "s%-" STR(config_CMD_PADDING_FOR_HELP) "s%s\r\n",
+					"%-*s%-*s%s\r\n",
+					(int)this->config.paddingBeforeCmdInHelp,
 					"",
+					(int)this->config.cmdPaddingForHelp,
 					"cmd",
 					"description");
-				Print::PrintToCmdLine(tempBuff);
+				this->printSink.PrintToCmdLine(tempBuff);
 
-				#if(clide_ENABLE_ADV_TEXT_FORMATTING)
-					Print::PrintToCmdLine(clide_TERM_TEXT_FORMAT_NORMAL);
-				#endif
+				this->printSink.PrintToCmdLine(this->TextFormatNormal());
 			}
 
-			// Iterate through cmd array and print commands, if they belong to the current command group
-			uint32_t x;
-			for(x = 0; x < this->cmdA.Size(); x++)
+			// Print the commands in the requested group, in the order they were registered
+			uint32_t cmdGroupId = this->FindCmdGroupId(selectedGroup);
+			if(cmdGroupId == HashIndex::NOT_FOUND)
+				return;
+
+			const MVector<uint32_t>& cmdNumA = this->cmdGroupMembersA[cmdGroupId]->cmdNumA;
+			for(uint32_t y = 0; y < cmdNumA.Size(); y++)
+			{
+				uint32_t x = cmdNumA[y];
+				snprintf(
+					tempBuff,
+					sizeof(tempBuff),
+					"%-*s",
+					(int)this->config.paddingBeforeCmdInHelp,
+					"");
+				this->printSink.PrintToCmdLine(tempBuff);
+				//this->printSink.PrintToCmdLine("\t");
+				// The name is padded to the same width with or without formatting, so it lines up with the header row
+				if(this->config.enableAdvTextFormatting)
+					this->printSink.PrintToCmdLine(clide_TERM_TEXT_FORMAT_BOLD);
+				snprintf(
+					tempBuff,
+					sizeof(tempBuff),
+					"%-*.*s",
+					(int)this->config.cmdPaddingForHelp,
+					(int)this->config.cmdPaddingForHelp - 1,
+					cmdA[x]->name.cStr);
+				this->printSink.PrintToCmdLine(tempBuff);
+				if(this->config.enableAdvTextFormatting)
+					this->printSink.PrintToCmdLine(clide_TERM_TEXT_FORMAT_NORMAL);
+
+				// Add tab character
+				//this->printSink.PrintToCmdLine("\t");
+				// Print description
+				this->printSink.PrintToCmdLine(cmdA[x]->description.cStr);
+				// \r is enough for PuTTy to format onto a newline also
+				// (adding \n causes it to add two new lines)
+				this->printSink.PrintToCmdLine("\r\n");
+			}
+		}
+
+		void Comm::Freeze()
+		{
+			// The help cache is read-only once frozen, so render the plain "help" listing now. Nothing is printed.
+			if(!this->isFrozen)
+				this->GetCmdListHelpText(this->defaultCmdGroup->name.cStr, true);
+
+			this->isFrozen = true;
+		}
+
+		void Comm::InvalidateHelpCache()
+		{
+			// Read-only once frozen
+			if(this->isFrozen)
+				return;
+
+			for(uint32_t x = 0; x < this->cmdListHelpCacheA.Size(); x++)
+			{
+				delete[] this->cmdListHelpCacheA[x]->text;
+				delete this->cmdListHelpCacheA[x];
+			}
+			this->cmdListHelpCacheA.Clear();
+
+			// Registering lots of commands does not have to visit them all each time
+			if(this->numCmdHelpTextsCached != 0)
 			{
-				// Iterate through the command groups for each command
-				uint32_t y;
-				for(y = 0; y < cmdA[x]->cmdGroupA.Size(); y++)
+				for(uint32_t x = 0; x < this->cmdA.Size(); x++)
 				{
-					// Check command belongs to requested group
-					if(strcmp(selectedGroup, cmdA[x]->cmdGroupA[y]->name.cStr) == 0)
-					{
-						snprintf(
-							tempBuff,
-							sizeof(tempBuff),
-							"%-" STR(config_PADDING_BEFORE_CMD_IN_HELP) "s",
-							"");
-						Print::PrintToCmdLine(tempBuff);
-						//Print::PrintToCmdLine("\t");
-						#if(clide_ENABLE_ADV_TEXT_FORMATTING == 1)
-							Print::PrintToCmdLine(clide_TERM_TEXT_FORMAT_BOLD);
-							snprintf(
-								tempBuff,
-								sizeof(tempBuff),
-								"%-" STR(config_CMD_PADDING_FOR_HELP) "." STR(config_CMD_PADDING_FOR_HELP_MINUS_1) "s",
-								cmdA[x]->name.cStr);
-							Print::PrintToCmdLine(tempBuff);
-							Print::PrintToCmdLine(clide_TERM_TEXT_FORMAT_NORMAL);
-						#else
-							// No special formatting
-							Print::PrintToCmdLine(cmdA[x]->name);
-						#endif
-
-						// Add tab character
-						//Print::PrintToCmdLine("\t");
-						// Print description
-						Print::PrintToCmdLine(cmdA[x]->description.cStr);
-						// \r is enough for PuTTy to format onto a newline also
-						// (adding \n causes it to add two new lines)
-						Print::PrintToCmdLine("\r\n");
-
-						// Quit this for loop, as command has already been printed, don't want to print again
-						break;
-					}
+					delete[] this->cmdA[x]->helpText;
+					this->cmdA[x]->helpText = NULL;
 				}
+				this->numCmdHelpTextsCached = 0;
 			}
+		}
 
-			// Call callback function
-			if(generalHelpRequestedCallback.obj != NULL)
-				generalHelpRequestedCallback.Execute((char*)"This argument is not used.");
+		bool Comm::IsFrozen() const
+		{
+			return this->isFrozen;
+		}
+
+		void Comm::EnableCmdPrefixIndex()
+		{
+			if(this->cmdPrefixIndexEnabled)
+				return;
+
+			this->cmdPrefixIndexEnabled = true;
+			for(uint32_t x = 0; x < this->cmdA.Size(); x++)
+				this->AddToCmdPrefixIndex(this->cmdA[x]);
+		}
+
+		bool Comm::IsCmdPrefix(const char* prefix, uint32_t prefixLen, uint32_t prefixHash) const
+		{
+			if(!this->cmdPrefixIndexEnabled)
+				return true;
+
+			return this->cmdPrefixIndex.Find(prefix, prefixLen, prefixHash) != HashIndex::NOT_FOUND;
+		}
+
+		uint32_t Comm::FindCmdGroupId(const char* groupName) const
+		{
+			return this->cmdGroupIndex.Find(groupName, strlen(groupName));
+		}
+
+		uint32_t Comm::GetNumCmdsInGroup(uint32_t cmdGroupId) const
+		{
+			return this->cmdGroupMembersA[cmdGroupId]->cmdNumA.Size();
+		}
 
+		Cmd* Comm::GetCmdInGroup(uint32_t cmdGroupId, uint32_t cmdInGroupNum) const
+		{
+			return this->cmdA[this->cmdGroupMembersA[cmdGroupId]->cmdNumA[cmdInGroupNum]];
+		}
+
+		void Comm::AddCmdToGroupIndex(Cmd* cmd, CmdGroup* cmdGroup)
+		{
+			uint32_t cmdGroupId = this->InternCmdGroup(cmdGroup->name.cStr);
+
+			// Already in a group with this name
+			if(cmd->IsInGroupId(cmdGroupId))
+				return;
+
+			while(cmd->cmdGroupBitsA.Size() <= cmdGroupId/32)
+				cmd->cmdGroupBitsA.Append(0);
+			cmd->cmdGroupBitsA[cmdGroupId/32] |= (uint32_t)1 << (cmdGroupId%32);
+
+			// Kept in registration order, so help lists commands the same way however they were added to the group.
+			// Commands are usually added to groups as they are registered, so this is almost always an append.
+			MVector<uint32_t>& cmdNumA = this->cmdGroupMembersA[cmdGroupId]->cmdNumA;
+			cmdNumA.Append(cmd->cmdNum);
+			for(uint32_t x = cmdNumA.Size() - 1; (x > 0) && (cmdNumA[x - 1] > cmd->cmdNum); x--)
+			{
+				cmdNumA[x] = cmdNumA[x - 1];
+				cmdNumA[x - 1] = cmd->cmdNum;
+			}
+		}
+
+		//===============================================================================================//
+		//==================================== PROTECTED METHODS ========================================//
+		//===============================================================================================//
+
+		uint32_t Comm::InternCmdGroup(const char* groupName)
+		{
+			uint32_t cmdGroupId = this->FindCmdGroupId(groupName);
+			if(cmdGroupId != HashIndex::NOT_FOUND)
+				return cmdGroupId;
+
+			// The index keeps a pointer to the key, so it points at a copy owned by this object
+			CmdGroupMembers* cmdGroupMembers = new CmdGroupMembers;
+			cmdGroupMembers->name = groupName;
+			cmdGroupId = this->cmdGroupMembersA.Size();
+			this->cmdGroupMembersA.Append(cmdGroupMembers);
+			this->cmdGroupIndex.Insert(cmdGroupMembers->name.cStr, cmdGroupMembers->name.GetLength(), cmdGroupId);
+			return cmdGroupId;
+		}
+
+		void Comm::AddToCmdPrefixIndex(Cmd* cmd)
+		{
+			// Keys point into the command name, which persists for as long as the command is registered.
+			// Prefixes shared between commands are only stored once.
+			for(uint32_t x = 1; x <= cmd->name.GetLength(); x++)
+				this->cmdPrefixIndex.Insert(cmd->name.cStr, x, 0);
+		}
+
+		const char* Comm::TextFormatBold() const
+		{
+			return this->config.enableAdvTextFormatting ? clide_TERM_TEXT_FORMAT_BOLD : "";
+		}
+
+		const char* Comm::TextFormatNormal() const
+		{
+			return this->config.enableAdvTextFormatting ? clide_TERM_TEXT_FORMAT_NORMAL : "";
+		}
+
+		const char* Comm::TextFormatTableHeaderRow() const
+		{
+			return this->config.enableAdvTextFormatting ? clide_TABLE_HEADER_ROW_COLOUR_CODE : "";
+		}
+
+		bool Comm::IsHelpCacheUsable()
+		{
+			if(this->config == this->helpCacheConfig)
+				return true;
+
+			// Can't be replaced once frozen, so it is skipped instead
+			if(this->isFrozen)
+				return false;
+
+			this->InvalidateHelpCache();
+			this->helpCacheConfig = this->config;
+			return true;
 		}
 
 		// Prints out help for one command
 		void Comm::PrintHelpForCmd(Cmd* cmd)
 		{
 			#if(clide_ENABLE_DEBUG_CODE == 1)
-				Print::PrintDebugInfo("CLIDE: Printing help for command.\r\n",
+				this->printSink.PrintDebugInfo("CLIDE: Printing help for command.\r\n",
 						Print::DebugPrintingLevel::GENERAL);
 			#endif
 
-			Print::PrintToCmdLine("\r\n**********COMMAND HELP:**********\r\n");
+			if(this->IsHelpCacheUsable() && (cmd->parentComm == this))
+			{
+				if((cmd->helpText == NULL) && !this->isFrozen)
+				{
+					HelpTextCapture capture(this->printSink);
+					this->RenderHelpForCmd(cmd);
+					cmd->helpText = capture.Finish();
+					this->numCmdHelpTextsCached++;
+				}
+
+				if(cmd->helpText != NULL)
+				{
+					this->printSink.PrintToCmdLine(cmd->helpText);
+					return;
+				}
+			}
+
+			this->RenderHelpForCmd(cmd);
+		}
+
+		void Comm::RenderHelpForCmd(Cmd* cmd)
+		{
+
+			this->printSink.PrintToCmdLine("\r\n**********COMMAND HELP:**********\r\n");
 
 			// CMD NAME AND DESCRIPTION
 
 			// Tabbing in
-			Print::PrintToCmdLine("\t");
-			#if(clide_ENABLE_ADV_TEXT_FORMATTING == 1)
-				Print::PrintToCmdLine(clide_TERM_TEXT_FORMAT_BOLD);
-				Print::PrintToCmdLine(cmd->name.cStr);
-				Print::PrintToCmdLine(clide_TERM_TEXT_FORMAT_NORMAL);
-			#else
-				// No advanced text formatting
-				Print::PrintToCmdLine(cmd->name);
-			#endif
+			this->printSink.PrintToCmdLine("\t");
+			this->printSink.PrintToCmdLine(this->TextFormatBold());
+			this->printSink.PrintToCmdLine(cmd->name.cStr);
+			this->printSink.PrintToCmdLine(this->TextFormatNormal());
 
 			// Add tab character
-			Print::PrintToCmdLine("\t");
+			this->printSink.PrintToCmdLine("\t");
 			// Print description
-			Print::PrintToCmdLine(cmd->description.cStr);
+			this->printSink.PrintToCmdLine(cmd->description.cStr);
 			// \r is enough for PuTTy to format onto a newline also
 			// (adding \n causes it to add two new lines)
-			Print::PrintToCmdLine("\r\n");
+			this->printSink.PrintToCmdLine("\r\n");
 
 			// CMD PARAMETERS
 
-			Print::PrintToCmdLine("Command Parameters:\r\n");
+			this->printSink.PrintToCmdLine("Command Parameters:\r\n");
 
 
 			// Special case if there are no parameters to list
 			if(cmd->paramA.Size() == 0)
 			{
-				Print::PrintToCmdLine("\t");
-				Print::PrintToCmdLine("NO PARAMS");
-				Print::PrintToCmdLine("\r\n");
+				this->printSink.PrintToCmdLine("\t");
+				this->printSink.PrintToCmdLine("NO PARAMS");
+				this->printSink.PrintToCmdLine("\r\n");
 			}
 			else
 			{
 				// Print top table row 'header'
-				#if(clide_ENABLE_ADV_TEXT_FORMATTING)
-					Print::PrintToCmdLine(clide_TABLE_HEADER_ROW_COLOUR_CODE);
-				#endif
-				Print::PrintToCmdLine("\tindex\tdescription\r\n");
-				#if(clide_ENABLE_ADV_TEXT_FORMATTING)
-					Print::PrintToCmdLine(clide_TERM_TEXT_FORMAT_NORMAL);
-				#endif
+				this->printSink.PrintToCmdLine(this->TextFormatTableHeaderRow());
+				this->printSink.PrintToCmdLine("\tindex\tdescription\r\n");
+				this->printSink.PrintToCmdLine(this->TextFormatNormal());
 				// Iterate through cmd array and print commands
 				uint32_t x;
 				for(x = 0; x < cmd->paramA.Size(); x++)
 				{
-					Print::PrintToCmdLine("\t");
+					this->printSink.PrintToCmdLine("\t");
 					char tempBuff[50];
 					snprintf(
 						tempBuff,
 						sizeof(tempBuff),
 						"%" PRIu32,
 						x);
-					Print::PrintToCmdLine(tempBuff);
+					this->printSink.PrintToCmdLine(tempBuff);
 					// Add tab character
-					Print::PrintToCmdLine("\t");
+					this->printSink.PrintToCmdLine("\t");
 					// Print description
-					Print::PrintToCmdLine(cmd->paramA[x]->description.cStr);
+					this->printSink.PrintToCmdLine(cmd->paramA[x]->description.cStr);
 					// \r is enough for PuTTy to format onto a newline also
 					// (adding \n causes it to add two new lines)
-					Print::PrintToCmdLine("\r\n");
+					this->printSink.PrintToCmdLine("\r\n");
 				}
 			}
 
 			// CMD OPTIONS
 
-			Print::PrintToCmdLine("Command Options:\r\n");
+			this->printSink.PrintToCmdLine("Command Options:\r\n");
+
+			// The built-in help option is listed first, as if it was registered with every command
+			#if(clide_ENABLE_AUTO_HELP == 1)
+				uint32_t numBuiltInOptions = 1;
+			#else
+				uint32_t numBuiltInOptions = 0;
+			#endif
 
 			// Special case if there are no parameters to list
-			if(cmd->optionA.Size() == 0)
+			if(numBuiltInOptions + cmd->optionA.Size() == 0)
 			{
-				Print::PrintToCmdLine("\t");
-				Print::PrintToCmdLine("NO OPTIONS");
-				Print::PrintToCmdLine("\r\n");
+				this->printSink.PrintToCmdLine("\t");
+				this->printSink.PrintToCmdLine("NO OPTIONS");
+				this->printSink.PrintToCmdLine("\r\n");
 			}
 			else
 			{
 				// Print top table row 'header'
-				#if(clide_ENABLE_ADV_TEXT_FORMATTING)
-					// gold = Print::PrintToCmdLine("\x1B[33m");
-					// Yellow
-					Print::PrintToCmdLine(clide_TABLE_HEADER_ROW_COLOUR_CODE);
-				#endif
-				Print::PrintToCmdLine("\tshort\tlong\tdescription\r\n");
-				#if(clide_ENABLE_ADV_TEXT_FORMATTING)
-					Print::PrintToCmdLine("\x1B[0m");
-				#endif
+				this->printSink.PrintToCmdLine(this->TextFormatTableHeaderRow());
+				this->printSink.PrintToCmdLine("\tshort\tlong\tdescription\r\n");
+				this->printSink.PrintToCmdLine(this->TextFormatNormal());
 
 				// Iterate through cmd array and print commands
 				uint32_t x;
-				for(x = 0; x < cmd->optionA.Size(); x++)
+				for(x = 0; x < numBuiltInOptions + cmd->optionA.Size(); x++)
 				{
+					#if(clide_ENABLE_AUTO_HELP == 1)
+						const Option* option = (x == 0) ? Cmd::GetHelpOption() : cmd->optionA[x - numBuiltInOptions];
+					#else
+						const Option* option = cmd->optionA[x];
+					#endif
+
 					// Print short option
-					Print::PrintToCmdLine("\t");
+					this->printSink.PrintToCmdLine("\t");
 					char tempShortOption[2];
-					tempShortOption[0] = cmd->optionA[x]->shortName;
+					tempShortOption[0] = option->shortName;
 					tempShortOption[1] = '\0';
-					Print::PrintToCmdLine(tempShortOption);
+					this->printSink.PrintToCmdLine(tempShortOption);
 
 					// Print long option
-					Print::PrintToCmdLine("\t");
-					Print::PrintToCmdLine(cmd->optionA[x]->longName.cStr);
+					this->printSink.PrintToCmdLine("\t");
+					this->printSink.PrintToCmdLine(option->longName.cStr);
 					// Add tab character
-					Print::PrintToCmdLine("\t");
+					this->printSink.PrintToCmdLine("\t");
 					// Print description
-					Print::PrintToCmdLine(cmd->optionA[x]->description.cStr);
+					this->printSink.PrintToCmdLine(option->description.cStr);
 					// \r is enough for PuTTy to format onto a newline also
 					// (adding \n causes it to add two new lines)
-					Print::PrintToCmdLine("\r\n");
+					this->printSink.PrintToCmdLine("\r\n");
 				}
 			}
 
 			// CMD GROUPS
 
-			Print::PrintToCmdLine("Command groups it belongs to:\r\n");
+			this->printSink.PrintToCmdLine("Command groups it belongs to:\r\n");
 
 			// Add tab character
-			Print::PrintToCmdLine("\t");
+			this->printSink.PrintToCmdLine("\t");
 
 			uint32_t x;
 			for(x = 0; x < cmd->GetNumCmdGroups(); x++)
 			{
 				// Print out command group name
-				Print::PrintToCmdLine(cmd->cmdGroupA[x]->name.cStr);
+				this->printSink.PrintToCmdLine(cmd->cmdGroupA[x]->name.cStr);
 
 				// Add space and comma if not last command group name
 				if(x != cmd->GetNumCmdGroups() - 1)
-					Print::PrintToCmdLine(" ,");
+					this->printSink.PrintToCmdLine(" ,");
 			}
 
 			char tempBuff[50];
@@ -388,7 +739,7 @@ namespace MbeddedNinja
 					sizeof(tempBuff),
 					" (total = %" PRIu32 ")\r\n",
 					cmd->GetNumCmdGroups());
-				Print::PrintToCmdLine(tempBuff);
+				this->printSink.PrintToCmdLine(tempBuff);
 
 		}
 
@@ -2,7 +2,7 @@
 //! @file 				GetOpt.cpp
 //! @author 			Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
 //! @created			2013-03-19
-//! @last-modified 		2014-10-07
+//! @last-modified 		2026-10-17
 //! @brief 				Clide's own getopt() function. It was decided not to reply on the standard C version of this as the implementation varied between "standard" C libraries.
 //! @details
 //!						See README.rst in repo root dir for more info.
@@ -45,7 +45,6 @@
 #include <stdio.h>
 
 #include "../include/Config.hpp"
-#include "../include/Global.hpp"
 #include "../include/Print.hpp"
 #include "../include/GetOpt.hpp"
 
@@ -114,6 +113,24 @@ namespace MbeddedNinja
 
 		GetOpt::_getopt_data GetOpt::getopt_data;
 
+		#if(clide_ENABLE_DEBUG_CODE == 1)
+			void GetOpt::PrintDebugInfo(_getopt_data *d, const char* msg, Print::DebugPrintingLevel debugPrintingLevel)
+			{
+				if(d->printSink != NULL)
+					d->printSink->PrintDebugInfo(msg, debugPrintingLevel);
+				else
+					Print::PrintDebugInfo(msg, debugPrintingLevel);
+			}
+
+			void GetOpt::PrintError(_getopt_data *d, const char* msg)
+			{
+				if(d->printSink != NULL)
+					d->printSink->PrintError(msg);
+				else
+					Print::PrintError(msg);
+			}
+		#endif
+
 		#ifndef __GNU_LIBRARY__
 
 		// Avoid depending on library functions or files
@@ -301,18 +318,18 @@ namespace MbeddedNinja
 			int posixly_correct)
 		{
 			#if(clide_ENABLE_DEBUG_CODE == 1)
-				Print::PrintDebugInfo("CLIDE: GetOpt() called.\r\n",
+				PrintDebugInfo(d, "CLIDE: GetOpt() called.\r\n",
 						Print::DebugPrintingLevel::VERBOSE);
 			#endif
 
 			#if(clide_ENABLE_DEBUG_CODE == 1)
 				snprintf (
-					Global::debugBuff,
-					sizeof(Global::debugBuff),
+					d->debugBuff,
+					sizeof(d->debugBuff),
 					"CLIDE: GetOpt data.optind = '%i'. argc = '%i'.\r\n",
 					d->optind,
 					argc);
-				Print::PrintDebugInfo(Global::debugBuff,
+				PrintDebugInfo(d, d->debugBuff,
 						Print::DebugPrintingLevel::VERBOSE);
 			#endif
 		
@@ -327,7 +344,7 @@ namespace MbeddedNinja
 			if (d->optind == 0 || !d->__initialized)
 			{
 				#if(clide_ENABLE_DEBUG_CODE == 1)
-					Print::PrintDebugInfo("CLIDE: Initialising GetOpt().\r\n",
+					PrintDebugInfo(d, "CLIDE: Initialising GetOpt().\r\n",
 							Print::DebugPrintingLevel::VERBOSE);
 				#endif
 				// Don't scan ARGV[0], the program name.
@@ -345,12 +362,12 @@ namespace MbeddedNinja
 			
 			#if(clide_ENABLE_DEBUG_CODE == 1)
 				snprintf (
-					Global::debugBuff,
-					sizeof(Global::debugBuff),
+					d->debugBuff,
+					sizeof(d->debugBuff),
 					"CLIDE: Testing whether argv['%i'] ('%s') points to a non-option argument.\r\n",
 					d->optind,
 					argv[d->optind]);
-				Print::PrintDebugInfo(Global::debugBuff,
+				PrintDebugInfo(d, d->debugBuff,
 						Print::DebugPrintingLevel::VERBOSE);
 			#endif
 
@@ -420,7 +437,7 @@ namespace MbeddedNinja
 						d->optind = d->__first_nonopt;
 					{
 						#if(clide_ENABLE_DEBUG_CODE == 1)
-							Print::PrintDebugInfo("CLIDE: GetOpt() finished. optind == argc. Returning -1.\r\n",
+							PrintDebugInfo(d, "CLIDE: GetOpt() finished. optind == argc. Returning -1.\r\n",
 									Print::DebugPrintingLevel::VERBOSE);
 						#endif
 						return -1;
@@ -435,14 +452,14 @@ namespace MbeddedNinja
 					if (d->__ordering == _getopt_data::REQUIRE_ORDER)
 					{
 						#if(clide_ENABLE_DEBUG_CODE == 1)
-							Print::PrintDebugInfo("CLIDE: GetOpt() finished. Returning -1.\r\n",
+							PrintDebugInfo(d, "CLIDE: GetOpt() finished. Returning -1.\r\n",
 									Print::DebugPrintingLevel::VERBOSE);
 						#endif
 						return -1;
 					}
 					d->optarg = argv[d->optind++];
 					#if(clide_ENABLE_DEBUG_CODE == 1)
-						Print::PrintDebugInfo("CLIDE: GetOpt() finished. Returning 1.\r\n",
+						PrintDebugInfo(d, "CLIDE: GetOpt() finished. Returning 1.\r\n",
 								Print::DebugPrintingLevel::VERBOSE);
 					#endif
 					return 1;
@@ -538,40 +555,36 @@ namespace MbeddedNinja
 							ambig_list = &first;
 							#if(clide_ENABLE_DEBUG_CODE == 1)
 								snprintf (
-									Global::debugBuff,
-									sizeof(Global::debugBuff),
+									d->debugBuff,
+									sizeof(d->debugBuff),
 									"%s: option '%s' is ambiguous; possibilities:",
 									argv[0], argv[d->optind]);
-								Print::PrintError(Global::debugBuff);
+								PrintError(d, d->debugBuff);
 							#endif
 							do
 							{
 								#if(clide_ENABLE_DEBUG_CODE == 1)
 									snprintf (
-										Global::debugBuff,
-										sizeof(Global::debugBuff),
+										d->debugBuff,
+										sizeof(d->debugBuff),
 										" '--%s'",
 										ambig_list->p->name);
-									ambig_list = ambig_list->next;
-									Print::PrintError(Global::debugBuff);
+									PrintError(d, d->debugBuff);
 								#endif
+								// Must advance even when not printing, otherwise this never ends
+								ambig_list = ambig_list->next;
 							}
 							while (ambig_list != NULL);
 
-								#if(clide_ENABLE_DEBUG_CODE == 1)
-									snprintf(
-										Global::debugBuff,
-										sizeof(Global::debugBuff),
-										"%s"
-										"\n");
-									Print::PrintError(Global::debugBuff);
-								#endif
+							#if(clide_ENABLE_DEBUG_CODE == 1)
+								PrintError(d, "\r\n");
+							#endif
 						}
 						d->__nextchar += strlen (d->__nextchar);
 						d->optind++;
 						d->optopt = 0;
 						#if(clide_ENABLE_DEBUG_CODE == 1)
-							Print::PrintDebugInfo("CLIDE: GetOpt() finished. Returning ?.\r\n",
+							PrintDebugInfo(d, "CLIDE: GetOpt() finished. Returning ?.\r\n",
 									Print::DebugPrintingLevel::VERBOSE);
 						#endif
 						return '?';
@@ -597,12 +610,12 @@ namespace MbeddedNinja
 										// --option
 										#if(clide_ENABLE_DEBUG_CODE == 1)
 											snprintf (
-												Global::debugBuff,
-												sizeof(Global::debugBuff),
+												d->debugBuff,
+												sizeof(d->debugBuff),
 												"%s: option '--%s' doesn't allow an argument\n",
 												argv[0],
 												pfound->name);
-											Print::PrintError(Global::debugBuff);
+											PrintError(d, d->debugBuff);
 										#endif
 									}
 									  else
@@ -610,12 +623,12 @@ namespace MbeddedNinja
 										// +option or -option
 										#if(clide_ENABLE_DEBUG_CODE == 1)
 											snprintf (
-												Global::debugBuff,
-												sizeof(Global::debugBuff),
+												d->debugBuff,
+												sizeof(d->debugBuff),
 												"%s: option '%c%s' doesn't allow an argument\n",
 												argv[0], argv[d->optind - 1][0],
 												pfound->name);
-											Print::PrintError(Global::debugBuff);
+											PrintError(d, d->debugBuff);
 										#endif
 									}
 								}
@@ -624,7 +637,7 @@ namespace MbeddedNinja
 
 								d->optopt = pfound->val;
 								#if(clide_ENABLE_DEBUG_CODE == 1)
-									Print::PrintDebugInfo("CLIDE: GetOpt() finished. Returning ?.\r\n",
+									PrintDebugInfo(d, "CLIDE: GetOpt() finished. Returning ?.\r\n",
 											Print::DebugPrintingLevel::VERBOSE);
 								#endif
 								return '?';
@@ -640,17 +653,17 @@ namespace MbeddedNinja
 								{
 									#if(clide_ENABLE_DEBUG_CODE == 1)
 										snprintf (
-											Global::debugBuff,
-											sizeof(Global::debugBuff),
+											d->debugBuff,
+											sizeof(d->debugBuff),
 										   "%s: option '--%s' requires an argument\n",
 										   argv[0], pfound->name);
-										Print::PrintError(Global::debugBuff);
+										PrintError(d, d->debugBuff);
 									#endif
 								}
 								d->__nextchar += strlen (d->__nextchar);
 								d->optopt = pfound->val;
 								#if(clide_ENABLE_DEBUG_CODE == 1)
-									Print::PrintDebugInfo("CLIDE: GetOpt() finished. Returning : or ?.\r\n",
+									PrintDebugInfo(d, "CLIDE: GetOpt() finished. Returning : or ?.\r\n",
 											Print::DebugPrintingLevel::VERBOSE);
 								#endif
 								return optstring[0] == ':' ? ':' : '?';
@@ -663,7 +676,7 @@ namespace MbeddedNinja
 						{
 							*(pfound->flag) = pfound->val;
 							#if(clide_ENABLE_DEBUG_CODE == 1)
-								Print::PrintDebugInfo("CLIDE: GetOpt() finished. Returning 0.\r\n",
+								PrintDebugInfo(d, "CLIDE: GetOpt() finished. Returning 0.\r\n",
 										Print::DebugPrintingLevel::VERBOSE);
 							#endif
 							return 0;
@@ -686,12 +699,12 @@ namespace MbeddedNinja
 								// --option
 								#if(clide_ENABLE_DEBUG_CODE == 1)
 									snprintf (
-										Global::debugBuff,
-										sizeof(Global::debugBuff),
+										d->debugBuff,
+										sizeof(d->debugBuff),
 										"%s: unrecognized option '--%s'\n",
 										argv[0],
 										d->__nextchar);
-									Print::PrintError(Global::debugBuff);
+									PrintError(d, d->debugBuff);
 								#endif
 							}
 							else
@@ -699,13 +712,13 @@ namespace MbeddedNinja
 								// +option or -option
 								#if(clide_ENABLE_DEBUG_CODE == 1)
 									snprintf (
-										Global::debugBuff,
-										sizeof(Global::debugBuff),
+										d->debugBuff,
+										sizeof(d->debugBuff),
 										"%s: unrecognized option '%c%s'\n",
 										argv[0],
 										argv[d->optind][0],
 										d->__nextchar);
-									Print::PrintError(Global::debugBuff);
+									PrintError(d, d->debugBuff);
 								#endif
 							}
 						}
@@ -713,7 +726,7 @@ namespace MbeddedNinja
 						d->optind++;
 						d->optopt = 0;
 						#if(clide_ENABLE_DEBUG_CODE == 1)
-							Print::PrintDebugInfo("CLIDE: GetOpt() finished. Returning ?.\r\n",
+							PrintDebugInfo(d, "CLIDE: GetOpt() finished. Returning ?.\r\n",
 									Print::DebugPrintingLevel::VERBOSE);
 						#endif
 						return '?';
@@ -737,17 +750,17 @@ namespace MbeddedNinja
 
 						#if(clide_ENABLE_DEBUG_CODE == 1)
 							snprintf (
-								Global::debugBuff,
-								sizeof(Global::debugBuff),
+								d->debugBuff,
+								sizeof(d->debugBuff),
 								"%s: invalid option -- '%c'\n",
 								argv[0],
 								c);
-							Print::PrintError(Global::debugBuff);
+							PrintError(d, d->debugBuff);
 						#endif
 					}
 					d->optopt = c;
 					#if(clide_ENABLE_DEBUG_CODE == 1)
-						Print::PrintDebugInfo("CLIDE: GetOpt() finished. Returning ?.\r\n",
+						PrintDebugInfo(d, "CLIDE: GetOpt() finished. Returning ?.\r\n",
 								Print::DebugPrintingLevel::VERBOSE);
 					#endif
 					return '?';
@@ -780,24 +793,28 @@ namespace MbeddedNinja
 						{
 							#if(clide_ENABLE_DEBUG_CODE == 1)
 								snprintf (
-									Global::debugBuff,
-									sizeof(Global::debugBuff),
+									d->debugBuff,
+									sizeof(d->debugBuff),
 									"%s: option requires an argument -- '%c'\n",
 									argv[0],
 									c);
-								Print::PrintError(Global::debugBuff);
+								PrintError(d, d->debugBuff);
 							#endif
 						}
 						d->optopt = c;
 						if (optstring[0] == ':')
+						{
 							c = ':';
+						}
 						else
+						{
 							c = '?';
-							#if(clide_ENABLE_DEBUG_CODE == 1)
-								Print::PrintDebugInfo("CLIDE: GetOpt() finished. Returning ?.\r\n",
-										Print::DebugPrintingLevel::VERBOSE);
-							#endif
-							return c;
+						}
+						#if(clide_ENABLE_DEBUG_CODE == 1)
+							PrintDebugInfo(d, "CLIDE: GetOpt() finished. Returning ?.\r\n",
+									Print::DebugPrintingLevel::VERBOSE);
+						#endif
+						return c;
 					}
 					else
 						// We already incremented `d->optind' once;
@@ -844,18 +861,18 @@ namespace MbeddedNinja
 						{
 							#if(clide_ENABLE_DEBUG_CODE == 1)
 								snprintf (
-									Global::debugBuff,
-									sizeof(Global::debugBuff),
+									d->debugBuff,
+									sizeof(d->debugBuff),
 									"%s: option '-W %s' is ambiguous\n",
 									argv[0],
 									d->optarg);
-								Print::PrintError(Global::debugBuff);
+								PrintError(d, d->debugBuff);
 							#endif
 						}
 						d->__nextchar += strlen (d->__nextchar);
 						d->optind++;
 						#if(clide_ENABLE_DEBUG_CODE == 1)
-							Print::PrintDebugInfo("CLIDE: GetOpt() finished. Returning ?.\r\n",
+							PrintDebugInfo(d, "CLIDE: GetOpt() finished. Returning ?.\r\n",
 									Print::DebugPrintingLevel::VERBOSE);
 						#endif
 						return '?';
@@ -875,18 +892,18 @@ namespace MbeddedNinja
 								{
 									#if(clide_ENABLE_DEBUG_CODE == 1)
 										snprintf (
-											Global::debugBuff,
-											sizeof(Global::debugBuff),
+											d->debugBuff,
+											sizeof(d->debugBuff),
 											"%s: option '-W %s' doesn't allow an argument\n",
 											argv[0],
 											pfound->name);
-										Print::PrintError(Global::debugBuff);
+										PrintError(d, d->debugBuff);
 									#endif
 								}
 
 								d->__nextchar += strlen (d->__nextchar);
 								#if(clide_ENABLE_DEBUG_CODE == 1)
-									Print::PrintDebugInfo("CLIDE: GetOpt() finished. Returning ?.\r\n",
+									PrintDebugInfo(d, "CLIDE: GetOpt() finished. Returning ?.\r\n",
 											Print::DebugPrintingLevel::VERBOSE);
 								#endif
 								return '?';
@@ -902,17 +919,17 @@ namespace MbeddedNinja
 								{
 									#if(clide_ENABLE_DEBUG_CODE == 1)
 										snprintf (
-											Global::debugBuff,
-											sizeof(Global::debugBuff),
+											d->debugBuff,
+											sizeof(d->debugBuff),
 											"%s: option '-W %s' requires an argument\n",
 											argv[0],
 											pfound->name);
-										Print::PrintError(Global::debugBuff);
+										PrintError(d, d->debugBuff);
 									#endif
 								}
 								d->__nextchar += strlen (d->__nextchar);
 								#if(clide_ENABLE_DEBUG_CODE == 1)
-									Print::PrintDebugInfo("CLIDE: GetOpt() finished. Returning : or ?.\r\n",
+									PrintDebugInfo(d, "CLIDE: GetOpt() finished. Returning : or ?.\r\n",
 											Print::DebugPrintingLevel::VERBOSE);
 								#endif
 								return optstring[0] == ':' ? ':' : '?';
@@ -927,7 +944,7 @@ namespace MbeddedNinja
 						{
 							*(pfound->flag) = pfound->val;
 							#if(clide_ENABLE_DEBUG_CODE == 1)
-								Print::PrintDebugInfo("CLIDE: GetOpt() finished. Returning 0.\r\n",
+								PrintDebugInfo(d, "CLIDE: GetOpt() finished. Returning 0.\r\n",
 										Print::DebugPrintingLevel::VERBOSE);
 							#endif
 							return 0;
@@ -972,12 +989,12 @@ namespace MbeddedNinja
 
 								#if(clide_ENABLE_DEBUG_CODE == 1)
 									snprintf (
-										Global::debugBuff,
-										sizeof(Global::debugBuff),
+										d->debugBuff,
+										sizeof(d->debugBuff),
 										"%s: option requires an argument -- '%c'\n",
 										argv[0],
 										c);
-									Print::PrintError(Global::debugBuff);
+									PrintError(d, d->debugBuff);
 								#endif
 							}
 							d->optopt = c;
@@ -994,7 +1011,7 @@ namespace MbeddedNinja
 					}
 				}
 				#if(clide_ENABLE_DEBUG_CODE == 1)
-					Print::PrintDebugInfo("CLIDE: GetOpt() finished. Returning character.\r\n",
+					PrintDebugInfo(d, "CLIDE: GetOpt() finished. Returning character.\r\n",
 							Print::DebugPrintingLevel::VERBOSE);
 				#endif
 				return c;
@@ -1043,6 +1060,25 @@ namespace MbeddedNinja
 			0);
 		}
 
+		int	GetOpt::getopt_long_r(
+			int argc,
+			char *const *argv,
+			const char *options,
+			const struct option *long_options,
+			int *opt_index,
+			_getopt_data *d)
+		{
+			return _getopt_internal_r(
+				argc,
+				argv,
+				options,
+				long_options,
+				opt_index,
+				0,
+				d,
+				0);
+		}
+
 		extern int GetOpt::_getopt_internal(
 			int ___argc,
 			char *const *___argv,
@@ -1089,27 +1125,6 @@ namespace MbeddedNinja
 			int *__longind,
 			struct _getopt_data *__data);
 	*/
-		/*
-		int	_getopt_long_r(
-			int argc,
-			char *const *argv,
-			const char *options,
-			const struct option *long_options,
-			int *opt_index,
-			struct _getopt_data *d)
-		{
-			return _getopt_internal_r(
-				argc,
-				argv,
-				options,
-				long_options,
-				opt_index,
-				0,
-				d,
-				0);
-		}
-		*/
-
 		/*
 		int
 		getopt (int argc, char *const *argv, const char *optstring)
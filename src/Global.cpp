@@ -28,8 +28,6 @@ namespace MbeddedNinja
 	namespace MClideNs
 	{
 
-		char Global::debugBuff[clide_DEBUG_BUFF_SIZE] = {0};
-
 		//===============================================================================================//
 		//====================================== PRIVATE METHODS ========================================//
 		//===============================================================================================//
@@ -0,0 +1,164 @@
+//!
+//! @file 			HashIndex.cpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! @created		2026-10-16
+//! @last-modified 	2026-10-16
+//! @brief 			An open-addressing hash index which maps name strings to integer values (e.g. command indexes).
+//! @details
+//!					See README.rst in repo root dir for more info.
+
+#ifndef __cplusplus
+	#error Please build with C++ compiler
+#endif
+
+//===============================================================================================//
+//========================================= INCLUDES ============================================//
+//===============================================================================================//
+
+//===== SYSTEM LIBRARIES =====//
+#include <stdint.h>		// uint32_t
+#include <string.h>		// memcmp()
+
+//===== USER SOURCE =====//
+#include "../include/HashIndex.hpp"
+
+namespace MbeddedNinja
+{
+	namespace MClideNs
+	{
+
+		//===============================================================================================//
+		//======================================= PUBLIC METHODS ========================================//
+		//===============================================================================================//
+
+		const uint32_t HashIndex::NOT_FOUND;
+		const uint32_t HashIndex::HASH_SEED;
+
+		HashIndex::HashIndex()
+		{
+			this->slotA = NULL;
+			this->capacity = 0;
+			this->numUsed = 0;
+		}
+
+		HashIndex::~HashIndex()
+		{
+			delete[] this->slotA;
+		}
+
+		uint32_t HashIndex::Hash(const char* key, uint32_t keyLen)
+		{
+			// 32-bit FNV-1a, cheap and good enough for short names
+			uint32_t hash = HASH_SEED;
+			for(uint32_t x = 0; x < keyLen; x++)
+				hash = HashStep(hash, key[x]);
+			return hash;
+		}
+
+		bool HashIndex::Insert(const char* key, uint32_t keyLen, uint32_t value)
+		{
+			// Keep the load factor at or below 0.5 so probe sequences stay short
+			if((this->numUsed + 1)*2 > this->capacity)
+				this->Grow();
+
+			uint32_t hash = Hash(key, keyLen);
+			uint32_t mask = this->capacity - 1;
+			uint32_t pos = hash & mask;
+
+			while(this->slotA[pos].key != NULL)
+			{
+				if(this->slotA[pos].hash == hash
+					&& this->slotA[pos].keyLen == keyLen
+					&& memcmp(this->slotA[pos].key, key, keyLen) == 0)
+				{
+					// Key already present, keep the existing value
+					return false;
+				}
+				pos = (pos + 1) & mask;
+			}
+
+			this->slotA[pos].key = key;
+			this->slotA[pos].keyLen = keyLen;
+			this->slotA[pos].hash = hash;
+			this->slotA[pos].value = value;
+			this->numUsed++;
+
+			return true;
+		}
+
+		uint32_t HashIndex::Find(const char* key, uint32_t keyLen) const
+		{
+			if(this->numUsed == 0)
+				return NOT_FOUND;
+
+			return this->Find(key, keyLen, Hash(key, keyLen));
+		}
+
+		uint32_t HashIndex::Find(const char* key, uint32_t keyLen, uint32_t hash) const
+		{
+			if(this->numUsed == 0)
+				return NOT_FOUND;
+
+			uint32_t mask = this->capacity - 1;
+			uint32_t pos = hash & mask;
+
+			// Load factor is always <= 0.5, so there is always an empty slot to stop on
+			while(this->slotA[pos].key != NULL)
+			{
+				if(this->slotA[pos].hash == hash
+					&& this->slotA[pos].keyLen == keyLen
+					&& memcmp(this->slotA[pos].key, key, keyLen) == 0)
+				{
+					return this->slotA[pos].value;
+				}
+				pos = (pos + 1) & mask;
+			}
+
+			return NOT_FOUND;
+		}
+
+		void HashIndex::Clear()
+		{
+			for(uint32_t x = 0; x < this->capacity; x++)
+				this->slotA[x].key = NULL;
+			this->numUsed = 0;
+		}
+
+		uint32_t HashIndex::Size() const
+		{
+			return this->numUsed;
+		}
+
+		//===============================================================================================//
+		//====================================== PRIVATE METHODS ========================================//
+		//===============================================================================================//
+
+		void HashIndex::Grow()
+		{
+			Slot* oldSlotA = this->slotA;
+			uint32_t oldCapacity = this->capacity;
+
+			// Start at 16 slots, then double
+			this->capacity = (oldCapacity == 0) ? 16 : oldCapacity*2;
+			this->slotA = new Slot[this->capacity]();
+
+			uint32_t mask = this->capacity - 1;
+			for(uint32_t x = 0; x < oldCapacity; x++)
+			{
+				if(oldSlotA[x].key == NULL)
+					continue;
+
+				// Hash is cached in the slot, no need to re-hash the key
+				uint32_t pos = oldSlotA[x].hash & mask;
+				while(this->slotA[pos].key != NULL)
+					pos = (pos + 1) & mask;
+				this->slotA[pos] = oldSlotA[x];
+			}
+
+			delete[] oldSlotA;
+		}
+
+	} // namespace MClide
+} // namespace MbeddedNinja
+
+// EOF
@@ -0,0 +1,305 @@
+//!
+//! @file 			IoDriver.cpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! @created		2026-10-16
+//! @last-modified 	2026-10-16
+//! @brief 			Runs many RxBuff/Rx channels (one per file descriptor) from one epoll loop. Linux only.
+//! @details
+//!					See README.rst in repo root dir for more info.
+
+#ifndef __cplusplus
+	#error Please build with C++ compiler
+#endif
+
+#if(defined __linux__)
+
+//===============================================================================================//
+//========================================= INCLUDES ============================================//
+//===============================================================================================//
+
+//===== SYSTEM LIBRARIES =====//
+#include <stdint.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#include <sys/epoll.h>
+
+//===== USER LIBRARIES =====//
+#include "MCallbacks/api/MCallbacksApi.hpp"
+#include "MVector/api/MVectorApi.hpp"
+
+//===== USER SOURCE =====//
+#include "../include/Config.hpp"
+#include "../include/Print.hpp"
+#include "../include/Rx.hpp"
+#include "../include/IoDriver.hpp"
+
+namespace MbeddedNinja
+{
+	namespace MClideNs
+	{
+
+		//! @brief		The most events taken from epoll each Poll().
+		static const int _maxEventsPerPoll = 64;
+
+		//===============================================================================================//
+		//======================================= PUBLIC METHODS ========================================//
+		//===============================================================================================//
+
+		IoDriver::IoDriver()
+		{
+			this->epollFd = epoll_create1(EPOLL_CLOEXEC);
+			if(this->epollFd < 0)
+				Print::PrintError("Error: IoDriver could not create the epoll instance.\r\n");
+
+			this->currChannel = NULL;
+			this->isPolling = false;
+			this->isStopped = false;
+		}
+
+		IoDriver::~IoDriver()
+		{
+			for(uint32_t x = 0; x < this->channelA.Size(); x++)
+				delete this->channelA[x];
+			for(uint32_t x = 0; x < this->removedChannelA.Size(); x++)
+				delete this->removedChannelA[x];
+
+			if(this->epollFd >= 0)
+				close(this->epollFd);
+		}
+
+		bool IoDriver::AddChannel(int fd, RxBuff* rxBuff)
+		{
+			if((this->epollFd < 0) || (rxBuff == NULL) || (this->FindChannel(fd) >= 0))
+				return false;
+
+			int flags = fcntl(fd, F_GETFL);
+			if((flags < 0) || (fcntl(fd, F_SETFL, flags | O_NONBLOCK) < 0))
+			{
+				Print::PrintError("Error: IoDriver could not make the file descriptor non-blocking.\r\n");
+				return false;
+			}
+
+			Channel* channel = new Channel;
+			channel->fd = fd;
+			channel->rxBuff = rxBuff;
+			channel->isWriteStalled = false;
+
+			// Level-triggered, so a channel that is not read to the end in one Poll() is serviced again in the next
+			struct epoll_event event;
+			event.events = EPOLLIN;
+			event.data.ptr = channel;
+			if(epoll_ctl(this->epollFd, EPOLL_CTL_ADD, fd, &event) < 0)
+			{
+				Print::PrintError("Error: IoDriver could not add the file descriptor to epoll.\r\n");
+				delete channel;
+				return false;
+			}
+
+			this->channelA.Append(channel);
+			return true;
+		}
+
+		bool IoDriver::RemoveChannel(int fd)
+		{
+			int32_t index = this->FindChannel(fd);
+			if(index < 0)
+				return false;
+
+			Channel* channel = this->channelA[index];
+
+			// Fails if fd has already been closed, which removes it from epoll anyway
+			epoll_ctl(this->epollFd, EPOLL_CTL_DEL, fd, NULL);
+
+			// MVector has no erase, so the others are moved down one
+			uint32_t numChannels = this->channelA.Size();
+			MVector<Channel*> channelA;
+			for(uint32_t x = 0; x < numChannels; x++)
+			{
+				if(x != (uint32_t)index)
+					channelA.Append(this->channelA[x]);
+			}
+			this->channelA = channelA;
+
+			if(this->isPolling)
+			{
+				// There may still be events for it from this Poll()
+				channel->rxBuff = NULL;
+				this->removedChannelA.Append(channel);
+			}
+			else
+				delete channel;
+
+			return true;
+		}
+
+		uint32_t IoDriver::GetNumChannels() const
+		{
+			return this->channelA.Size();
+		}
+
+		int IoDriver::Poll(int timeoutMs)
+		{
+			if(this->epollFd < 0)
+				return -1;
+
+			struct epoll_event eventA[_maxEventsPerPoll];
+			int numEvents = epoll_wait(this->epollFd, eventA, _maxEventsPerPoll, timeoutMs);
+			if(numEvents < 0)
+			{
+				// Interrupted by a signal is not an error, nothing was serviced
+				return (errno == EINTR) ? 0 : -1;
+			}
+
+			this->isPolling = true;
+
+			int numServiced = 0;
+			for(int x = 0; x < numEvents; x++)
+			{
+				Channel* channel = (Channel*)eventA[x].data.ptr;
+
+				// Skips channels removed by an earlier channel's commands
+				if(channel->rxBuff == NULL)
+					continue;
+
+				this->ServiceChannel(channel, eventA[x].events);
+				numServiced++;
+			}
+
+			this->isPolling = false;
+
+			for(uint32_t x = 0; x < this->removedChannelA.Size(); x++)
+				delete this->removedChannelA[x];
+			this->removedChannelA.Clear();
+
+			return numServiced;
+		}
+
+		void IoDriver::Run()
+		{
+			this->isStopped = false;
+			while(!this->isStopped && (this->channelA.Size() != 0))
+			{
+				if(this->Poll(-1) < 0)
+					break;
+			}
+		}
+
+		void IoDriver::Stop()
+		{
+			this->isStopped = true;
+		}
+
+		//===============================================================================================//
+		//======================================= PRIVATE METHODS =======================================//
+		//===============================================================================================//
+
+		int32_t IoDriver::FindChannel(int fd) const
+		{
+			for(uint32_t x = 0; x < this->channelA.Size(); x++)
+			{
+				if(this->channelA[x]->fd == fd)
+					return (int32_t)x;
+			}
+			return -1;
+		}
+
+		void IoDriver::ServiceChannel(Channel* channel, uint32_t events)
+		{
+			// Whatever is left to read is read before a hang-up is acted on
+			if(events & EPOLLIN)
+			{
+				char readBuff[clide_IO_DRIVER_READ_SIZE];
+				ssize_t numRead = read(channel->fd, readBuff, sizeof(readBuff));
+
+				if(numRead > 0)
+				{
+					// Everything the commands print goes back to this channel, one write() per response. Swapped in and
+					// out (rather than set once in AddChannel()) since several channels can share one Rx.
+					PrintSink& printSink = channel->rxBuff->GetRx()->printSink;
+					PrintSink prevPrintSink = printSink;
+					printSink.cmdLineWriteCallback =
+						MCallbacks::CallbackGen<IoDriver, void, PrintChunk>(this, &IoDriver::WriteToCurrChannel);
+					printSink.SetBuffer(this->writeBuff, sizeof(this->writeBuff));
+
+					this->currChannel = channel;
+					channel->rxBuff->WriteBytes(readBuff, (size_t)numRead);
+					printSink.Flush();
+					this->currChannel = NULL;
+
+					printSink = prevPrintSink;
+
+					// The peer stopped reading (and the channel wasn't removed by its own command)
+					if(channel->isWriteStalled && (channel->rxBuff != NULL))
+						this->CloseChannel(channel);
+					return;
+				}
+
+				if((numRead < 0) && ((errno == EAGAIN) || (errno == EWOULDBLOCK) || (errno == EINTR)))
+					return;
+
+				// 0 is end-of-file, anything else is an error
+				this->CloseChannel(channel);
+				return;
+			}
+
+			if(events & (EPOLLHUP | EPOLLERR))
+				this->CloseChannel(channel);
+		}
+
+		void IoDriver::CloseChannel(Channel* channel)
+		{
+			int fd = channel->fd;
+			this->RemoveChannel(fd);
+
+			if(this->channelClosedCallback.IsValid())
+				this->channelClosedCallback.Execute(fd);
+		}
+
+		void IoDriver::WriteToCurrChannel(PrintChunk chunk)
+		{
+			// The channel may have been removed by its own command, or have stopped reading
+			if((this->currChannel == NULL) || (this->currChannel->rxBuff == NULL) || this->currChannel->isWriteStalled)
+				return;
+
+			int fd = this->currChannel->fd;
+			const char* msg = chunk.chars;
+			size_t numToWrite = chunk.numChars;
+			while(numToWrite > 0)
+			{
+				ssize_t numWritten = write(fd, msg, numToWrite);
+				if(numWritten > 0)
+				{
+					msg += numWritten;
+					numToWrite -= (size_t)numWritten;
+				}
+				else if((numWritten < 0) && (errno == EINTR))
+					continue;
+				else if((numWritten < 0) && ((errno == EAGAIN) || (errno == EWOULDBLOCK)))
+				{
+					// The fd is non-blocking, so wait here for room rather than lose part of a response, but not
+					// for long, since the other channels wait too
+					struct pollfd pollFd;
+					pollFd.fd = fd;
+					pollFd.events = POLLOUT;
+					int pollResult = poll(&pollFd, 1, clide_IO_DRIVER_WRITE_TIMEOUT_MS);
+					if(pollResult == 0)
+					{
+						this->currChannel->isWriteStalled = true;
+						return;
+					}
+					if((pollResult < 0) && (errno != EINTR))
+						return;
+				}
+				else
+					return;
+			}
+		}
+
+	} // namespace MClide
+} // namespace MbeddedNinja
+
+#endif	// #if(defined __linux__)
+
+// EOF
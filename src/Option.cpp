@@ -2,7 +2,7 @@
 //! @file 			Option.hpp
 //! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
 //! @created		2013-04-02
-//! @last-modified 	2014-10-07
+//! @last-modified 	2026-10-17
 //! @brief 		 	The option class enables used of 'optional' parameters in the command-line interface.
 //! @details
 //!					See README.rst in repo root dir for more info.
@@ -98,6 +98,14 @@ namespace MbeddedNinja
 				false);
 		}
 
+		bool Option::IsDetected() const
+		{
+			// Detected only if stamped in the same parse that the command was last detected in
+			return (this->parentCmd != NULL)
+				&& (this->detectedGeneration != 0)
+				&& (this->detectedGeneration == this->parentCmd->detectedGeneration);
+		}
+
 		Option::~Option()
 		{
 			// Destructor
@@ -159,7 +167,11 @@ namespace MbeddedNinja
 			this->callBackFunc = callBackFunc;
 
 			// DETECTED?
-			this->isDetected = false;
+			this->detectedGeneration = 0;
+
+			// Assigned when the option is registered with a command
+			this->parentCmd = NULL;
+			this->index = OptionHandle::INVALID;
 
 			// ASSOCIATED VALUE?
 			this->associatedValue = associatedValue;
@@ -0,0 +1,92 @@
+//!
+//! @file 			OptionParser.cpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! @created		2026-10-16
+//! @last-modified 	2026-10-17
+//! @brief 			A single-pass option parser, used by Rx in place of getopt_long() when selected, and by StaticRx.
+//! @details
+//!					See README.rst in repo root dir for more info.
+
+#ifndef __cplusplus
+	#error Please build with C++ compiler
+#endif
+
+//===============================================================================================//
+//========================================= INCLUDES ============================================//
+//===============================================================================================//
+
+//===== SYSTEM LIBRARIES =====//
+#include <stdint.h>
+
+//===== USER SOURCE =====//
+#include "../include/Config.hpp"
+#include "../include/HashIndex.hpp"
+#include "../include/Option.hpp"
+#include "../include/Cmd.hpp"
+#include "../include/OptionParser.hpp"
+
+namespace MbeddedNinja
+{
+	namespace MClideNs
+	{
+
+		//===============================================================================================//
+		//======================================= PUBLIC METHODS ========================================//
+		//===============================================================================================//
+
+		CmdOptions::CmdOptions(const Cmd* cmd)
+		{
+			this->cmd = cmd;
+		}
+
+		Option* CmdOptions::NoOption()
+		{
+			return NULL;
+		}
+
+		#if(clide_ENABLE_AUTO_HELP == 1)
+			Option* CmdOptions::HelpOption()
+			{
+				return Cmd::GetHelpOption();
+			}
+		#endif
+
+		Option* CmdOptions::FindShortOption(char shortName) const
+		{
+			return this->cmd->FindOptionByShortName(shortName);
+		}
+
+		Option* CmdOptions::FindLongOption(const char* name, uint32_t nameLen) const
+		{
+			// Found without comparing any names
+			uint32_t optionIndex = this->cmd->longOptionIndex.Find(name, nameLen);
+			if(optionIndex == HashIndex::NOT_FOUND)
+				return NULL;
+
+			return this->cmd->optionA[optionIndex];
+		}
+
+		uint32_t CmdOptions::GetNumOptions() const
+		{
+			return this->cmd->optionA.Size();
+		}
+
+		const char* CmdOptions::GetLongName(uint32_t optionNum) const
+		{
+			return this->cmd->optionA[optionNum]->longName.cStr;
+		}
+
+		Option* CmdOptions::GetOption(uint32_t optionNum) const
+		{
+			return this->cmd->optionA[optionNum];
+		}
+
+		bool CmdOptions::HasValue(Option* option) const
+		{
+			return option->associatedValue;
+		}
+
+	} // namespace MClide
+} // namespace MbeddedNinja
+
+// EOF
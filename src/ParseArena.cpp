@@ -0,0 +1,73 @@
+//!
+//! @file 			ParseArena.cpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! @created		2026-10-16
+//! @last-modified 	2026-10-16
+//! @brief 			A simple bump allocator over caller-supplied memory, used by Rx when parsing long messages.
+//! @details
+//!					See README.rst in repo root dir for more info.
+
+#ifndef __cplusplus
+	#error Please build with C++ compiler
+#endif
+
+//===============================================================================================//
+//========================================= INCLUDES ============================================//
+//===============================================================================================//
+
+//===== SYSTEM LIBRARIES =====//
+#include <stdint.h>
+#include <stddef.h>		// size_t
+
+//===== USER SOURCE =====//
+#include "../include/ParseArena.hpp"
+
+namespace MbeddedNinja
+{
+	namespace MClideNs
+	{
+
+		//===============================================================================================//
+		//======================================= PUBLIC METHODS ========================================//
+		//===============================================================================================//
+
+		ParseArena::ParseArena(void* buff, size_t buffSize)
+		{
+			this->buff = (uint8_t*)buff;
+			this->buffSize = buffSize;
+			this->used = 0;
+		}
+
+		void* ParseArena::Alloc(size_t size, size_t align)
+		{
+			// Round the next free address up to the required alignment
+			uintptr_t start = ((uintptr_t)&this->buff[this->used] + (align - 1)) & ~(uintptr_t)(align - 1);
+			size_t newUsed = (size_t)(start - (uintptr_t)this->buff) + size;
+
+			if(newUsed > this->buffSize)
+				return NULL;
+
+			this->used = newUsed;
+			return (void*)start;
+		}
+
+		size_t ParseArena::GetUsed() const
+		{
+			return this->used;
+		}
+
+		void ParseArena::Release(size_t used)
+		{
+			if(used < this->used)
+				this->used = used;
+		}
+
+		void ParseArena::Reset()
+		{
+			this->used = 0;
+		}
+
+	} // namespace MClide
+} // namespace MbeddedNinja
+
+// EOF
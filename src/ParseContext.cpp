@@ -0,0 +1,63 @@
+//!
+//! @file 			ParseContext.cpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! @created		2026-10-16
+//! @last-modified 	2026-10-17
+//! @brief 			Holds all of the state used while Rx is parsing one command message.
+//! @details
+//!					See README.rst in repo root dir for more info.
+
+#ifndef __cplusplus
+	#error Please build with C++ compiler
+#endif
+
+//===============================================================================================//
+//========================================= INCLUDES ============================================//
+//===============================================================================================//
+
+//===== SYSTEM LIBRARIES =====//
+#include <string.h>		// memset()
+
+//===== USER SOURCE =====//
+#include "../include/Config.hpp"
+#include "../include/GetOpt.hpp"
+#include "../include/ParseArena.hpp"
+#include "../include/ParseContext.hpp"
+
+namespace MbeddedNinja
+{
+	namespace MClideNs
+	{
+
+		//===============================================================================================//
+		//======================================= PUBLIC METHODS ========================================//
+		//===============================================================================================//
+
+		ParseContext::ParseContext(ParseArena* arena)
+		{
+			// Remember where the arena was up to, so a nested parse only frees its own memory
+			this->arena = arena;
+			this->arenaMark = (arena != NULL) ? arena->GetUsed() : 0;
+
+			this->isRejected = false;
+
+			// Clears the internal getopt_long() members (including __initialized)
+			memset(&this->getoptData, 0, sizeof(this->getoptData));
+
+			// optind = 0 makes getopt_long_r() initialise itself on the first call
+			this->getoptData.optind = 0;
+
+			// Let getopt_long_r() report unrecognised options (only printed if debug code is enabled)
+			this->getoptData.opterr = 1;
+		}
+
+		ParseContext::~ParseContext()
+		{
+			if(this->arena != NULL)
+				this->arena->Release(this->arenaMark);
+		}
+
+	} // namespace MClide
+} // namespace MbeddedNinja
+
+// EOF
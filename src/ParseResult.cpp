@@ -0,0 +1,193 @@
+//!
+//! @file 			ParseResult.cpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! @created		2026-10-16
+//! @last-modified 	2026-10-17
+//! @brief 			Holds what Rx found in one received command (detected options, option values and parameters).
+//! @details
+//!					See README.rst in repo root dir for more info.
+
+#ifndef __cplusplus
+	#error Please build with C++ compiler
+#endif
+
+//===============================================================================================//
+//========================================= INCLUDES ============================================//
+//===============================================================================================//
+
+//===== SYSTEM LIBRARIES =====//
+#include <stdint.h>
+#include <string.h>		// memset()
+
+//===== USER SOURCE =====//
+#include "../include/Config.hpp"
+#include "../include/Option.hpp"
+#include "../include/Cmd.hpp"
+#include "../include/ParseResult.hpp"
+
+namespace MbeddedNinja
+{
+	namespace MClideNs
+	{
+
+		//===============================================================================================//
+		//======================================= PUBLIC METHODS ========================================//
+		//===============================================================================================//
+
+		ParseResult::ParseResult(Cmd* cmd, ParseArena* arena) :
+			optionResultA(arena),
+			typedParamA(arena)
+		{
+			this->cmd = cmd;
+
+			uint32_t numOptions = cmd->optionA.Size();
+			this->optionResultA.Reserve(numOptions);
+			memset(this->optionResultA.Data(), 0, sizeof(OptionResult)*numOptions);
+
+			this->paramA = NULL;
+			this->numParams = 0;
+
+			// Only filled in for typed parameters, so not cleared
+			this->typedParamA.Reserve(cmd->paramA.Size());
+		}
+
+		Cmd* ParseResult::GetCmd() const
+		{
+			return this->cmd;
+		}
+
+		bool ParseResult::IsDetected(const Option* option) const
+		{
+			int32_t optionIndex = this->GetOptionIndex(option);
+			if(optionIndex < 0)
+				return false;
+
+			return this->optionResultA[optionIndex].isDetected;
+		}
+
+		const char* ParseResult::GetValue(const Option* option) const
+		{
+			int32_t optionIndex = this->GetOptionIndex(option);
+			if(optionIndex < 0)
+				return NULL;
+
+			return this->optionResultA[optionIndex].value;
+		}
+
+		const Value* ParseResult::GetTypedValue(const Option* option) const
+		{
+			int32_t optionIndex = this->GetOptionIndex(option);
+			if((optionIndex < 0) || !this->optionResultA[optionIndex].isTyped)
+				return NULL;
+
+			return &this->optionResultA[optionIndex].typedValue;
+		}
+
+		bool ParseResult::IsDetected(OptionHandle optionHandle) const
+		{
+			int32_t optionIndex = this->GetOptionIndex(optionHandle);
+			if(optionIndex < 0)
+				return false;
+
+			return this->optionResultA[optionIndex].isDetected;
+		}
+
+		const char* ParseResult::GetValue(OptionHandle optionHandle) const
+		{
+			int32_t optionIndex = this->GetOptionIndex(optionHandle);
+			if(optionIndex < 0)
+				return NULL;
+
+			return this->optionResultA[optionIndex].value;
+		}
+
+		const Value* ParseResult::GetTypedValue(OptionHandle optionHandle) const
+		{
+			int32_t optionIndex = this->GetOptionIndex(optionHandle);
+			if((optionIndex < 0) || !this->optionResultA[optionIndex].isTyped)
+				return NULL;
+
+			return &this->optionResultA[optionIndex].typedValue;
+		}
+
+		const Value* ParseResult::GetTypedParam(uint32_t paramNum) const
+		{
+			if((paramNum >= this->numParams) || (this->cmd->paramA[paramNum]->valueSpec.type == ValueType::STRING))
+				return NULL;
+
+			return &this->typedParamA[paramNum];
+		}
+
+		uint32_t ParseResult::GetNumParams() const
+		{
+			return this->numParams;
+		}
+
+		const char* ParseResult::GetParam(uint32_t paramNum) const
+		{
+			if(paramNum >= this->numParams)
+				return NULL;
+
+			return this->paramA[paramNum];
+		}
+
+		void ParseResult::SetDetected(const Option* option, const char* value)
+		{
+			int32_t optionIndex = this->GetOptionIndex(option);
+			if(optionIndex < 0)
+				return;
+
+			this->optionResultA[optionIndex].isDetected = true;
+			this->optionResultA[optionIndex].value = value;
+		}
+
+		void ParseResult::SetParams(char* const* paramA, uint32_t numParams)
+		{
+			this->paramA = paramA;
+			this->numParams = numParams;
+		}
+
+		void ParseResult::SetTypedValue(const Option* option, const Value& value)
+		{
+			int32_t optionIndex = this->GetOptionIndex(option);
+			if(optionIndex < 0)
+				return;
+
+			this->optionResultA[optionIndex].typedValue = value;
+			this->optionResultA[optionIndex].isTyped = true;
+		}
+
+		void ParseResult::SetTypedParam(uint32_t paramNum, const Value& value)
+		{
+			if(paramNum >= this->numParams)
+				return;
+
+			this->typedParamA[paramNum] = value;
+		}
+
+		//===============================================================================================//
+		//====================================== PRIVATE METHODS ========================================//
+		//===============================================================================================//
+
+		int32_t ParseResult::GetOptionIndex(const Option* option) const
+		{
+			// The index is remembered when the option is registered, so no searching is needed
+			if((option == NULL) || (option->parentCmd != this->cmd))
+				return -1;
+
+			return (int32_t)option->index;
+		}
+
+		int32_t ParseResult::GetOptionIndex(OptionHandle optionHandle) const
+		{
+			// Options can't be registered while a command is being parsed, so this is the size of optionResultA
+			if(optionHandle.index >= this->cmd->optionA.Size())
+				return -1;
+
+			return (int32_t)optionHandle.index;
+		}
+
+	} // namespace MClide
+} // namespace MbeddedNinja
+
+// EOF
@@ -2,7 +2,7 @@
 //! @file				Print.cpp
 //! @author				Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
 //! @created			2012-03-19
-//! @last-modified		2014-10-07
+//! @last-modified		2026-10-16
 //! @brief 				Contains callbacks for port-specific print operations.
 //! @details
 //!						See README.rst in repo root dir for more info.
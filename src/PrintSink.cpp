@@ -0,0 +1,140 @@
+//!
+//! @file 			PrintSink.cpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! @created		2026-10-16
+//! @last-modified 	2026-10-16
+//! @brief 			Where one Rx/Tx object's output goes.
+//! @details
+//!					See README.rst in repo root dir for more info.
+
+#ifndef __cplusplus
+	#error Please build with C++ compiler
+#endif
+
+//===============================================================================================//
+//========================================= INCLUDES ============================================//
+//===============================================================================================//
+
+//===== SYSTEM LIBRARIES =====//
+#include <cstring>		// memcpy(), strlen()
+
+//===== USER SOURCE =====//
+#include "../include/Print.hpp"
+#include "../include/PrintSink.hpp"
+
+namespace MbeddedNinja
+{
+	namespace MClideNs
+	{
+
+		//===============================================================================================//
+		//======================================= PUBLIC METHODS ========================================//
+		//===============================================================================================//
+
+		PrintSink::PrintSink()
+		{
+			this->enableDebugInfoPrinting = true;
+			this->enableCmdLinePrinting = true;
+			this->enableErrorPrinting = true;
+
+			this->buff = NULL;
+			this->buffSize = 0;
+			this->buffWritePos = 0;
+		}
+
+		void PrintSink::AssignCallbacks(
+				MCallbacks::Callback<void, const char*> debugPrintCallback,
+				MCallbacks::Callback<void, const char*> cmdLinePrintCallback,
+				MCallbacks::Callback<void, const char*> errorPrintCallback)
+		{
+			this->debugPrintCallback = debugPrintCallback;
+			this->cmdLinePrintCallback = cmdLinePrintCallback;
+			this->errorPrintCallback = errorPrintCallback;
+		}
+
+		void PrintSink::SetBuffer(char* buff, size_t buffSize)
+		{
+			this->Flush();
+			this->buff = buff;
+			this->buffSize = (buff != NULL) ? buffSize : 0;
+		}
+
+		void PrintSink::Flush()
+		{
+			if(this->buffWritePos == 0)
+				return;
+
+			PrintChunk chunk;
+			chunk.chars = this->buff;
+			chunk.numChars = this->buffWritePos;
+			this->buffWritePos = 0;
+
+			if(this->cmdLineWriteCallback.IsValid())
+				this->cmdLineWriteCallback.Execute(chunk);
+		}
+
+		void PrintSink::PrintDebugInfo(const char* msg, Print::DebugPrintingLevel debugPrintingLevel) const
+		{
+			if(this->enableDebugInfoPrinting == false)
+				return;
+
+			if(this->debugPrintCallback.IsValid())
+				this->debugPrintCallback.Execute(msg);
+			else
+				Print::PrintDebugInfo(msg, debugPrintingLevel);
+		}
+
+		void PrintSink::PrintError(const char* msg) const
+		{
+			if(this->enableErrorPrinting == false)
+				return;
+
+			if(this->errorPrintCallback.IsValid())
+				this->errorPrintCallback.Execute(msg);
+			else
+				Print::PrintError(msg);
+		}
+
+		void PrintSink::PrintToCmdLine(const char* msg)
+		{
+			if(this->enableCmdLinePrinting == false)
+				return;
+
+			if(this->cmdLineWriteCallback.IsValid())
+			{
+				size_t msgLen = strlen(msg);
+
+				if(this->buff != NULL)
+				{
+					if(this->buffWritePos + msgLen <= this->buffSize)
+					{
+						memcpy(&this->buff[this->buffWritePos], msg, msgLen);
+						this->buffWritePos += msgLen;
+						return;
+					}
+
+					// Doesn't fit, make room. Anything still too big is passed on without being buffered.
+					this->Flush();
+					if(msgLen <= this->buffSize)
+					{
+						memcpy(this->buff, msg, msgLen);
+						this->buffWritePos = msgLen;
+						return;
+					}
+				}
+
+				PrintChunk chunk;
+				chunk.chars = msg;
+				chunk.numChars = msgLen;
+				this->cmdLineWriteCallback.Execute(chunk);
+			}
+			else if(this->cmdLinePrintCallback.IsValid())
+				this->cmdLinePrintCallback.Execute(msg);
+			else
+				Print::PrintToCmdLine(msg);
+		}
+
+	} // namespace MClide
+} // namespace MbeddedNinja
+
+// EOF
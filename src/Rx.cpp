@@ -2,7 +2,7 @@
 //! @file 			Rx.cpp
 //! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
 //! @created		2012-03-19
-//! @last-modified 	2014-10-09
+//! @last-modified 	2026-10-17
 //! @brief 			MClide RX controller. The main logic of the RX (decoding) part of MClide. Commands can be registered with the controller.
 //! @details
 //!					See README.rst in repo root dir for more info.
@@ -30,15 +30,17 @@
 
 //===== USER SOURCE =====//
 #include "../include/Config.hpp"
-#include "../include/Global.hpp"
-#include "../include/StringSplit.hpp"
+#include "../include/Tokenizer.hpp"
 #include "../include/Param.hpp"
 #include "../include/Option.hpp"
 #include "../include/Cmd.hpp"
 #include "../include/Print.hpp"
-#include "../include/Comm.hpp"			//!< So the help command can call the HelpCmdCallback() function
+#include "../include/Comm.hpp"			//!< So the help command can call the HelpCmdResultCallback() function
 #include "../include/Rx.hpp"
 #include "../include/GetOpt.hpp"
+#include "../include/ParseContext.hpp"
+#include "../include/SmallBuff.hpp"
+#include "../include/OptionParser.hpp"
 
 
 namespace MbeddedNinja
@@ -72,169 +74,244 @@ namespace MbeddedNinja
 
 		bool Rx::Run(int argc, char* argv[])
 		{
+			// New parse, this clears the detected state of every command and option. Once frozen, the
+			// detected state is not used, and nothing shared between parses is written to.
+			if(!this->IsFrozen())
+				this->NextParseGeneration();
+
+			// Holds all state for this parse
+			ParseContext context(this->parseArena);
+
 			// No need for any pre-processing, pass straight onto Rx::Run2().
+			bool returnValue;
 			if(this->ignoreFirstArgvElement)
-				return Rx::Run2(argc - 1, &argv[1]);
+				returnValue = Rx::Run2(context, argc - 1, &argv[1]);
 			else
-				return Rx::Run2(argc, argv);
+				returnValue = Rx::Run2(context, argc, argv);
+
+			// The whole response goes to the sink at once
+			this->printSink.Flush();
+			return returnValue;
+		}
+
+		bool Rx::Run(const char* cmdMsg)
+		{
+			// Null-terminated message, pass onto the (message, length) version
+			return this->Run(cmdMsg, strlen(cmdMsg));
 		}
 
-		bool Rx::Run(char* cmdMsg)
+		bool Rx::Run(const char* cmdMsg, size_t cmdMsgLen)
 		{
-			// Used for various snprintf() function calls
-			//char tempBuff[200];
+			bool returnValue = this->RunMsg(cmdMsg, cmdMsgLen);
 
-			// Copy the cmd message to a new location in where Rx::Run() can modify the contents
-			// (and leave the provided msg untouched)
-			char cmdMsgCpyA[strlen(cmdMsg)];
-			strcpy(cmdMsgCpyA, cmdMsg);
-			// Create
-			char* cmdMsgCpyPtr = &cmdMsgCpyA[0];
+			// The whole response goes to the sink at once
+			this->printSink.Flush();
+			return returnValue;
+		}
+
+		bool Rx::RunMsg(const char* cmdMsg, size_t cmdMsgLen)
+		{
+			// New parse, this clears the detected state of every command and option. Once frozen, the
+			// detected state is not used, and nothing shared between parses is written to.
+			if(!this->IsFrozen())
+				this->NextParseGeneration();
+
+			// Holds all state for this parse, so that nothing on the parse path is static
+			ParseContext context(this->parseArena);
 
 			#if(clide_ENABLE_DEBUG_CODE == 1)
-				Print::PrintDebugInfo(
+				this->printSink.PrintDebugInfo(
 						"CLIDE: Rx.Run() called.\r\n",
 						Print::DebugPrintingLevel::GENERAL);
 				snprintf(
-					Global::debugBuff,
-					sizeof(Global::debugBuff),
-					"CLIDE: Received msg = '%s'.\r\n",
+					context.debugBuff,
+					sizeof(context.debugBuff),
+					"CLIDE: Received msg = '%.*s'.\r\n",
+					(int)cmdMsgLen,
 					cmdMsg);
-				Print::PrintDebugInfo(
-						Global::debugBuff,
+				this->printSink.PrintDebugInfo(
+						context.debugBuff,
 						Print::DebugPrintingLevel::GENERAL);
 			#endif
 
-			//=========== RESET PARAMETERS ==============//
+			// Skip all non-alphanumeric characters at the start of the message. The message itself is never
+			// modified, so it can be read-only.
+			size_t msgStart = 0;
+			while((msgStart < cmdMsgLen) && !isalnum((unsigned char)cmdMsg[msgStart]))
+			{
+				#if(clide_ENABLE_DEBUG_CODE == 1)
+					snprintf(
+						context.debugBuff,
+						sizeof(context.debugBuff),
+						"CLIDE: Skipping char '%c' at start of msg.\r\n",
+						cmdMsg[msgStart]);
+					this->printSink.PrintDebugInfo(
+						context.debugBuff,
+						Print::DebugPrintingLevel::VERBOSE);
+				#endif
+				msgStart++;
+			}
 
-			//! @brief		Holds the split arguments from the command line
-			//! @todo 		Replace with malloc() calls, remove magic numbers
-			char* _args[10] = {0};
+			// Check for end of message
+			if(msgStart == cmdMsgLen)
+			{
+				#if(clide_ENABLE_AUTO_HELP == 1)
+					// Help exists, so tell user that they could type help to get a list of available commands.
+					char tempBuff[200];
+					// Bold if advanced text formatting is enabled
+					snprintf(
+						tempBuff,
+						sizeof(tempBuff),
+						"error \"Received command contained no alpha-numeric characters. "
+						"Type %shelp%s to see a list of all the commands.\"\r\n",
+						this->TextFormatBold(),
+						this->TextFormatNormal());
+					this->printSink.PrintToCmdLine(tempBuff);
+				#else // #if(clide_ENABLE_AUTO_HELP == 1)
+					this->printSink.PrintToCmdLine("error \"Received command contained no alpha-numeric characters.\"\r\n");
+					#if(clide_ENABLE_DEBUG_CODE == 1)
+						this->printSink.PrintDebugInfo(
+							"CLIDE: WARNING: Received command contained no alpha-numeric characters.\r\n",
+							Print::DebugPrintingLevel::GENERAL);
+					#endif
+					#if(clide_ENABLE_DEBUG_CODE == 1)
+						this->printSink.PrintDebugInfo(
+							"CLIDE: Rx::Run() finished. Returning false.\r\n",
+							Print::DebugPrintingLevel::VERBOSE);
+					#endif
+				#endif // #if(clide_ENABLE_AUTO_HELP == 1)
 
-			// Clear args
-			memset(_args, '\0', sizeof(_args));
+				return false;
+			}
 
-			// Reset cmdDetected flag for all commands
-			int32_t x;
-			for(x = 0; x < this->cmdA.Size(); x++)
+			const char* msg = &cmdMsg[msgStart];
+			size_t msgLen = cmdMsgLen - msgStart;
+
+			//=========== SPLIT MESSAGE INTO TOKEN VIEWS ==============//
+
+			// Short messages fit on the stack, longer ones spill into the parse arena (or onto the heap)
+			SmallBuff<TokenView, clide_NUM_INLINE_ARGS> tokenA(this->parseArena);
+
+			// There is always at least one token, since the message starts with an alphanumeric character
+			uint32_t numTokens = Tokenizer::Run(msg, msgLen, ' ', tokenA.Data(), tokenA.Capacity());
+
+			if(numTokens > tokenA.Capacity())
 			{
-				this->cmdA[x]->isDetected = false;
+				// Tokenizer counted all of the tokens, so one more pass is always enough
+				tokenA.Reserve(numTokens);
+				Tokenizer::Run(msg, msgLen, ' ', tokenA.Data(), tokenA.Capacity());
 			}
 
-			// Strip all non-alphanumeric characters from the start of the packet
-			while(!isalnum(cmdMsgCpyPtr[0]))
-			{
-				// Check for null string terminator
-				if(cmdMsgCpyPtr[0] == '\0')
-				{
+			//=============== CHECK COMMAND IS VALID ==================//
 
-					#if(clide_ENABLE_AUTO_HELP == 1)
-						// Help exists, so tell user that they could type help to get a list of available commands.
-						char tempBuff[200];
-						#if(clide_ENABLE_ADV_TEXT_FORMATTING == 1)
-							// Special formatting
-							snprintf(
-								tempBuff,
-								sizeof(tempBuff),
-								"error \"Received command contained no alpha-numeric characters. "
-								"Type %shelp%s to see a list of all the commands.\"\r\n",
-								clide_TERM_TEXT_FORMAT_BOLD,
-								clide_TERM_TEXT_FORMAT_NORMAL);
-							Print::PrintToCmdLine(tempBuff);
-						#else
-							// No special formatting
-							snprintf(
-								tempBuff,
-								sizeof(tempBuff),
-								"error \"Received command contained no alpha-numeric characters. "
-								"Type help to see a list of all the commands.\"\r\n");
-							Print::PrintToCmdLine(tempBuff);
-						#endif
-					#else // #if(clide_ENABLE_AUTO_HELP == 1)
-						Print::PrintToCmdLine("error \"Received command contained no alpha-numeric characters.\"\r\n");
-						#if(clide_ENABLE_DEBUG_CODE == 1)
-							Print::PrintDebugInfo(
-								"CLIDE: WARNING: Received command contained no alpha-numeric characters.\r\n",
-								Print::DebugPrintingLevel::GENERAL);
-						#endif
-						#if(clide_ENABLE_DEBUG_CODE == 1)
-							Print::PrintDebugInfo(
-								"CLIDE: Rx::Run() finished. Returning false.\r\n",
-								Print::DebugPrintingLevel::VERBOSE);
-						#endif
-					#endif // #if(clide_ENABLE_AUTO_HELP == 1)
+			// The command is looked up straight from the token view, no copy needed
+			Cmd* foundCmd = this->ValidateCmd(context, &msg[tokenA[0].offset], tokenA[0].length);
 
+			if(foundCmd == NULL)
+				return this->CmdNotRecognised(&msg[tokenA[0].offset], tokenA[0].length);
 
+			// Every token plus a null character always fits into msgLen + 1 chars
+			SmallBuff<char, clide_ARG_BUFF_SIZE> argBuff(this->parseArena);
+			argBuff.Reserve(msgLen + 1);
 
-					return false;
+			//============= PASS TOKEN VIEWS TO OPTION PARSER =============//
+
+			if(this->optionParserMode == OptionParserMode::SINGLE_PASS)
+			{
+				// OptionParser reads the tokens where they are in the message. Only option values and parameters
+				// are copied into argBuff, since they are handed to the command null-terminated.
+				SmallBuff<ArgView, clide_NUM_INLINE_ARGS> argA(this->parseArena);
+				argA.Reserve(numTokens);
+				for(uint32_t x = 0; x < numTokens; x++)
+				{
+					argA[x].chars = &msg[tokenA[x].offset];
+					argA[x].length = tokenA[x].length;
 				}
 
-				#if(clide_ENABLE_DEBUG_CODE == 1)
-					snprintf(
-						Global::debugBuff,
-						sizeof(Global::debugBuff),
-						"CLIDE: Removing char '%c' from rx buffer.\r\n",
-						cmdMsg[0]);
-					Print::PrintDebugInfo(
-						Global::debugBuff,
-						Print::DebugPrintingLevel::VERBOSE);
-				#endif
-				// Increment message pointer forward over non-alphanumeric char
-				cmdMsgCpyPtr++;
+				return this->RunCmd(context, foundCmd, numTokens, argA.Data(), argBuff.Data());
 			}
 
-			// Split packet. First element is command.
-			int numArgs = SplitPacket(cmdMsgCpyPtr, _args);
+			//============= MATERIALISE ARGUMENTS FOR GETOPT ==============//
+
+			// getopt_long() needs null-terminated arguments that it can permute, so every token is copied once.
+			// The array is null-terminated like the argv passed to main(), getopt_long() may read argv[argc]
+			SmallBuff<char*, clide_NUM_INLINE_ARGS + 1> _args(this->parseArena);
+			_args.Reserve(numTokens + 1);
 
-			// Call 2nd part of Run()
-			return this->Run2(numArgs, _args);
+			uint32_t argBuffPos = 0;
+			for(uint32_t x = 0; x < numTokens; x++)
+			{
+				_args[x] = &argBuff[argBuffPos];
+				memcpy(_args[x], &msg[tokenA[x].offset], tokenA[x].length);
+				argBuffPos += tokenA[x].length;
+				argBuff[argBuffPos++] = '\0';
+			}
 
+			_args[numTokens] = NULL;
+
+			return this->RunCmd(context, foundCmd, numTokens, _args.Data());
 		}
 
-		int Rx::Run2(uint8_t numArgs, char* _args[])
+		Cmd* Rx::FindCmd(const char* cmdName, uint32_t cmdNameLen, uint32_t cmdNameHash) const
 		{
+			uint32_t cmdIndex = this->cmdIndex.Find(cmdName, cmdNameLen, cmdNameHash);
+			if(cmdIndex == HashIndex::NOT_FOUND)
+				return NULL;
+			return this->cmdA[cmdIndex];
+		}
 
-			int32_t x;
+		bool Rx::RunArgs(Cmd* foundCmd, int numArgs, char* args[])
+		{
+			// Same as Run(const char*, size_t), but the message has already been split and looked up
+			if(!this->IsFrozen())
+				this->NextParseGeneration();
+
+			ParseContext context(this->parseArena);
 
-			//! @brief		Array of pointers to the arguments
-			char *(_argsPtr[10]);
+			#if(clide_ENABLE_DEBUG_CODE == 1)
+				snprintf(
+					context.debugBuff,
+					sizeof(context.debugBuff),
+					"CLIDE: Rx.RunArgs() called with cmd '%s' and %i args.\r\n",
+					args[0],
+					numArgs);
+				this->printSink.PrintDebugInfo(
+						context.debugBuff,
+						Print::DebugPrintingLevel::GENERAL);
+			#endif
 
-			_argsPtr[0] = _args[0];
-			_argsPtr[1] = _args[1];
-			_argsPtr[2] = _args[2];
-			_argsPtr[3] = _args[3];
-			_argsPtr[4] = _args[4];
-			_argsPtr[5] = _args[5];
-			_argsPtr[6] = _args[6];
-			_argsPtr[7] = _args[7];
-			_argsPtr[8] = _args[8];
-			_argsPtr[9] = _args[9];
+			bool returnValue;
+			if(foundCmd == NULL)
+				returnValue = this->CmdNotRecognised(args[0], strlen(args[0]));
+			else
+				returnValue = this->RunCmd(context, foundCmd, numArgs, args);
+
+			// The whole response goes to the sink at once
+			this->printSink.Flush();
+			return returnValue;
+		}
+
+		int Rx::Run2(ParseContext& context, int numArgs, char* _args[])
+		{
+
+			int32_t x;
 
 			//============== CHECK ARGV AND ARGC AGREE WITH EACH OTHER ==============//
 
 			// Check incase the number of arguments passed to Rx::Run was 0
-			if(numArgs == 0)
+			if(numArgs <= 0)
 			{
 				#if(clide_ENABLE_AUTO_HELP == 1)
 					char tempBuff[100];
 					// Help exists, so tell user that they could type help to get a list of available commands.
-					#if(clide_ENABLE_ADV_TEXT_FORMATTING == 1)
-						// Special formatting
-						snprintf(
-							tempBuff,
-							sizeof(tempBuff),
-							"error \"Command was empty. Type %shelp%s to see a list of all the commands.\"\r\n",
-							clide_TERM_TEXT_FORMAT_BOLD,
-							clide_TERM_TEXT_FORMAT_NORMAL);
-						Print::PrintToCmdLine(tempBuff);
-					#else
-						// No special formatting
-						snprintf(
-							tempBuff,
-							sizeof(tempBuff),
-							"error \"Command was empty. Type help to see a list of all the commands.\"\r\n");
-						Print::PrintToCmdLine(tempBuff);
-					#endif
+					// Bold if advanced text formatting is enabled
+					snprintf(
+						tempBuff,
+						sizeof(tempBuff),
+						"error \"Command was empty. Type %shelp%s to see a list of all the commands.\"\r\n",
+						this->TextFormatBold(),
+						this->TextFormatNormal());
+					this->printSink.PrintToCmdLine(tempBuff);
 				#else
 					// No automatic help, so don't tell the user about something that doesn't exist
 					snprintf(
@@ -242,9 +319,9 @@ namespace MbeddedNinja
 						sizeof(tempBuff),
 						"error \"Command was empty.\"\r\n",
 						_args[0]);
-					Print::PrintToCmdLine(tempBuff);
+					this->printSink.PrintToCmdLine(tempBuff);
 				#endif // #if(clide_ENABLE_AUTO_HELP == 1)
-				Print::PrintError("ERROR: Number of arguments passed to Rx::Run was 0.\r\n");
+				this->printSink.PrintError("ERROR: Number of arguments passed to Rx::Run was 0.\r\n");
 				return false;
 			}
 
@@ -253,90 +330,63 @@ namespace MbeddedNinja
 			{
 				if(_args[x] == NULL)
 				{
-					Print::PrintError("ERROR: Number of non-null variables passed to Rx::Run in argv was not equal to the number argc.\r\n");
+					this->printSink.PrintError("ERROR: Number of non-null variables passed to Rx::Run in argv was not equal to the number argc.\r\n");
 					return false;
 				}
 			}
 
 			//=============== CHECK COMMAND IS VALID ==================//
 
-			Cmd* foundCmd = this->ValidateCmd(_args[0], cmdA);
+			Cmd* foundCmd = this->ValidateCmd(context, _args[0], strlen(_args[0]));
 
 			// Check for registered command
 			if(foundCmd == NULL)
-			{
-				// Only print this error is user has not silenced it
-				if(this->silenceCmdNotRecognisedError == false)
-				{
-					char tempBuff[100];
-					// Received command is not registered (aka invalid/unrecognised)
-					#if(clide_ENABLE_AUTO_HELP == 1)
-						// Help exists, so tell user that they could type help to get a list of available commands.
-						#if(clide_ENABLE_ADV_TEXT_FORMATTING == 1)
-							// Special formatting
-							snprintf(
-								tempBuff,
-								sizeof(tempBuff),
-								"error \"Command '%s' not recognised. Type %shelp%s to see a list of all the commands.\"\r\n",
-								_args[0],
-								clide_TERM_TEXT_FORMAT_BOLD,
-								clide_TERM_TEXT_FORMAT_NORMAL);
-							Print::PrintToCmdLine(tempBuff);
-						#else
-							// No special formatting
-							snprintf(
-								tempBuff,
-								sizeof(tempBuff),
-								"error \"Command '%s' not recognised. Type help to see a list of all the commands.\"\r\n",
-								_args[0]);
-							Print::PrintToCmdLine(tempBuff);
-						#endif
-					#else
-						// No automatic help, so don't tell the user about something that doesn't exist
-						snprintf(
-							tempBuff,
-							sizeof(tempBuff),
-							"error \"Command '%s' not recognised.\"\r\n",
-							_args[0]);
-						Print::PrintToCmdLine(tempBuff);
-					#endif // #if(clide_ENABLE_AUTO_HELP == 1)
-				}
+				return this->CmdNotRecognised(_args[0], strlen(_args[0]));
+
+			// getopt_long() permutes the argument array, so work on a copy to leave the caller's untouched
+			SmallBuff<char*, clide_NUM_INLINE_ARGS + 1> _argsPtr(context.arena);
+			_argsPtr.Reserve(numArgs + 1);
+			memcpy(_argsPtr.Data(), _args, sizeof(char*)*numArgs);
+			_argsPtr[numArgs] = NULL;
 
-				// Log error
-				//this->log.logId = LogIds::CMD_NOT_RECOGNISED;
-				//this->log.msg = (char*)"Command not recognised.";
-				//this->log.severity = Severity::ERROR;
+			return this->RunCmd(context, foundCmd, numArgs, _argsPtr.Data());
+		}
+
+		bool Rx::RunCmd(ParseContext& context, Cmd* foundCmd, int numArgs, char* _argsPtr[])
+		{
+			int32_t x;
 
-				// Call callback if assigned
-				if(this->cmdUnrecogCallback.obj != NULL)
+			if(this->optionParserMode == OptionParserMode::SINGLE_PASS)
+			{
+				// The arguments are already null-terminated, so OptionParser hands out pointers into them
+				SmallBuff<ArgView, clide_NUM_INLINE_ARGS> argA(context.arena);
+				argA.Reserve((uint32_t)numArgs);
+				for(x = 0; x < numArgs; x++)
 				{
-					#if(clide_ENABLE_DEBUG_CODE == 1)
-						Print::PrintDebugInfo(
-							"CLIDE: .\r\n",
-							Print::DebugPrintingLevel::VERBOSE);
-					#endif
-					this->cmdUnrecogCallback.Execute(_args[0]);
+					argA[x].chars = _argsPtr[x];
+					argA[x].length = (uint32_t)strlen(_argsPtr[x]);
 				}
 
-				#if(clide_ENABLE_DEBUG_CODE == 1)
-					Print::PrintDebugInfo(
-						"CLIDE: Rx::Run() finished. Returning false.\r\n",
-						Print::DebugPrintingLevel::VERBOSE);
-				#endif
-				return false;
+				return this->RunCmd(context, foundCmd, (uint32_t)numArgs, argA.Data(), NULL);
 			}
 
-			// Valid command found, set detected flag to true.
-			foundCmd->isDetected = true;
+			// Valid command found, set detected flag to true by stamping it with the current generation.
+			// This also clears the detected state of all its options, since they are only detected
+			// if stamped with the same generation.
+			if(!this->IsFrozen())
+				foundCmd->detectedGeneration = this->parseGeneration;
+
+			// Everything received for this command, passed to the result callbacks
+			ParseResult result(foundCmd, context.arena);
 
 			#if(clide_ENABLE_DEBUG_CODE == 1)
 				snprintf(
-					Global::debugBuff,
-					sizeof(Global::debugBuff),
-					"CLIDE: Num arguments = %" PRIu8 "\r\n",
+					context.debugBuff,
+					sizeof(context.debugBuff),
+					"CLIDE: Num arguments = %i\r\n",
 					numArgs);
-				Print::PrintDebugInfo(
-					Global::debugBuff,
+				this->printSink.PrintDebugInfo(
+					context.debugBuff,
 					Print::DebugPrintingLevel::VERBOSE);
 			#endif
 
@@ -346,153 +396,274 @@ namespace MbeddedNinja
 			// Holds the index of the last found option
 			//uint8 indexLastOption = 0;
 
-			// Clear the isDetected for all options registered with incoming cmd
-			// Set true later in function if the option is detected
-			for(x = 0; (uint32_t)x < foundCmd->optionA.Size(); x++)
-			{
-				foundCmd->optionA[x]->isDetected = false;
-				foundCmd->optionA[x]->longOptionDetected = 0;
-			}
-			
 			#if(clide_ENABLE_DEBUG_CODE == 1)
-				Print::PrintDebugInfo(
+				this->printSink.PrintDebugInfo(
 					"CLIDE: Re-arranged arguments = ",
 					Print::DebugPrintingLevel::VERBOSE);
 
 				// Print re-arranged arguments
-				uint8_t count = 0;
+				int count = 0;
 				while(count < numArgs)
 				{
-					Print::PrintDebugInfo(_argsPtr[count], Print::DebugPrintingLevel::VERBOSE);
-					Print::PrintDebugInfo(", ", Print::DebugPrintingLevel::VERBOSE);
+					this->printSink.PrintDebugInfo(_argsPtr[count], Print::DebugPrintingLevel::VERBOSE);
+					this->printSink.PrintDebugInfo(", ", Print::DebugPrintingLevel::VERBOSE);
 					count++;
 				}
-				Print::PrintDebugInfo(
+				this->printSink.PrintDebugInfo(
 					"\r\n",
 					Print::DebugPrintingLevel::VERBOSE);
 
 				snprintf(
-					Global::debugBuff,
-					sizeof(Global::debugBuff),
+					context.debugBuff,
+					sizeof(context.debugBuff),
 					"CLIDE: Num registered options = %zu\r\n",
 					foundCmd->optionA.Size());
-				Print::PrintDebugInfo(Global::debugBuff, Print::DebugPrintingLevel::VERBOSE);
+				this->printSink.PrintDebugInfo(context.debugBuff, Print::DebugPrintingLevel::VERBOSE);
+			#endif
+
+			//==================== PARSE OPTIONS ====================//
+
+			// Set to the parameters (the arguments that are not options or option values), in the order received
+			char** paramA = NULL;
+			uint32_t numParams = 0;
+
+			bool helpPrinted = this->ParseOptionsGetOpt(context, foundCmd, result, numArgs, _argsPtr, &paramA, &numParams);
+
+			// A rejected option value has already printed an error response
+			if(context.isRejected)
+				return false;
+
+			// Help is a special option. Once it is discovered in the command, no further processing is done, so exit
+			if(helpPrinted)
+				return true;
+
+			return this->FinishCmd(context, foundCmd, result, paramA, numParams);
+		}
+
+		bool Rx::RunCmd(ParseContext& context, Cmd* foundCmd, uint32_t numArgs, const ArgView argA[], char* argBuff)
+		{
+			// Valid command found, stamp it with the current generation (see above)
+			if(!this->IsFrozen())
+				foundCmd->detectedGeneration = this->parseGeneration;
+
+			// Everything received for this command, passed to the result callbacks
+			ParseResult result(foundCmd, context.arena);
+
+			#if(clide_ENABLE_DEBUG_CODE == 1)
+				snprintf(
+					context.debugBuff,
+					sizeof(context.debugBuff),
+					"CLIDE: Num arguments = %" PRIu32 ". Num registered options = %zu\r\n",
+					numArgs,
+					foundCmd->optionA.Size());
+				this->printSink.PrintDebugInfo(context.debugBuff, Print::DebugPrintingLevel::VERBOSE);
 			#endif
 
-			//==================== BUILD OPTION STRING ===================//
+			//==================== PARSE OPTIONS ====================//
 
-			// Size to hold all chars plus one for null char
-			char optionString[50] = {0};
+			// Set to the parameters (the arguments that are not options or option values), in the order received
+			SmallBuff<char*, clide_NUM_INLINE_ARGS> paramA(context.arena);
+			paramA.Reserve(numArgs);
+			uint32_t numParams = 0;
 
-			this->BuildShortOptionString(optionString, foundCmd);
+			bool helpPrinted = this->ParseOptionsSinglePass(context, foundCmd, result, numArgs, argA, argBuff, paramA.Data(), &numParams);
+
+			// A rejected option value has already printed an error response
+			if(context.isRejected)
+				return false;
+
+			// Help is a special option. Once it is discovered in the command, no further processing is done, so exit
+			if(helpPrinted)
+				return true;
+
+			return this->FinishCmd(context, foundCmd, result, paramA.Data(), numParams);
+		}
+
+		bool Rx::FinishCmd(ParseContext& context, Cmd* foundCmd, ParseResult& result, char** paramA, uint32_t numParams)
+		{
+			//============= VALIDATE/PROCESS PARAMETERS =============//
+
+			// Validate that there are the correct number of parameters
+			if(numParams != foundCmd->paramA.Size())
+			{
+				char tempBuff[100];
+				snprintf(
+						tempBuff,
+						sizeof(tempBuff),
+						"error \"Num. of received parameters ('%" PRIu32 "') does not match num. registered for cmd ('%zu').\"\r\n",
+						numParams,
+						foundCmd->paramA.Size());
+				this->printSink.PrintToCmdLine(tempBuff);
+				#if(clide_ENABLE_DEBUG_CODE == 1)
+					snprintf (
+						context.debugBuff,
+						sizeof(context.debugBuff),
+						"CLIDE: ERROR: Num. of received parameters ('%" STR(ClidePort_PF_UINT32_T)
+						"') for cmd '%s' does not match num. registered ('%zu').\r\n",
+						numParams,
+						foundCmd->name.cStr,
+						foundCmd->paramA.Size());
+					this->printSink.PrintError(context.debugBuff);
+				#endif
+				#if(clide_ENABLE_DEBUG_CODE == 1)
+					this->printSink.PrintDebugInfo("CLIDE: Rx::Run() finished. Returning false.\r\n", Print::DebugPrintingLevel::VERBOSE);
+				#endif
+				return false;
+			}
+
+			result.SetParams(paramA, numParams);
+
+			if(!this->ConvertParams(context, foundCmd, result, paramA))
+				return false;
+
+			// Copy parameters into cmd string (not once frozen, the parameters are only in the result)
+			if(!this->IsFrozen())
+			{
+				for(uint32_t x = 0; x < foundCmd->paramA.Size(); x++)
+				{
+					foundCmd->paramA[x]->value = MString(paramA[x]);
+				}
+			}
+
+			#if(clide_ENABLE_DEBUG_CODE == 1)
+				uint32_t count;
+				this->printSink.PrintDebugInfo("CLIDE: Parameters = ", Print::DebugPrintingLevel::VERBOSE);
+				// Get parameters
+				if(numParams == 0)
+					this->printSink.PrintDebugInfo("(none)", Print::DebugPrintingLevel::VERBOSE);
+				else
+				{
+					for(count = 0; (uint32_t)count < numParams; count++)
+					{
+						this->printSink.PrintDebugInfo(paramA[count], Print::DebugPrintingLevel::VERBOSE);
+						this->printSink.PrintDebugInfo(", ", Print::DebugPrintingLevel::VERBOSE);
+					}
+				}
+				this->printSink.PrintDebugInfo("\r\n", Print::DebugPrintingLevel::VERBOSE);
+			#endif
+
+			// Make sure callbacks are the last thing to do in Run()
+			if((foundCmd->functionCallback != NULL) || foundCmd->methodCallback.IsValid()
+				|| (foundCmd->resultFunctionCallback != NULL) || foundCmd->resultMethodCallback.IsValid())
+			{
+				// Check to see if a call-back function has been assigned
+				if(foundCmd->functionCallback != NULL)
+				{
+					// Execute command callback function
+					foundCmd->functionCallback(foundCmd);
+				}
+
+				if(foundCmd->methodCallback.IsValid() == true)
+				{
+					// Call method callback
+					foundCmd->methodCallback.Execute(foundCmd);
+				}
+
+				if(foundCmd->resultFunctionCallback != NULL)
+				{
+					// Execute command result callback function
+					foundCmd->resultFunctionCallback(result);
+				}
+
+				if(foundCmd->resultMethodCallback.IsValid() == true)
+				{
+					// Call result method callback
+					foundCmd->resultMethodCallback.Execute(result);
+				}
+
+			}
+			else
+			{
+				#if(clide_ENABLE_DEBUG_CODE == 1)
+					this->printSink.PrintDebugInfo("CLIDE: Command callback(s) were NULL, so no function/method called.\r\n", Print::DebugPrintingLevel::VERBOSE);
+				#endif
+			}
+
+			#if(clide_ENABLE_DEBUG_CODE == 1)
+				this->printSink.PrintDebugInfo("CLIDE: Rx::Run() finished. Returning true.\r\n", Print::DebugPrintingLevel::VERBOSE);
+			#endif
+			return true;
+		}
+
+		//===============================================================================================//
+		//==================================== PRIVATE FUNCTIONS ========================================//
+		//===============================================================================================//
+
+		bool Rx::ParseOptionsGetOpt(ParseContext& context, Cmd* foundCmd, ParseResult& result, int numArgs, char* _argsPtr[], char*** paramA, uint32_t* numParams)
+		{
+			//==================== COMPILED OPTIONS ===================//
+
+			// The short option string and long option table are compiled by the command when options
+			// are registered, so nothing needs to be built here
+			const char* optionString = foundCmd->shortOptionString;
 
 			#if(clide_ENABLE_DEBUG_CODE == 1)
 				snprintf(
-					Global::debugBuff,
-					sizeof(Global::debugBuff),
+					context.debugBuff,
+					sizeof(context.debugBuff),
 					"CLIDE: Option string = '%s'.\r\n",
 					optionString);
-				Print::PrintDebugInfo(Global::debugBuff, Print::DebugPrintingLevel::VERBOSE);
+				this->printSink.PrintDebugInfo(context.debugBuff, Print::DebugPrintingLevel::VERBOSE);
 			#endif
 
 			//============== USE THE GETOPT FUNCTION =================//
 
-			// Reset getopt() for next call of Run()
-			// getopt() was only ever designed to be run once
-			GetOpt::optind = 0;
-			x = 0;
-			GetOpt::optarg = NULL;
-			GetOpt::optopt = 0;
-
-			// Find number of long options in cmd and create struct var
-			// for them
-			struct GetOpt::option longOptionsA[20];
-
-			// Build the struct for getopt_long
-			BuildLongOptionStruct(longOptionsA, foundCmd);
+			// getopt_long_r() keeps all of its state in the parse context, which starts
+			// out reset, so there are no static variables to reset here
+			int32_t x = 0;
 
 			// getopt_long stores the option index here.
 			int option_index = 0;
 
 			#if(clide_ENABLE_DEBUG_CODE == 1)
-				Print::PrintDebugInfo("CLIDE: Entering getopt_long() loop.\r\n", Print::DebugPrintingLevel::VERBOSE);
+				// getopt_long_r() prints its debug and error messages to this Rx's sink too
+				context.getoptData.printSink = &this->printSink;
+
+				this->printSink.PrintDebugInfo("CLIDE: Entering getopt_long() loop.\r\n", Print::DebugPrintingLevel::VERBOSE);
 			#endif
 
 			// getopt() returns -1 when complete
-			while((x = GetOpt::getopt_long(numArgs, _argsPtr, optionString, longOptionsA, &option_index)) != -1)
+			while((x = GetOpt::getopt_long_r(numArgs, _argsPtr, optionString, foundCmd->longOptionsA, &option_index, &context.getoptData)) != -1)
 			{
 
 				#if(clide_ENABLE_DEBUG_CODE == 1)				
-					Print::PrintDebugInfo(
+					this->printSink.PrintDebugInfo(
 						"CLIDE: getopt_long() has returned with a number that is not -1.\r\n",
 						Print::DebugPrintingLevel::VERBOSE);
 				#endif
 
-				//! @todo Remove magic number
-				char optionName[20];
+				// Holds the detected option, if any
+				Option* foundOption = NULL;
 
 				// Store option name
-				if(x == 0)
+				if(x >= Cmd::LONG_OPTION_VAL_OFFSET)
 				{
-					// Long option received
-					//if (long_options[option_index].flag != 0)
-					 //break;
+					// Long option received. getopt_long() returns the val that was assigned in
+					// Cmd::CompileOptions(), which encodes the index of the option in optionA,
+					// so no searching is needed.
+					foundOption = foundCmd->optionA[x - Cmd::LONG_OPTION_VAL_OFFSET];
 
 					#if(clide_ENABLE_DEBUG_CODE == 1)
-						Print::PrintDebugInfo(
-							"CLIDE: Searching for set long option flag.\r\n",
-							Print::DebugPrintingLevel::VERBOSE);
+						snprintf (
+							context.debugBuff,
+							sizeof(context.debugBuff),
+							"CLIDE: Long option '%s' found with optarg '%s'.\r\n",
+							foundOption->longName.cStr,
+							context.getoptData.optarg);
+						this->printSink.PrintDebugInfo(context.debugBuff, Print::DebugPrintingLevel::VERBOSE);
 					#endif
-
-					// Search for set flag
-					for(x = 0; x < (int32_t)foundCmd->optionA.Size(); x++)
-					{
-						if(foundCmd->optionA[x]->longOptionDetected == 1)
-						{
-							// Make sure it hasn't already been detected, if it has,
-							// ignore and continue searching for one that hasn't. getopt_long()
-							// sets all previously discovered flags high everytime it is run,
-							// so this gets around this problem!
-							if(foundCmd->optionA[x]->isDetected == false)
-							{
-								#if(clide_ENABLE_DEBUG_CODE == 1)
-									snprintf (
-										Global::debugBuff,
-										sizeof(Global::debugBuff),
-										"CLIDE: Long option '%s' found with optarg '%s'.\r\n",
-										foundCmd->optionA[x]->longName.cStr,
-										GetOpt::optarg);
-									Print::PrintDebugInfo(Global::debugBuff, Print::DebugPrintingLevel::VERBOSE);
-								#endif
-
-								// Copy option name
-								strcpy(optionName, foundCmd->optionA[x]->longName.cStr);
-
-								break;
-							}
-							
-							// Only one longOptionDetected in optionA should be set, so can safely break loop here.
-							//break;
-						}
-						
-						// Set flag back to false, so that this code works next time through for
-						// a different option.
-						foundCmd->optionA[x]->longOptionDetected = 0;
-
-					}
-					
 				}
 				else if(x == '?')
 				{
 					#if(clide_ENABLE_DEBUG_CODE == 1)
 						snprintf (
-							Global::debugBuff,
-							sizeof(Global::debugBuff),
-							"CLIDE: ERROR: getopt_long() returned '?'. Did not recognise received option '%s' or missing option value. Num args = '%" PRIu8 "'. Option string = '%s'.\r\n",
-							_argsPtr[GetOpt::optind - 1],
+							context.debugBuff,
+							sizeof(context.debugBuff),
+							"CLIDE: ERROR: getopt_long() returned '?'. Did not recognise received option '%s' or missing option value. Num args = '%i'. Option string = '%s'.\r\n",
+							_argsPtr[context.getoptData.optind - 1],
 							numArgs,
 							optionString);
-						Print::PrintError(Global::debugBuff);
+						this->printSink.PrintError(context.debugBuff);
 					#endif
 					
 					continue;
@@ -501,131 +672,32 @@ namespace MbeddedNinja
 				{
 					#if(clide_ENABLE_DEBUG_CODE == 1)
 						snprintf (
-							Global::debugBuff,
-							sizeof(Global::debugBuff),
+							context.debugBuff,
+							sizeof(context.debugBuff),
 							"CLIDE: Short option '%" STR(ClidePort_PF_CHAR_T) "' found with optarg '%s'.\r\n",
 							x,
-							GetOpt::optarg);
-						Print::PrintDebugInfo(Global::debugBuff, Print::DebugPrintingLevel::VERBOSE);
+							context.getoptData.optarg);
+						this->printSink.PrintDebugInfo(context.debugBuff, Print::DebugPrintingLevel::VERBOSE);
 					#endif
 					// Short option received
+					char optionName[2];
 					optionName[0] = x;
 					optionName[1] = '\0';
-				}
-				
-				// Only try and validate options if there are registered options for this command,
-				// else skip
-				if(foundCmd->optionA.Size() > 0)
-				{
 
-					// Check for option
-					Option* foundOption = ValidateOption(foundCmd, optionName);
-					// If option found, call assigned call-back function
-					//! @todo Implement properly
-					if(foundOption != NULL)
-					{
-						#if(clide_ENABLE_DEBUG_CODE == 1)
-							if(foundOption->shortName != '\0')
-							{
-								snprintf (
-										Global::debugBuff,
-										sizeof(Global::debugBuff),
-										"CLIDE: Setting isDetected for option (shortName = '%c', longName = '%s') to 'true'.\r\n",
-										foundOption->shortName,
-										foundOption->longName.cStr);
-								Print::PrintDebugInfo(Global::debugBuff, Print::DebugPrintingLevel::VERBOSE);
-							}
-							else
-							{
-								snprintf (
-										Global::debugBuff,
-										sizeof(Global::debugBuff),
-										"CLIDE: Setting isDetected for option (shortName = 'null', longName = '%s') to 'true'.\r\n",
-										foundOption->longName.cStr);
-								Print::PrintDebugInfo(Global::debugBuff, Print::DebugPrintingLevel::VERBOSE);
-							}
-						#endif
-						foundOption->isDetected = true;
-					
-						// Special help case
-						if(foundOption->shortName == 'h')
-						{
-							#if(clide_ENABLE_DEBUG_CODE == 1)
-								Print::PrintDebugInfo(
-									"CLIDE: Help option detected. Printing help...\r\n",
-									Print::DebugPrintingLevel::VERBOSE);
-							#endif
-
-							// Print help
-							this->PrintHelpForCmd(foundCmd);
-
-							// Help is a special option. Once it is discovered in the command, no further processing is done, so exit
-							return true;
-
-						}
-						// Only run callback if it has been assigned, and not the help case
-						//! @todo Get rid of 20
-						else
-						{
-
-							// Save option value if one
-							if(foundOption->associatedValue == true)
-							{
-								#if(clide_ENABLE_DEBUG_CODE == 1)
-									snprintf (
-										Global::debugBuff,
-										sizeof(Global::debugBuff),
-										"CLIDE: Option should have associated value. Found value = '%s'.\r\n",
-										GetOpt::optarg);
-									Print::PrintDebugInfo(Global::debugBuff, Print::DebugPrintingLevel::VERBOSE);
-								#endif
-								if(GetOpt::optarg != NULL)
-								{
-									#if(clide_ENABLE_DEBUG_CODE == 1)
-										snprintf (
-											Global::debugBuff,
-											sizeof(Global::debugBuff),
-											"CLIDE: Copying '%s' into Option->value.\r\n",
-											GetOpt::optarg);
-										Print::PrintDebugInfo(Global::debugBuff, Print::DebugPrintingLevel::VERBOSE);
-									#endif
-									foundOption->value = MString(GetOpt::optarg);
-								}
-								else
-								{
-									// Error, option should have has a value associated with it.
-									#if(clide_ENABLE_DEBUG_CODE == 1)
-										snprintf (
-											Global::debugBuff,
-											sizeof(Global::debugBuff),
-											"%s",
-											"CLIDE: ERROR: Option had no associated value but associatedValue was set to 'true'.\r\n");
-										Print::PrintError(Global::debugBuff);
-									#endif
-								}
-							}
-
-							//! @todo Remove this callback stuff for options
-							if(foundOption->callBackFunc != NULL)
-							{
-								foundOption->callBackFunc((char*)"20");
-							}
-						}
-					}
-					else
-					{
-						// Error message
-						#if(clide_ENABLE_DEBUG_CODE == 1)
-							Print::PrintError("CLIDE: ERROR - Option '");
-							Print::PrintError(_argsPtr[GetOpt::optind-1]);
-							Print::PrintError("' not registered with command.\"\r\n");
-						#endif
-						Print::PrintToCmdLine("error \"Option '");
-						Print::PrintToCmdLine(_argsPtr[GetOpt::optind-1]);
-						Print::PrintToCmdLine("' not registered with command.\"\r\n");
-					}
+					// Only try and validate options if there are registered options for this command
+					if(foundCmd->optionA.Size() > 0)
+						foundOption = ValidateOption(context, foundCmd, optionName);
 
+					#if(clide_ENABLE_AUTO_HELP == 1)
+						// Cmd::CompileOptions() made both "-h" and "--help" return the built-in help option's short name
+						if(x == Cmd::HELP_SHORT_NAME)
+							foundOption = Cmd::GetHelpOption();
+					#endif
 				}
+				
+				// Help is a special option. Once it is discovered in the command, no further processing is done, so exit
+				if(this->HandleOption(context, foundCmd, result, foundOption, context.getoptData.optarg, _argsPtr[context.getoptData.optind - 1]))
+					return true;
 
 				/*
 				#if(clide_ENABLE_DEBUG_CODE == 1)
@@ -636,150 +708,283 @@ namespace MbeddedNinja
 						x,
 						optarg,
 						optind);
-					Print::PrintDebugInfo(tempBuff);
+					this->printSink.PrintDebugInfo(tempBuff);
 				#endif
 				*/
 			}
 			
 			#if(clide_ENABLE_DEBUG_CODE == 1)
 				snprintf (
-					Global::debugBuff,
-					sizeof(Global::debugBuff),
+					context.debugBuff,
+					sizeof(context.debugBuff),
 					"CLIDE: GetOpt() finished (returned with -1). optind = '%i'.\r\n",
-					GetOpt::optind);							
-				Print::PrintDebugInfo(Global::debugBuff, Print::DebugPrintingLevel::VERBOSE);
+					context.getoptData.optind);							
+				this->printSink.PrintDebugInfo(context.debugBuff, Print::DebugPrintingLevel::VERBOSE);
 			#endif
 
 			#if(clide_ENABLE_DEBUG_CODE == 1)
-				Print::PrintDebugInfo("CLIDE: Arguments = ", Print::DebugPrintingLevel::VERBOSE);
-				// Print arguments
-				count = 0;
-				while(count < numArgs)
-				{
-					Print::PrintDebugInfo(_args[count], Print::DebugPrintingLevel::VERBOSE);
-					Print::PrintDebugInfo(", ", Print::DebugPrintingLevel::VERBOSE);
-					count++;
-				}
-				Print::PrintDebugInfo("\r\n", Print::DebugPrintingLevel::VERBOSE);
-
-				Print::PrintDebugInfo("CLIDE: Re-arranged arguments = ", Print::DebugPrintingLevel::VERBOSE);
+				this->printSink.PrintDebugInfo("CLIDE: Re-arranged arguments = ", Print::DebugPrintingLevel::VERBOSE);
 				// Print re-arranged arguments
-				count = 0;
+				int count = 0;
 				while(count < numArgs)
 				{
-					Print::PrintDebugInfo(_argsPtr[count], Print::DebugPrintingLevel::VERBOSE);
-					Print::PrintDebugInfo(", ", Print::DebugPrintingLevel::VERBOSE);
+					this->printSink.PrintDebugInfo(_argsPtr[count], Print::DebugPrintingLevel::VERBOSE);
+					this->printSink.PrintDebugInfo(", ", Print::DebugPrintingLevel::VERBOSE);
 					count++;
 				}
-				Print::PrintDebugInfo("\r\n", Print::DebugPrintingLevel::VERBOSE);
+				this->printSink.PrintDebugInfo("\r\n", Print::DebugPrintingLevel::VERBOSE);
 			#endif
 
-			//============= VALIDATE/PROCESS PARAMETERS =============//
+			// getopt_long() has permuted the parameters to the end of the arguments
+			*paramA = &_argsPtr[context.getoptData.optind];
+			*numParams = (uint32_t)(numArgs - context.getoptData.optind);
 
-			// Validate that there are the correct number of parameters
-			if((uint32_t)(numArgs - GetOpt::optind) != foundCmd->paramA.Size())
-			{
-				char tempBuff[100];
-				snprintf(
-						tempBuff,
-						sizeof(tempBuff),
-						"error \"Num. of received parameters ('%" PRIu8
-						"') does not match num. registered for cmd ('%zu').\"\r\n",
-						numArgs - GetOpt::optind,
-						foundCmd->paramA.Size());
-				Print::PrintToCmdLine(tempBuff);
-				#if(clide_ENABLE_DEBUG_CODE == 1)
-					snprintf (
-						Global::debugBuff,
-						sizeof(Global::debugBuff),
-						"CLIDE: ERROR: Num. of received parameters ('%" STR(ClidePort_PF_UINT32_T)
-						"') for cmd '%s' does not match num. registered ('%zu'). numArgs = '%" PRIu8 "'. optind = '%i'.\r\n",
-						(uint32_t)(numArgs - GetOpt::optind),
-						foundCmd->name.cStr,
-						foundCmd->paramA.Size(),
-						numArgs,
-						GetOpt::optind);
-					Print::PrintError(Global::debugBuff);
-				#endif
-				#if(clide_ENABLE_DEBUG_CODE == 1)
-					Print::PrintDebugInfo("CLIDE: Rx::Run() finished. Returning false.\r\n", Print::DebugPrintingLevel::VERBOSE);
-				#endif
-				return false;
-			}
+			return false;
+		}
 
-			// Copy parameters into cmd string
-			for(x = 0; (uint32_t)x < foundCmd->paramA.Size(); x++)
+		bool Rx::ParseOptionsSinglePass(ParseContext& context, Cmd* foundCmd, ParseResult& result, uint32_t numArgs, const ArgView argA[], char* argBuff, char* paramA[], uint32_t* numParams)
+		{
+			#if(clide_ENABLE_DEBUG_CODE == 1)
+				this->printSink.PrintDebugInfo("CLIDE: Parsing options with the single-pass option parser.\r\n", Print::DebugPrintingLevel::VERBOSE);
+			#endif
+
+			OptionParser optionParser(CmdOptions(foundCmd), numArgs, argA, argBuff, paramA);
+
+			Option* foundOption;
+			char* optionValue;
+			OptionParser::Status status;
+			while((status = optionParser.Next(&foundOption, &optionValue)) != OptionParser::Status::FINISHED)
 			{
-				foundCmd->paramA[x]->value = MString(_argsPtr[GetOpt::optind + x]);
+				if(status == OptionParser::Status::ERROR)
+				{
+					#if(clide_ENABLE_DEBUG_CODE == 1)
+						snprintf (
+							context.debugBuff,
+							sizeof(context.debugBuff),
+							"CLIDE: ERROR: Did not recognise received option '%.*s' or missing option value.\r\n",
+							(int)optionParser.GetErrorArg().length,
+							optionParser.GetErrorArg().chars);
+						this->printSink.PrintError(context.debugBuff);
+					#endif
+
+					continue;
+				}
+
+				// Help is a special option. Once it is discovered in the command, no further processing is done, so exit.
+				// Only registered options are returned, so there is no need for the argument (an error message).
+				if(this->HandleOption(context, foundCmd, result, foundOption, optionValue, NULL))
+					return true;
 			}
 
-			#if(clide_ENABLE_DEBUG_CODE == 1)
-				Print::PrintDebugInfo("CLIDE: Parameters = ", Print::DebugPrintingLevel::VERBOSE);
-				// Get parameters
-				if(GetOpt::optind == numArgs)
-					Print::PrintDebugInfo("(none)", Print::DebugPrintingLevel::VERBOSE);
-				else
+			*numParams = optionParser.GetNumParams();
+
+			return false;
+		}
+
+		bool Rx::HandleOption(ParseContext& context, Cmd* foundCmd, ParseResult& result, Option* foundOption, const char* optionValue, const char* optionArg)
+		{
+			#if(clide_ENABLE_AUTO_HELP == 1)
+				// Special help case. The built-in help option is shared by every command, so nothing is recorded for it.
+				if((foundOption != NULL) && (foundOption == Cmd::GetHelpOption()))
 				{
-					for(count = GetOpt::optind; count < numArgs; count++)
-					{
-						Print::PrintDebugInfo(_argsPtr[count], Print::DebugPrintingLevel::VERBOSE);
-						Print::PrintDebugInfo(", ", Print::DebugPrintingLevel::VERBOSE);
-					}
+					#if(clide_ENABLE_DEBUG_CODE == 1)
+						this->printSink.PrintDebugInfo(
+							"CLIDE: Help option detected. Printing help...\r\n",
+							Print::DebugPrintingLevel::VERBOSE);
+					#endif
+
+					// Print help
+					this->PrintHelpForCmd(foundCmd);
+
+					// Help is a special option. Once it is discovered in the command, no further processing is done, so exit
+					return true;
 				}
-				Print::PrintDebugInfo("\r\n", Print::DebugPrintingLevel::VERBOSE);
 			#endif
 
-			// Make sure callbacks are the last thing to do in Run()
-			if((foundCmd->functionCallback != NULL) || foundCmd->methodCallback.IsValid())
+			// Only try and validate options if there are registered options for this command,
+			// else skip
+			if(foundCmd->optionA.Size() > 0)
 			{
-				// Check to see if a call-back function has been assigned
-				if(foundCmd->functionCallback != NULL)
+				// If option found, call assigned call-back function
+				//! @todo Implement properly
+				if(foundOption != NULL)
 				{
-					// Execute command callback function
-					foundCmd->functionCallback(foundCmd);
+					#if(clide_ENABLE_DEBUG_CODE == 1)
+						if(foundOption->shortName != '\0')
+						{
+							snprintf (
+									context.debugBuff,
+									sizeof(context.debugBuff),
+									"CLIDE: Setting detected flag for option (shortName = '%c', longName = '%s') to 'true'.\r\n",
+									foundOption->shortName,
+									foundOption->longName.cStr);
+							this->printSink.PrintDebugInfo(context.debugBuff, Print::DebugPrintingLevel::VERBOSE);
+						}
+						else
+						{
+							snprintf (
+									context.debugBuff,
+									sizeof(context.debugBuff),
+									"CLIDE: Setting detected flag for option (shortName = 'null', longName = '%s') to 'true'.\r\n",
+									foundOption->longName.cStr);
+							this->printSink.PrintDebugInfo(context.debugBuff, Print::DebugPrintingLevel::VERBOSE);
+						}
+					#endif
+					result.SetDetected(foundOption, foundOption->associatedValue ? optionValue : NULL);
+					if(!this->IsFrozen())
+						foundOption->detectedGeneration = this->parseGeneration;
+				
+					// Save option value if one
+					if(foundOption->associatedValue == true)
+					{
+						#if(clide_ENABLE_DEBUG_CODE == 1)
+							snprintf (
+								context.debugBuff,
+								sizeof(context.debugBuff),
+								"CLIDE: Option should have associated value. Found value = '%s'.\r\n",
+								optionValue);
+							this->printSink.PrintDebugInfo(context.debugBuff, Print::DebugPrintingLevel::VERBOSE);
+						#endif
+						if(optionValue != NULL)
+						{
+							#if(clide_ENABLE_DEBUG_CODE == 1)
+								snprintf (
+									context.debugBuff,
+									sizeof(context.debugBuff),
+									"CLIDE: Copying '%s' into Option->value.\r\n",
+									optionValue);
+								this->printSink.PrintDebugInfo(context.debugBuff, Print::DebugPrintingLevel::VERBOSE);
+							#endif
+							if(!this->IsFrozen())
+								foundOption->value = MString(optionValue);
+
+							// Converted now, so the command is rejected before any callback is called
+							if(foundOption->valueSpec.type != ValueType::STRING)
+							{
+								Value typedValue;
+								ValueSpec::Status status = foundOption->valueSpec.Convert(optionValue, &typedValue);
+								if(status != ValueSpec::Status::OK)
+								{
+									char valueName[60];
+									if(foundOption->longName.GetLength() != 0)
+										snprintf(valueName, sizeof(valueName), "Option '--%s'", foundOption->longName.cStr);
+									else
+										snprintf(valueName, sizeof(valueName), "Option '-%c'", foundOption->shortName);
+									this->PrintValueError(valueName, optionValue, foundOption->valueSpec, status);
+									context.isRejected = true;
+									return true;
+								}
+
+								result.SetTypedValue(foundOption, typedValue);
+								if(!this->IsFrozen())
+									foundOption->typedValue = typedValue;
+							}
+						}
+						else
+						{
+							// Error, option should have has a value associated with it.
+							#if(clide_ENABLE_DEBUG_CODE == 1)
+								snprintf (
+									context.debugBuff,
+									sizeof(context.debugBuff),
+									"%s",
+									"CLIDE: ERROR: Option had no associated value but associatedValue was set to 'true'.\r\n");
+								this->printSink.PrintError(context.debugBuff);
+							#endif
+						}
+					}
+
+					//! @todo Remove this callback stuff for options
+					if(foundOption->callBackFunc != NULL)
+					{
+						foundOption->callBackFunc((char*)"20");
+					}
+				}
+				else
+				{
+					// Error message
+					#if(clide_ENABLE_DEBUG_CODE == 1)
+						this->printSink.PrintError("CLIDE: ERROR - Option '");
+						this->printSink.PrintError(optionArg);
+						this->printSink.PrintError("' not registered with command.\"\r\n");
+					#endif
+					this->printSink.PrintToCmdLine("error \"Option '");
+					this->printSink.PrintToCmdLine(optionArg);
+					this->printSink.PrintToCmdLine("' not registered with command.\"\r\n");
 				}
 
-				if(foundCmd->methodCallback.IsValid() == true)
+			}
+
+			return false;
+		}
+
+		bool Rx::ConvertParams(ParseContext& context, Cmd* foundCmd, ParseResult& result, char* const* paramA)
+		{
+			for(uint32_t x = 0; x < foundCmd->paramA.Size(); x++)
+			{
+				const ValueSpec& valueSpec = foundCmd->paramA[x]->valueSpec;
+				if(valueSpec.type == ValueType::STRING)
+					continue;
+
+				Value typedValue;
+				ValueSpec::Status status = valueSpec.Convert(paramA[x], &typedValue);
+				if(status != ValueSpec::Status::OK)
 				{
-					// Call method callback
-					foundCmd->methodCallback.Execute(foundCmd);
+					char valueName[30];
+					snprintf(valueName, sizeof(valueName), "Param %" PRIu32, x + 1);
+					this->PrintValueError(valueName, paramA[x], valueSpec, status);
+					context.isRejected = true;
+					return false;
 				}
 
+				result.SetTypedParam(x, typedValue);
+				if(!this->IsFrozen())
+					foundCmd->paramA[x]->typedValue = typedValue;
 			}
+
+			return true;
+		}
+
+		void Rx::PrintValueError(const char* valueName, const char* valueStr, const ValueSpec& valueSpec, ValueSpec::Status status)
+		{
+			char rangeBuff[100];
+			valueSpec.GetRangeString(rangeBuff, sizeof(rangeBuff));
+
+			// e.g. error "Param 1 value 'abc' is not a valid int32 (0 to 5000)."
+			this->printSink.PrintToCmdLine("error \"");
+			this->printSink.PrintToCmdLine(valueName);
+			this->printSink.PrintToCmdLine(" value '");
+			this->printSink.PrintToCmdLine(valueStr);
+			if(status == ValueSpec::Status::OUT_OF_RANGE)
+				this->printSink.PrintToCmdLine("' is out of range (");
 			else
 			{
-				#if(clide_ENABLE_DEBUG_CODE == 1)
-					Print::PrintDebugInfo("CLIDE: Command callback(s) were NULL, so no function/method called.\r\n", Print::DebugPrintingLevel::VERBOSE);
-				#endif
+				this->printSink.PrintToCmdLine("' is not a valid ");
+				this->printSink.PrintToCmdLine(valueSpec.GetTypeName());
+				this->printSink.PrintToCmdLine(" (");
 			}
+			this->printSink.PrintToCmdLine(rangeBuff);
+			this->printSink.PrintToCmdLine(").\"\r\n");
 
 			#if(clide_ENABLE_DEBUG_CODE == 1)
-				Print::PrintDebugInfo("CLIDE: Rx::Run() finished. Returning true.\r\n", Print::DebugPrintingLevel::VERBOSE);
+				this->printSink.PrintError("CLIDE: ERROR: Rejected a received value that did not match its ValueSpec.\r\n");
 			#endif
-			return true;
 		}
 
-		//===============================================================================================//
-		//==================================== PRIVATE FUNCTIONS ========================================//
-		//===============================================================================================//
-
 		// Constructor
 		void Rx::Init(bool enableHelpNoHeaderOption)
 		{
 			#if(clide_ENABLE_DEBUG_CODE == 1)
-				Print::PrintDebugInfo("CLIDE: Rx::Init() called...\r\n", Print::DebugPrintingLevel::VERBOSE);
+				this->printSink.PrintDebugInfo("CLIDE: Rx::Init() called...\r\n", Print::DebugPrintingLevel::VERBOSE);
 			#endif
 
 			// Initialise class variables
 
-			#if(clide_ENABLE_DEBUG_CODE == 1)
-				// Enable getopt() to print error messages
-				GetOpt::opterr = 1;
-			#endif
-
 			// Create command for help command (which is currently just a pointer)
-			this->cmdHelp = new Cmd("help", &HelpCmdCallback, "Returns information about all registered commands.");
+			// The help command reads its options from the parse result, so it still works once frozen
+			this->cmdHelp = new Cmd("help", NULL, "Returns information about all registered commands.");
 			M_ASSERT(this->cmdHelp);
+			this->cmdHelp->resultFunctionCallback = &HelpCmdResultCallback;
 
 			this->cmdHelpOption = new Option('g', "", NULL, "Specifies which group to print help with.", true);
 			M_ASSERT(this->cmdHelpOption);
@@ -799,266 +1004,161 @@ namespace MbeddedNinja
 			// Default is to ignore this element
 			this->ignoreFirstArgvElement = true;
 
+			// Default is to use the heap for long messages
+			this->parseArena = NULL;
+
+			// Default is the (long-standing) getopt_long() parser
+			this->optionParserMode = OptionParserMode::GETOPT;
+
 			// Create help function if enabled
 			#if(clide_ENABLE_AUTO_HELP == 1)
 				this->RegisterCmd(this->cmdHelp);
 			#endif
 
 			#if(clide_ENABLE_DEBUG_CODE == 1)
-				Print::PrintDebugInfo("CLIDE: Rx constructor finished.\r\n", Print::DebugPrintingLevel::VERBOSE);
+				this->printSink.PrintDebugInfo("CLIDE: Rx constructor finished.\r\n", Print::DebugPrintingLevel::VERBOSE);
 			#endif
 		}
 
-		int Rx::SplitPacket(char* packet, char* argv[])
+		bool Rx::CmdNotRecognised(const char* cmdName, uint32_t cmdNameLen)
 		{
+			// Only print this error is user has not silenced it
+			if(this->silenceCmdNotRecognisedError == false)
+			{
+				char tempBuff[100];
+				// Received command is not registered (aka invalid/unrecognised)
+				#if(clide_ENABLE_AUTO_HELP == 1)
+					// Help exists, so tell user that they could type help to get a list of available commands.
+					// Bold if advanced text formatting is enabled
+					snprintf(
+						tempBuff,
+						sizeof(tempBuff),
+						"error \"Command '%.*s' not recognised. Type %shelp%s to see a list of all the commands.\"\r\n",
+						(int)cmdNameLen,
+						cmdName,
+						this->TextFormatBold(),
+						this->TextFormatNormal());
+					this->printSink.PrintToCmdLine(tempBuff);
+				#else
+					// No automatic help, so don't tell the user about something that doesn't exist
+					snprintf(
+						tempBuff,
+						sizeof(tempBuff),
+						"error \"Command '%.*s' not recognised.\"\r\n",
+						(int)cmdNameLen,
+						cmdName);
+					this->printSink.PrintToCmdLine(tempBuff);
+				#endif // #if(clide_ENABLE_AUTO_HELP == 1)
+			}
 
-			// Split string into arguments using white space as the seperator
-			char* ptrToArgument = StringSplit::Run(packet, " ");
-
-			// Keep track of the number of arguments found
-			uint8_t argCount = 0;
+			// Log error
+			//this->log.logId = LogIds::CMD_NOT_RECOGNISED;
+			//this->log.msg = (char*)"Command not recognised.";
+			//this->log.severity = Severity::ERROR;
 
-			while(ptrToArgument != 0)
+			// Call callback if assigned
+			if(this->cmdUnrecogCallback.obj != NULL)
 			{
-				// Save pointer to start of string
-				argv[argCount] = ptrToArgument;
-
-				// Repeat. Pass in null as first parameter after first call
-				ptrToArgument = StringSplit::Run(0, " ");
-				argCount++;
+				#if(clide_ENABLE_DEBUG_CODE == 1)
+					this->printSink.PrintDebugInfo(
+						"CLIDE: .\r\n",
+						Print::DebugPrintingLevel::VERBOSE);
+				#endif
+				// The callback takes a null-terminated name, so a copy is only made if there is a callback.
+				// Short names are copied onto the stack, so an unrecognised command does not touch the heap.
+				SmallBuff<char, clide_ARG_BUFF_SIZE> cmdNameCpy(this->parseArena);
+				cmdNameCpy.Reserve(cmdNameLen + 1);
+				memcpy(cmdNameCpy.Data(), cmdName, cmdNameLen);
+				cmdNameCpy[cmdNameLen] = '\0';
+				this->cmdUnrecogCallback.Execute(cmdNameCpy.Data());
 			}
 
-			// Write 0 to last args element
-			//args[argCount][0] = '\0';
-
-			return argCount;
+			#if(clide_ENABLE_DEBUG_CODE == 1)
+				this->printSink.PrintDebugInfo(
+					"CLIDE: Rx::Run() finished. Returning false.\r\n",
+					Print::DebugPrintingLevel::VERBOSE);
+			#endif
+			return false;
 		}
 
-		Cmd* Rx::ValidateCmd(char* cmdName, MVector<Cmd*> cmdA)
+		Cmd* Rx::ValidateCmd(ParseContext& context, const char* cmdName, uint32_t cmdNameLen)
 		{
-			uint8_t x = 0;
-			
 			#if(clide_ENABLE_DEBUG_CODE == 1)
-				Print::PrintDebugInfo("CLIDE: Validating command...\r\n", Print::DebugPrintingLevel::VERBOSE);
-				Print::PrintDebugInfo("CLIDE: Input = ", Print::DebugPrintingLevel::VERBOSE);
-				Print::PrintDebugInfo(cmdName, Print::DebugPrintingLevel::VERBOSE);
-				Print::PrintDebugInfo("\r\n", Print::DebugPrintingLevel::VERBOSE);
+				this->printSink.PrintDebugInfo("CLIDE: Validating command...\r\n", Print::DebugPrintingLevel::VERBOSE);
 				snprintf(
-					Global::debugBuff,
-					sizeof(Global::debugBuff),
-					"CLIDE: Num. registered cmds = %zu\r\n",
-					cmdA.Size());
-				Print::PrintDebugInfo(Global::debugBuff, Print::DebugPrintingLevel::VERBOSE);
+					context.debugBuff,
+					sizeof(context.debugBuff),
+					"CLIDE: Input = '%.*s'. Num. registered cmds = %zu\r\n",
+					(int)cmdNameLen,
+					cmdName,
+					this->cmdA.Size());
+				this->printSink.PrintDebugInfo(context.debugBuff, Print::DebugPrintingLevel::VERBOSE);
 			#endif
 
-			for(x = 0; x < cmdA.Size(); x++)
+			uint32_t cmdIndex = this->cmdIndex.Find(cmdName, cmdNameLen);
+
+			if(cmdIndex == HashIndex::NOT_FOUND)
 			{
-				uint32_t val = strcmp(cmdName, cmdA[x]->name.cStr);
+				// No match found, return NULL
 				#if(clide_ENABLE_DEBUG_CODE == 1)
-					snprintf(
-						Global::debugBuff,
-						sizeof(Global::debugBuff),
-						"CLIDE: Compared name = '%s', compared value = '%" PRIu32 "'.\r\n",
-						cmdA[x]->name.cStr,
-						(uint32_t)val);
-					Print::PrintDebugInfo(Global::debugBuff, Print::DebugPrintingLevel::VERBOSE);
+					this->printSink.PrintDebugInfo("CLIDE: Command not recognised.\r\n", Print::DebugPrintingLevel::VERBOSE);
 				#endif
-				if(val == 0)
-				{
-					// Match found, return pointer to the discovered cmd structure
-					#if(clide_ENABLE_DEBUG_CODE == 1)
-						Print::PrintDebugInfo("CLIDE: Command recognised.\r\n", Print::DebugPrintingLevel::VERBOSE);
-					#endif
-					return cmdA[x];
-				}
+				return NULL;
 			}
-			// No match found, return NULL
+
+			// Match found, return pointer to the discovered cmd structure
 			#if(clide_ENABLE_DEBUG_CODE == 1)
-				Print::PrintDebugInfo("CLIDE: Command not recognised.\r\n", Print::DebugPrintingLevel::VERBOSE);
+				this->printSink.PrintDebugInfo("CLIDE: Command recognised.\r\n", Print::DebugPrintingLevel::VERBOSE);
 			#endif
-
-			return NULL;
+			return this->cmdA[cmdIndex];
 		}
 
-		Option* Rx::ValidateOption(Cmd *detectedCmd, char* optionName)
+		Option* Rx::ValidateOption(ParseContext& context, Cmd *detectedCmd, char* optionName)
 		{
-			#if(clide_ENABLE_DEBUG_CODE == 1)
-				Print::PrintDebugInfo("CLIDE: Validating option.\r\n", Print::DebugPrintingLevel::VERBOSE);
-			#endif
-
-			uint8_t x = 0;
-
 			#if(clide_ENABLE_DEBUG_CODE == 1)
 				snprintf(
-					Global::debugBuff,
-					sizeof(Global::debugBuff),
-					"CLIDE: Received option = '%s'.\r\n",
+					context.debugBuff,
+					sizeof(context.debugBuff),
+					"CLIDE: Validating option '%s'.\r\n",
 					optionName);
-				Print::PrintDebugInfo(Global::debugBuff, Print::DebugPrintingLevel::VERBOSE);
+				this->printSink.PrintDebugInfo(context.debugBuff, Print::DebugPrintingLevel::VERBOSE);
 			#endif
-			// Iterate through all registered options for detected command
-			for(x = 0; x < detectedCmd->optionA.Size(); x++)
-			{
-				// Do not initialise as 0!
-				uint8_t val = 1;
-				// Compare received option name with all the registered option names in the detected command
-				if(optionName[1] == '\0')
-				{
-					// Option is short
-					if(optionName[0] == detectedCmd->optionA[x]->shortName)
-						val = 0;
-					else
-						val = 1;
 
-					#if(clide_ENABLE_DEBUG_CODE == 1)
-						snprintf(
-							Global::debugBuff,
-							sizeof(Global::debugBuff),
-							"CLIDE: Compared received option '%s' with short name '%c'.\r\n",
-							optionName,
-							detectedCmd->optionA[x]->shortName);
-						Print::PrintDebugInfo(Global::debugBuff, Print::DebugPrintingLevel::VERBOSE);
-					#endif
-				}
-				else if(detectedCmd->optionA[x]->longName.GetLength() > 0)
-				{
-					// Option is long
-					val = strcmp(optionName, detectedCmd->optionA[x]->longName.cStr);
-					#if(clide_ENABLE_DEBUG_CODE == 1)
-						snprintf(
-							Global::debugBuff,
-							sizeof(Global::debugBuff),
-							"CLIDE: Compared received option '%s' with long name '%s'.\r\n",
-							optionName,
-							detectedCmd->optionA[x]->longName.cStr);
-						Print::PrintDebugInfo(Global::debugBuff, Print::DebugPrintingLevel::VERBOSE);
-					#endif
-				}
+			// Looked up in the command's short and long name indexes, so no options are searched
+			Option* foundOption;
+			if(optionName[1] == '\0')
+				foundOption = detectedCmd->FindOptionByShortName(optionName[0]);
+			else
+				foundOption = detectedCmd->FindOptionByLongName(optionName);
 
-				if(val == 0)
-				{
-					// Match found, return found option
-					#if(clide_ENABLE_DEBUG_CODE == 1)
-						Print::PrintDebugInfo("CLIDE: Option recognised.\r\n", Print::DebugPrintingLevel::VERBOSE);
-					#endif
-					return detectedCmd->optionA[x];
-				}
-			}
-			// No match found, return NULL
 			#if(clide_ENABLE_DEBUG_CODE == 1)
-				Print::PrintDebugInfo("CLIDE: Option not recognised.\r\n", Print::DebugPrintingLevel::VERBOSE);
+				if(foundOption != NULL)
+					this->printSink.PrintDebugInfo("CLIDE: Option recognised.\r\n", Print::DebugPrintingLevel::VERBOSE);
+				else
+					this->printSink.PrintDebugInfo("CLIDE: Option not recognised.\r\n", Print::DebugPrintingLevel::VERBOSE);
 			#endif
 
-			return NULL;
+			return foundOption;
 		}
 	
-		void Rx::BuildShortOptionString(char* optionString, Cmd* cmd)
+		void Rx::NextParseGeneration()
 		{
-			#if(clide_ENABLE_DEBUG_CODE == 1)
-				Print::PrintDebugInfo("CLIDE: Building short option string...\r\n", Print::DebugPrintingLevel::VERBOSE);
-			#endif
+			this->parseGeneration++;
 
-			uint32_t x;
-			uint32_t optionStringPos = 0;
-			for(x = 0; x < cmd->optionA.Size(); x++)
+			// 0 means "never detected", so skip it on wrap-around. Clear every stamp too, otherwise one left over
+			// from before the wrap could match a new generation.
+			if(this->parseGeneration == 0)
 			{
-				// Make sure short name exists
-				if(cmd->optionA[x]->shortName != '\0')
+				for(uint32_t x = 0; x < this->cmdA.Size(); x++)
 				{
-					// Get character from each name
-					optionString[optionStringPos++] = cmd->optionA[x]->shortName;
-					// Add ':' if option is expected with associated value
-					if(cmd->optionA[x]->associatedValue == true)
-					{
-						#if(clide_ENABLE_DEBUG_CODE == 1)
-							Print::PrintDebugInfo(
-								"CLIDE: associatedValue = 'true'. Adding ':' char to option string.\r\n",
-								Print::DebugPrintingLevel::VERBOSE);
-						#endif
-						optionString[optionStringPos++] = ':';
-					}
+					this->cmdA[x]->detectedGeneration = 0;
+					for(uint32_t y = 0; y < this->cmdA[x]->optionA.Size(); y++)
+						this->cmdA[x]->optionA[y]->detectedGeneration = 0;
 				}
+				this->parseGeneration = 1;
 			}
-			// Add null character to terminate string
-			optionString[optionStringPos++] = '\0';
-
-			#if(clide_ENABLE_DEBUG_CODE == 1)
-				Print::PrintDebugInfo(
-					"CLIDE: Finished building short option string...\r\n",
-					Print::DebugPrintingLevel::VERBOSE);
-			#endif
 		}
-		
-		void Rx::BuildLongOptionStruct(GetOpt::option* longOptStructA, Cmd* cmd)
-		{
-			// Build the structure required for long option processing
-
-			#if(clide_ENABLE_DEBUG_CODE == 1)
-				Print::PrintDebugInfo("CLIDE: Building long option structure...\r\n", Print::DebugPrintingLevel::VERBOSE);
-			#endif
 
-			uint32_t x;
-			uint32_t longOptionIndex = 0;
-			// Iterate through all long-options registered with command
-			for(x = 0; x < cmd->optionA.Size(); x++)
-			{
-				// If no long name in option, skip to next one
-				if(cmd->optionA[x]->longName.GetLength() == 0)
-				{
-					#if(clide_ENABLE_DEBUG_CODE == 1)
-						snprintf(
-							Global::debugBuff,
-							sizeof(Global::debugBuff),
-							"CLIDE: Option '%c' is not a long-option. Skipping.\r\n",
-							cmd->optionA[x]->shortName);
-						Print::PrintDebugInfo(Global::debugBuff, Print::DebugPrintingLevel::VERBOSE);
-					#endif
-					continue;
-				}
-
-				#if(clide_ENABLE_DEBUG_CODE == 1)
-					snprintf(
-						Global::debugBuff,
-						sizeof(Global::debugBuff),
-						"CLIDE: Option '%s' is a long-option.\r\n",
-						cmd->optionA[x]->longName.cStr);
-					Print::PrintDebugInfo(Global::debugBuff, Print::DebugPrintingLevel::VERBOSE);
-				#endif
-
-				// Copy all variables to structure.
-
-				// 1) Name
-				longOptStructA[longOptionIndex].name = cmd->optionA[x]->longName.cStr;
-				//longOptStructA[0].name = "long1";
-
-				// 2) Has Argument?
-				// Optional argument not supported
-				if(cmd->optionA[x]->associatedValue)
-					longOptStructA[longOptionIndex].has_arg = required_argument;
-				else
-					longOptStructA[longOptionIndex].has_arg = no_argument;
-
-				// 3) Detected flag
-				longOptStructA[longOptionIndex].flag = &cmd->optionA[x]->longOptionDetected;
-
-				// 4) Detected flag value
-				longOptStructA[longOptionIndex].val = 1;
-
-				longOptionIndex++;
-			}
-
-			// Zero-element at end of array
-			longOptStructA[longOptionIndex].name = 0;
-			longOptStructA[longOptionIndex].has_arg = 0;
-			longOptStructA[longOptionIndex].flag = 0;
-			longOptStructA[longOptionIndex].val = 0;
-
-			#if(clide_ENABLE_DEBUG_CODE == 1)
-				Print::PrintDebugInfo("CLIDE: Finished building long option structure.\r\n", Print::DebugPrintingLevel::VERBOSE);
-			#endif
-		
-		}
-	
 	} // namespace MClide
 } // namespace MbeddedNinja
 
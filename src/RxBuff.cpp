@@ -2,8 +2,8 @@
 //! @file 			RxBuff.cpp
 //! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
 //! @created		2014-01-09
-//! @last-modified 	2014-10-07
-//! @brief 			An input buffer for the Rx engine. This can accept a stream of characters and call Rx::Go when the CR character is detected.
+//! @last-modified 	2026-10-16
+//! @brief 			An input buffer for the Rx engine. This can accept a stream of characters and call Rx::Run() when the end-of-command character is detected.
 //! @details
 //!					See README.rst in repo root dir for more info.
 
@@ -20,7 +20,10 @@
 //#include <stdio.h>		// snprintf()
 #include <stdlib.h>		// realloc(), malloc(), free()
 #include <cctype>		// isalnum() 
-#include <cstring>		// memset()
+#include <cstring>		// memchr(), memcpy()
+
+// User libraries
+#include "MAssert/api/MAssertApi.hpp"
 
 // User includes
 #include "../include/Config.hpp"
@@ -28,6 +31,8 @@
 #include "../include/Print.hpp"
 #include "../include/Rx.hpp"
 #include "../include/RxBuff.hpp"
+#include "../include/HashIndex.hpp"
+#include "../include/Tokenizer.hpp"
 
 
 namespace MbeddedNinja
@@ -40,24 +45,40 @@ namespace MbeddedNinja
 		//===============================================================================================//
 
 		// Constructor
-		RxBuff::RxBuff(Rx* rxController, char endOfCmdChar)
+		RxBuff::RxBuff(Rx* rxController, char endOfCmdChar) :
+			RxBuff(rxController, endOfCmdChar, new char[clide_RX_BUFF_SIZE], clide_RX_BUFF_SIZE)
+		{
+			M_ASSERT(this->buff);
+			this->ownsBuff = true;
+		}
+
+		RxBuff::RxBuff(Rx* rxController, char endOfCmdChar, char* buff, size_t buffSize)
 		{
 			#if(clide_ENABLE_DEBUG_CODE == 1)
 				Print::PrintDebugInfo("CLIDE: RxBuff constructor called...\r\n",
 						Print::DebugPrintingLevel::VERBOSE);
 			#endif
 
+			// Room for at least one character and the null character that ends the command (streaming keeps the
+			// last character for it, so buffSize - 1 must not wrap around)
+			M_ASSERT(buffSize >= 2);
+
 			// Initialise class variables
 			this->rxController = rxController;
+			this->buff = buff;
+			this->buffSize = buffSize;
+			this->ownsBuff = false;
 
-			// Set buffer write location to 0
+			// Set buffer write location to 0. The buffer itself does not need clearing, only
+			// the first buffWritePos characters are ever read.
 			this->buffWritePos = 0;
 
-			// Clear buffer
-			memset(this->buff, '\0', sizeof(this->buff));
-
 			this->endOfCmdChar = endOfCmdChar;
 
+			this->streaming = false;
+			this->earlyRejection = false;
+			this->StreamReset();
+
 			#if(clide_ENABLE_DEBUG_CODE == 1)
 				Print::PrintDebugInfo("CLIDE: RxBuff constructor finished.\r\n",
 						Print::DebugPrintingLevel::VERBOSE);
@@ -65,88 +86,289 @@ namespace MbeddedNinja
 
 		}
 
+		RxBuff::~RxBuff()
+		{
+			if(this->ownsBuff)
+				delete[] this->buff;
+		}
+
+		size_t RxBuff::GetCapacity() const
+		{
+			return this->buffSize;
+		}
+
+		Rx* RxBuff::GetRx() const
+		{
+			return this->rxController;
+		}
+
 		bool RxBuff::WriteChar(const char character)
 		{
-			char tempBuff[2];
-			tempBuff[0] = character;
-			tempBuff[1] = '\0';
+			// Called once per character, so this does not go through WriteBytes()
+			if(character == this->endOfCmdChar)
+			{
+				#if(clide_ENABLE_DEBUG_CODE == 1)
+					this->rxController->printSink.PrintDebugInfo(
+						"CLIDE: End of command character detected, calling Rx::Run().\r\n",
+						Print::DebugPrintingLevel::VERBOSE);
+				#endif
+				this->RunBuff();
+				return true;
+			}
+
+			if(this->streaming)
+				return this->Append(&character, 1);
+
+			if(this->buffWritePos >= this->buffSize)
+				return this->Append(&character, 1);
 
-			return this->WriteString((const char*)tempBuff);
+			this->buff[this->buffWritePos++] = character;
+			return true;
 		}
 
 		bool RxBuff::WriteString(const char* characters)
 		{
-			// Variable for remembering where we are up in reading characters
-			uint32_t characterReadPos = 0;
+			return this->WriteBytes(characters, strlen(characters));
+		}
 
-			// Made own copy function, rather than strcpy(), because extra functionality is needed
-			while(characters[characterReadPos] != '\0')
+		bool RxBuff::WriteBytes(const char* bytes, size_t numBytes)
+		{
+			bool success = true;
+			const char* bytesEnd = bytes + numBytes;
+
+			while(bytes < bytesEnd)
 			{
+				// memchr() is much faster than comparing one character at a time
+				const char* endOfCmd = (const char*)memchr(bytes, this->endOfCmdChar, bytesEnd - bytes);
 
-				// Check for buffer full condition
-				if(this->buffWritePos >= sizeof(this->buff) - 1)
+				if(endOfCmd == NULL)
 				{
 					#if(clide_ENABLE_DEBUG_CODE == 1)
-						Print::PrintError("CLIDE: Error. RxBuff::buff is full, not all characters could be written to it!.\r\n");
+						this->rxController->printSink.PrintDebugInfo(
+								"CLIDE: No end-of-command character found, writing chars to RxBuff::buff.\r\n",
+								Print::DebugPrintingLevel::VERBOSE);
 					#endif
-					// Write null character to end of full buffer
-					this->buff[this->buffWritePos] = '\0';
-					return false;
+
+					// Partial command, keep it until the rest arrives
+					if(!this->Append(bytes, bytesEnd - bytes))
+						success = false;
+					break;
 				}
 
-				// Now check to see if this was the end-of-command character
-				if(characters[characterReadPos] == this->endOfCmdChar)
+				#if(clide_ENABLE_DEBUG_CODE == 1)
+					this->rxController->printSink.PrintDebugInfo(
+						"CLIDE: End of command character detected, calling Rx::Run().\r\n",
+						Print::DebugPrintingLevel::VERBOSE);
+				#endif
+
+				// Note that the end-of-command character is not part of the message.
+				// Rx::Run() does not modify the message, and the length is already known, so Rx
+				// does not need to call strlen().
+				size_t cmdLen = endOfCmd - bytes;
+				if((this->buffWritePos == 0) && (cmdLen <= this->buffSize) && (this->streamState != StreamState::DISCARDING))
 				{
-					#if(clide_ENABLE_DEBUG_CODE == 1)
-						Print::PrintDebugInfo(
-							"CLIDE: End of command character detected, calling Rx::Run().\r\n",
-							Print::DebugPrintingLevel::VERBOSE);
-					#endif
+					// The whole command is in the input, so it is passed straight to Rx without being copied
+					this->rxController->Run(bytes, cmdLen);
+				}
+				else
+				{
+					// Complete the command that was started by a previous write
+					if(!this->Append(bytes, cmdLen))
+						success = false;
+					this->RunBuff();
+				}
+
+				bytes = endOfCmd + 1;
+			}
 
-					// End of command character found! Send this to Rx!
-					// Note that the end-of-command character is not part of
-					rxController->Run(this->buff);
+			return success;
+		}
 
-					// Now clear buffer, doesn't need to be the whole thing, but why not for safety?
-					memset(this->buff, '\0', sizeof(this->buff));
+		void RxBuff::SetStreaming(bool enable)
+		{
+			this->streaming = enable;
+			this->buffWritePos = 0;
+			this->StreamReset();
+		}
 
-					// Reset position
-					this->buffWritePos = 0;
+		bool RxBuff::IsStreaming() const
+		{
+			return this->streaming;
+		}
 
-					// Increment character read pos
-					characterReadPos++;
+		void RxBuff::SetEarlyRejection(bool enable)
+		{
+			this->earlyRejection = enable;
+			if(enable)
+				this->rxController->EnableCmdPrefixIndex();
+		}
 
-				}
-				else	// Character was not the end-of-command character, write to buffer
+		bool RxBuff::IsRejectingEarly() const
+		{
+			return this->earlyRejection;
+		}
+
+		//===============================================================================================//
+		//====================================== PRIVATE METHODS ========================================//
+		//===============================================================================================//
+
+		bool RxBuff::Append(const char* bytes, size_t numBytes)
+		{
+			// Rejected, nothing is kept until the end of the command
+			if(this->streamState == StreamState::DISCARDING)
+				return true;
+
+			// When streaming, the last character is kept for the null character that ends the last argument
+			size_t capacity = this->streaming ? this->buffSize - 1 : this->buffSize;
+			size_t numFree = capacity - this->buffWritePos;
+			if(numBytes > numFree)
+			{
+				#if(clide_ENABLE_DEBUG_CODE == 1)
+					this->rxController->printSink.PrintError("CLIDE: Error. RxBuff::buff is full, not all characters could be written to it!.\r\n");
+				#endif
+
+				// Keep what fits, the command is truncated
+				memcpy(&this->buff[this->buffWritePos], bytes, numFree);
+				this->buffWritePos += numFree;
+				if(this->streaming)
+					this->StreamScan(this->buffWritePos - numFree);
+
+				// With early rejection, the whole command is discarded rather than truncated (unless it has already
+				// been rejected for something else, it is only reported once)
+				if(this->streaming && this->earlyRejection && (this->streamState != StreamState::DISCARDING))
 				{
-					#if(clide_ENABLE_DEBUG_CODE == 1)
-						Print::PrintDebugInfo("CLIDE: Writing to RxBuff::buff.\r\n", Print::DebugPrintingLevel::VERBOSE);
-					#endif
+					this->streamState = StreamState::DISCARDING;
+					this->buffWritePos = 0;
+					if(this->overflowCallback.obj != NULL)
+						this->overflowCallback.Execute(this);
+				}
+				return false;
+			}
+
+			memcpy(&this->buff[this->buffWritePos], bytes, numBytes);
+			this->buffWritePos += numBytes;
+			if(this->streaming)
+				this->StreamScan(this->buffWritePos - numBytes);
+			return true;
+		}
 
-					this->buff[this->buffWritePos] = characters[characterReadPos];
+		void RxBuff::RunBuff()
+		{
+			// Everything but the end of the last argument has already been done. Ending it can reject the command.
+			if(this->streaming && (this->streamState == StreamState::IN_ARG))
+				this->StreamEndArg(this->buffWritePos);
 
-					// Increment buffer write location by 1
-					this->buffWritePos++;
+			if(this->streaming && (this->streamState == StreamState::DISCARDING))
+			{
+				// Rejected, and already reported
+			}
+			else if(!this->streaming || (this->streamState == StreamState::SKIPPING_START))
+			{
+				// Not streaming, or no alphanumeric characters (buff has not been touched, Rx::Run() reports the error)
+				this->rxController->Run(this->buff, this->buffWritePos);
+			}
+			else
+			{
+				this->streamArgA[this->streamNumArgs] = NULL;
+				this->rxController->RunArgs(this->streamCmd, (int)this->streamNumArgs, this->streamArgA.Data());
+			}
 
-					// Increment character read pos
-					characterReadPos++;
+			this->StreamReset();
+			this->buffWritePos = 0;
+		}
+
+		void RxBuff::StreamScan(size_t pos)
+		{
+			// The same rules as Rx::Run() and Tokenizer::Run(), one character at a time
+			for(; pos < this->buffWritePos; pos++)
+			{
+				char c = this->buff[pos];
+
+				if(this->streamState == StreamState::IN_ARG)
+				{
+					if(c == Tokenizer::QUOTE_CHAR)
+						this->streamInsideQuotes = !this->streamInsideQuotes;
+					else if((c == ' ') && !this->streamInsideQuotes)
+					{
+						this->StreamEndArg(pos);
+						continue;
+					}
+
+					if(this->streamNumArgs == 1)
+					{
+						this->streamCmdNameHash = HashIndex::HashStep(this->streamCmdNameHash, c);
+						const char* cmdName = this->streamArgA[0];
+						if(this->earlyRejection
+							&& !this->rxController->IsCmdPrefix(cmdName, (uint32_t)(&this->buff[pos + 1] - cmdName), this->streamCmdNameHash))
+						{
+							this->StreamRejectCmd(pos + 1);
+							return;
+						}
+					}
+				}
+				else if(((this->streamState == StreamState::SKIPPING_START) && isalnum((unsigned char)c))
+					|| ((this->streamState == StreamState::BETWEEN_ARGS) && (c != ' ')))
+				{
+					// Start of an argument, keep room for the NULL pointer after the last one
+					if(this->streamNumArgs + 1 >= this->streamArgA.Capacity())
+						this->streamArgA.Reserve(this->streamArgA.Capacity()*2);
+					this->streamArgA[this->streamNumArgs++] = &this->buff[pos];
+
+					this->streamState = StreamState::IN_ARG;
+					this->streamInsideQuotes = (c == Tokenizer::QUOTE_CHAR);
+					if(this->streamNumArgs == 1)
+					{
+						this->streamCmdNameHash = HashIndex::HashStep(HashIndex::HASH_SEED, c);
+						if(this->earlyRejection && !this->rxController->IsCmdPrefix(&this->buff[pos], 1, this->streamCmdNameHash))
+						{
+							this->StreamRejectCmd(pos + 1);
+							return;
+						}
+					}
 				}
+			}
+		}
 
+		void RxBuff::StreamEndArg(size_t pos)
+		{
+			// Null-terminate the argument in place, buff is never passed to Rx::Run() after this
+			this->buff[pos] = '\0';
+			this->streamState = StreamState::BETWEEN_ARGS;
+
+			if(this->streamNumArgs == 1)
+			{
+				const char* cmdName = this->streamArgA[0];
+				this->streamCmd = this->rxController->FindCmd(
+					cmdName,
+					(uint32_t)(&this->buff[pos] - cmdName),
+					this->streamCmdNameHash);
+				if(this->earlyRejection && (this->streamCmd == NULL))
+					this->StreamRejectCmd(pos);
 			}
+		}
 
+		void RxBuff::StreamRejectCmd(size_t pos)
+		{
 			#if(clide_ENABLE_DEBUG_CODE == 1)
-				Print::PrintDebugInfo(
-						"CLIDE: RxBuff::Write() has finished writing chars to RxBuff::buff, no end-of-command character found.\r\n",
-						Print::DebugPrintingLevel::VERBOSE);
+				this->rxController->printSink.PrintDebugInfo(
+					"CLIDE: Command rejected, discarding until the end-of-command character.\r\n",
+					Print::DebugPrintingLevel::VERBOSE);
 			#endif
 
-			// Null character in input detected, write null to buff
-			this->buff[this->buffWritePos] = '\0';
-
-			// Do not increment write location pointer, so that any more incoming data overwrites this null pointer
+			const char* cmdName = this->streamArgA[0];
+			this->rxController->CmdNotRecognised(cmdName, (uint32_t)(&this->buff[pos] - cmdName));
+			this->rxController->printSink.Flush();
+			this->streamState = StreamState::DISCARDING;
+			this->buffWritePos = 0;
+		}
 
-			// If code go here, all characters must of been written successfully to buff
-			return true;
+		void RxBuff::StreamReset()
+		{
+			this->streamState = StreamState::SKIPPING_START;
+			this->streamInsideQuotes = false;
+			this->streamCmdNameHash = HashIndex::HASH_SEED;
+			this->streamCmd = NULL;
+			this->streamNumArgs = 0;
 		}
 
 	} // namespace MClide
@@ -0,0 +1,158 @@
+//!
+//! @file 			RxQueue.cpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! @created		2026-10-16
+//! @last-modified 	2026-10-16
+//! @brief 			A lock-free single-producer/single-consumer byte queue in front of an RxBuff.
+//! @details
+//!					See README.rst in repo root dir for more info.
+
+#ifndef __cplusplus
+	#error Please build with C++ compiler
+#endif
+
+//===============================================================================================//
+//========================================= INCLUDES ============================================//
+//===============================================================================================//
+
+//===== SYSTEM LIBRARIES =====//
+#include <stdint.h>
+#include <stddef.h>		// size_t
+#include <cstring>		// memcpy()
+
+//===== USER LIBRARIES =====//
+#include "MAssert/api/MAssertApi.hpp"
+
+//===== USER SOURCE =====//
+#include "../include/Rx.hpp"
+#include "../include/RxQueue.hpp"
+
+namespace MbeddedNinja
+{
+	namespace MClideNs
+	{
+
+		//===============================================================================================//
+		//======================================= PUBLIC METHODS ========================================//
+		//===============================================================================================//
+
+		RxQueue::RxQueue(RxBuff* rxBuff, uint32_t size) :
+			RxQueue(rxBuff, new char[size], size)
+		{
+			M_ASSERT(this->ring);
+			this->ownsRing = true;
+		}
+
+		RxQueue::RxQueue(RxBuff* rxBuff, char* ring, uint32_t size) :
+			writeCount(0),
+			numDropped(0),
+			readCount(0)
+		{
+			// The counts are turned into positions in the ring with a mask, and wrap around consistently
+			M_ASSERT((size != 0) && ((size & (size - 1)) == 0));
+
+			this->rxBuff = rxBuff;
+			this->ring = ring;
+			this->size = size;
+			this->ownsRing = false;
+			this->cachedReadCount = 0;
+		}
+
+		RxQueue::~RxQueue()
+		{
+			if(this->ownsRing)
+				delete[] this->ring;
+		}
+
+		uint32_t RxQueue::Write(const char* bytes, uint32_t numBytes)
+		{
+			// Only the producer writes writeCount, so it can be read without ordering
+			uint32_t writeCount = this->writeCount.load(std::memory_order_relaxed);
+
+			uint32_t numFree = this->size - (writeCount - this->cachedReadCount);
+			if(numFree < numBytes)
+			{
+				// Looks full, see how far the consumer has got
+				this->cachedReadCount = this->readCount.load(std::memory_order_acquire);
+				numFree = this->size - (writeCount - this->cachedReadCount);
+			}
+
+			uint32_t numToWrite = numBytes;
+			if(numToWrite > numFree)
+			{
+				this->numDropped.store(
+					this->numDropped.load(std::memory_order_relaxed) + (numBytes - numFree),
+					std::memory_order_relaxed);
+				numToWrite = numFree;
+			}
+
+			// Up to two copies, the second one if the characters wrap around the end of the ring
+			uint32_t pos = writeCount & (this->size - 1);
+			uint32_t numToEnd = this->size - pos;
+			if(numToWrite <= numToEnd)
+				memcpy(&this->ring[pos], bytes, numToWrite);
+			else
+			{
+				memcpy(&this->ring[pos], bytes, numToEnd);
+				memcpy(this->ring, &bytes[numToEnd], numToWrite - numToEnd);
+			}
+
+			// Publishes the characters to the consumer
+			this->writeCount.store(writeCount + numToWrite, std::memory_order_release);
+
+			return numToWrite;
+		}
+
+		bool RxQueue::WriteChar(char character)
+		{
+			return this->Write(&character, 1) == 1;
+		}
+
+		uint32_t RxQueue::Drain()
+		{
+			uint32_t readCount = this->readCount.load(std::memory_order_relaxed);
+			uint32_t writeCount = this->writeCount.load(std::memory_order_acquire);
+			uint32_t numQueued = writeCount - readCount;
+
+			if(numQueued == 0)
+				return 0;
+
+			// The characters are passed to RxBuff straight from the ring. Each part is only handed back to the
+			// producer once RxBuff has finished with it (commands may run straight from the ring).
+			uint32_t pos = readCount & (this->size - 1);
+			uint32_t numToEnd = this->size - pos;
+			if(numQueued <= numToEnd)
+				this->rxBuff->WriteBytes(&this->ring[pos], numQueued);
+			else
+			{
+				this->rxBuff->WriteBytes(&this->ring[pos], numToEnd);
+				this->readCount.store(readCount + numToEnd, std::memory_order_release);
+				this->rxBuff->WriteBytes(this->ring, numQueued - numToEnd);
+			}
+
+			this->readCount.store(writeCount, std::memory_order_release);
+
+			return numQueued;
+		}
+
+		uint32_t RxQueue::GetNumQueued() const
+		{
+			// readCount first, writeCount is never behind it
+			uint32_t readCount = this->readCount.load(std::memory_order_acquire);
+			return this->writeCount.load(std::memory_order_acquire) - readCount;
+		}
+
+		uint32_t RxQueue::GetCapacity() const
+		{
+			return this->size;
+		}
+
+		uint32_t RxQueue::GetNumDropped() const
+		{
+			return this->numDropped.load(std::memory_order_relaxed);
+		}
+
+	} // namespace MClide
+} // namespace MbeddedNinja
+
+// EOF
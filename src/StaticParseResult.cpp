@@ -0,0 +1,98 @@
+//!
+//! @file 			StaticParseResult.cpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! @created		2026-10-17
+//! @last-modified 	2026-10-17
+//! @brief 			Holds what StaticRx found in one received command (detected options, option values and parameters).
+//! @details
+//!					See README.rst in repo root dir for more info.
+
+#ifndef __cplusplus
+	#error Please build with C++ compiler
+#endif
+
+//===============================================================================================//
+//========================================= INCLUDES ============================================//
+//===============================================================================================//
+
+//===== SYSTEM LIBRARIES =====//
+#include <stdint.h>
+#include <string.h>		// memset()
+
+//===== USER SOURCE =====//
+#include "../include/StaticParseResult.hpp"
+
+namespace MbeddedNinja
+{
+	namespace MClideNs
+	{
+
+		//===============================================================================================//
+		//======================================= PUBLIC METHODS ========================================//
+		//===============================================================================================//
+
+		StaticParseResult::StaticParseResult(const StaticCmd* cmd, ParseArena* arena) :
+			optionResultA(arena)
+		{
+			this->cmd = cmd;
+
+			this->optionResultA.Reserve(cmd->numOptions);
+			memset(this->optionResultA.Data(), 0, sizeof(OptionResult)*cmd->numOptions);
+
+			this->paramA = NULL;
+			this->numParams = 0;
+		}
+
+		const StaticCmd* StaticParseResult::GetCmd() const
+		{
+			return this->cmd;
+		}
+
+		bool StaticParseResult::IsDetected(uint32_t optionNum) const
+		{
+			if(optionNum >= this->cmd->numOptions)
+				return false;
+
+			return this->optionResultA[optionNum].isDetected;
+		}
+
+		const char* StaticParseResult::GetValue(uint32_t optionNum) const
+		{
+			if(optionNum >= this->cmd->numOptions)
+				return NULL;
+
+			return this->optionResultA[optionNum].value;
+		}
+
+		uint32_t StaticParseResult::GetNumParams() const
+		{
+			return this->numParams;
+		}
+
+		const char* StaticParseResult::GetParam(uint32_t paramNum) const
+		{
+			if(paramNum >= this->numParams)
+				return NULL;
+
+			return this->paramA[paramNum];
+		}
+
+		void StaticParseResult::SetDetected(uint32_t optionNum, const char* value)
+		{
+			if(optionNum >= this->cmd->numOptions)
+				return;
+
+			this->optionResultA[optionNum].isDetected = true;
+			this->optionResultA[optionNum].value = value;
+		}
+
+		void StaticParseResult::SetParams(char* const* paramA, uint32_t numParams)
+		{
+			this->paramA = paramA;
+			this->numParams = numParams;
+		}
+
+	} // namespace MClide
+} // namespace MbeddedNinja
+
+// EOF
@@ -0,0 +1,354 @@
+//!
+//! @file 			StaticRx.cpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! @created		2026-10-17
+//! @last-modified 	2026-10-17
+//! @brief 			Decodes received commands against a StaticCmdTable, which is built by the compiler.
+//! @details
+//!					See README.rst in repo root dir for more info.
+
+#ifndef __cplusplus
+	#error Please build with C++ compiler
+#endif
+
+//===============================================================================================//
+//========================================= INCLUDES ============================================//
+//===============================================================================================//
+
+//===== SYSTEM LIBRARIES =====//
+#include <stdint.h>
+#include <stdio.h>		// snprintf()
+#include <string.h>		// strlen(), memcmp()
+#include <ctype.h>		// isalnum()
+
+//===== USER SOURCE =====//
+#include "../include/HashIndex.hpp"
+#include "../include/SmallBuff.hpp"
+#include "../include/Tokenizer.hpp"
+#include "../include/OptionParser.hpp"
+#include "../include/StaticRx.hpp"
+
+namespace MbeddedNinja
+{
+	namespace MClideNs
+	{
+
+		//===============================================================================================//
+		//===================================== STATIC CMD OPTIONS ======================================//
+		//===============================================================================================//
+
+		StaticCmdOptions::StaticCmdOptions(const StaticCmd* cmd)
+		{
+			this->cmd = cmd;
+		}
+
+		uint32_t StaticCmdOptions::NoOption()
+		{
+			return NOT_FOUND;
+		}
+
+		uint32_t StaticCmdOptions::HelpOption()
+		{
+			return HELP_OPTION;
+		}
+
+		uint32_t StaticCmdOptions::FindShortOption(char shortName) const
+		{
+			if(shortName == '\0')
+				return NOT_FOUND;
+
+			if((uint8_t)shortName < StaticCmd::NUM_SHORT_OPTION_INDEXES)
+			{
+				uint8_t optionIndex = this->cmd->shortOptionIndexA[(uint8_t)shortName];
+				return (optionIndex != 0) ? (uint32_t)(optionIndex - 1) : NOT_FOUND;
+			}
+
+			// Non-ASCII short names are not in the table, so search for them
+			for(uint32_t x = 0; x < this->cmd->numOptions; x++)
+			{
+				if(this->cmd->optionA[x].shortName == shortName)
+					return x;
+			}
+
+			return NOT_FOUND;
+		}
+
+		uint32_t StaticCmdOptions::FindLongOption(const char* name, uint32_t nameLen) const
+		{
+			// Options without a long name have a length of 0
+			if(nameLen == 0)
+				return NOT_FOUND;
+
+			// The hashes were worked out by the compiler, so most options are ruled out without comparing any characters
+			uint32_t nameHash = HashIndex::Hash(name, nameLen);
+			for(uint32_t x = 0; x < this->cmd->numOptions; x++)
+			{
+				const StaticOption& option = this->cmd->optionA[x];
+				if((option.longNameHash == nameHash) &&
+					(option.longNameLen == nameLen) &&
+					(memcmp(option.longName, name, nameLen) == 0))
+					return x;
+			}
+
+			return NOT_FOUND;
+		}
+
+		uint32_t StaticCmdOptions::GetNumOptions() const
+		{
+			return this->cmd->numOptions;
+		}
+
+		const char* StaticCmdOptions::GetLongName(uint32_t optionNum) const
+		{
+			const char* longName = this->cmd->optionA[optionNum].longName;
+			return (longName != nullptr) ? longName : "";
+		}
+
+		uint32_t StaticCmdOptions::GetOption(uint32_t optionNum) const
+		{
+			return optionNum;
+		}
+
+		bool StaticCmdOptions::HasValue(uint32_t optionNum) const
+		{
+			// The built-in help option doesn't have one
+			return (optionNum < this->cmd->numOptions) && this->cmd->optionA[optionNum].associatedValue;
+		}
+
+		//===============================================================================================//
+		//======================================= PUBLIC METHODS ========================================//
+		//===============================================================================================//
+
+		bool StaticRx::Run(const char* cmdMsg)
+		{
+			// Null-terminated message, pass onto the (message, length) version
+			return this->Run(cmdMsg, strlen(cmdMsg));
+		}
+
+		bool StaticRx::Run(const char* cmdMsg, size_t cmdMsgLen)
+		{
+			// Everything allocated from the arena during this parse is freed at the end of it
+			size_t arenaMark = (this->parseArena != NULL) ? this->parseArena->GetUsed() : 0;
+
+			bool returnValue = this->RunMsg(cmdMsg, cmdMsgLen);
+
+			if(this->parseArena != NULL)
+				this->parseArena->Release(arenaMark);
+
+			// The whole response goes to the sink at once
+			this->printSink.Flush();
+			return returnValue;
+		}
+
+		const StaticCmd* StaticRx::FindCmd(const char* cmdName, uint32_t cmdNameLen) const
+		{
+			uint32_t cmdNameHash = HashIndex::Hash(cmdName, cmdNameLen);
+
+			// Walk the commands in the bucket, the hash rules out nearly every other name without comparing it
+			uint16_t next = this->bucketA[cmdNameHash & this->bucketMask];
+			while(next != 0)
+			{
+				const StaticCmd* cmd = &this->cmdA[next - 1];
+				if((cmd->nameHash == cmdNameHash) &&
+					(cmd->nameLen == cmdNameLen) &&
+					(memcmp(cmd->name, cmdName, cmdNameLen) == 0))
+					return cmd;
+				next = this->nextA[next - 1];
+			}
+
+			return NULL;
+		}
+
+		//===============================================================================================//
+		//====================================== PRIVATE METHODS ========================================//
+		//===============================================================================================//
+
+		void StaticRx::Init(const StaticCmd* cmdA, uint32_t numCmds, const uint16_t* bucketA, uint32_t numBuckets, const uint16_t* nextA)
+		{
+			this->cmdA = cmdA;
+			this->numCmds = numCmds;
+			this->bucketA = bucketA;
+			this->bucketMask = numBuckets - 1;
+			this->nextA = nextA;
+			this->parseArena = NULL;
+		}
+
+		bool StaticRx::RunMsg(const char* cmdMsg, size_t cmdMsgLen)
+		{
+			// Skip all non-alphanumeric characters at the start of the message, like Rx
+			size_t msgStart = 0;
+			while((msgStart < cmdMsgLen) && !isalnum((unsigned char)cmdMsg[msgStart]))
+				msgStart++;
+
+			if(msgStart == cmdMsgLen)
+			{
+				this->printSink.PrintToCmdLine("error \"Received command contained no alpha-numeric characters.\"\r\n");
+				return false;
+			}
+
+			const char* msg = &cmdMsg[msgStart];
+			size_t msgLen = cmdMsgLen - msgStart;
+
+			//=========== SPLIT MESSAGE INTO TOKEN VIEWS ==============//
+
+			SmallBuff<TokenView, clide_NUM_INLINE_ARGS> tokenA(this->parseArena);
+
+			uint32_t numTokens = Tokenizer::Run(msg, msgLen, ' ', tokenA.Data(), tokenA.Capacity());
+
+			if(numTokens > tokenA.Capacity())
+			{
+				tokenA.Reserve(numTokens);
+				Tokenizer::Run(msg, msgLen, ' ', tokenA.Data(), tokenA.Capacity());
+			}
+
+			//=============== CHECK COMMAND IS VALID ==================//
+
+			const StaticCmd* foundCmd = this->FindCmd(&msg[tokenA[0].offset], tokenA[0].length);
+
+			if(foundCmd == NULL)
+			{
+				char tempBuff[100];
+				snprintf(
+					tempBuff,
+					sizeof(tempBuff),
+					"error \"Command '%.*s' not recognised.\"\r\n",
+					(int)tokenA[0].length,
+					&msg[tokenA[0].offset]);
+				this->printSink.PrintToCmdLine(tempBuff);
+				return false;
+			}
+
+			//==================== PARSE OPTIONS ======================//
+
+			// The parser reads the tokens where they are in the message. Only option values and parameters are
+			// copied into argBuff, since they are handed to the callback null-terminated. Every token plus a null
+			// character always fits into msgLen + 1 chars.
+			SmallBuff<ArgView, clide_NUM_INLINE_ARGS> argA(this->parseArena);
+			argA.Reserve(numTokens);
+			for(uint32_t x = 0; x < numTokens; x++)
+			{
+				argA[x].chars = &msg[tokenA[x].offset];
+				argA[x].length = tokenA[x].length;
+			}
+
+			SmallBuff<char, clide_ARG_BUFF_SIZE> argBuff(this->parseArena);
+			argBuff.Reserve(msgLen + 1);
+
+			SmallBuff<char*, clide_NUM_INLINE_ARGS> paramA(this->parseArena);
+			paramA.Reserve(numTokens);
+
+			StaticParseResult result(foundCmd, this->parseArena);
+
+			BasicOptionParser<StaticCmdOptions> optionParser(StaticCmdOptions(foundCmd), numTokens, argA.Data(), argBuff.Data(), paramA.Data());
+
+			uint32_t optionNum;
+			char* optionValue;
+			BasicOptionParser<StaticCmdOptions>::Status status;
+			while((status = optionParser.Next(&optionNum, &optionValue)) != BasicOptionParser<StaticCmdOptions>::Status::FINISHED)
+			{
+				// Unknown options and missing values are ignored, like Rx
+				if(status == BasicOptionParser<StaticCmdOptions>::Status::ERROR)
+					continue;
+
+				#if(clide_ENABLE_AUTO_HELP == 1)
+					// Once help is received, nothing else is done
+					if(optionNum == StaticCmdOptions::HELP_OPTION)
+					{
+						this->PrintHelpForCmd(foundCmd);
+						return true;
+					}
+				#endif
+
+				result.SetDetected(optionNum, optionValue);
+			}
+
+			//================== CHECK PARAMETERS =====================//
+
+			uint32_t numParams = optionParser.GetNumParams();
+			if(numParams != foundCmd->numParams)
+			{
+				char tempBuff[150];
+				snprintf(
+					tempBuff,
+					sizeof(tempBuff),
+					"error \"Num. of received parameters ('%u') does not match num. registered for cmd ('%u').\"\r\n",
+					numParams,
+					foundCmd->numParams);
+				this->printSink.PrintToCmdLine(tempBuff);
+				return false;
+			}
+
+			result.SetParams(paramA.Data(), numParams);
+
+			// The callback's return value is for the application, like Cmd::resultFunctionCallback
+			if(foundCmd->callback != NULL)
+				foundCmd->callback(result);
+
+			return true;
+		}
+
+		#if(clide_ENABLE_AUTO_HELP == 1)
+			void StaticRx::PrintHelpForCmd(const StaticCmd* cmd)
+			{
+				char tempBuff[50];
+
+				this->printSink.PrintToCmdLine("\r\n**********COMMAND HELP:**********\r\n");
+
+				// CMD NAME AND DESCRIPTION
+
+				this->printSink.PrintToCmdLine("\t");
+				this->printSink.PrintToCmdLine(cmd->name);
+				this->printSink.PrintToCmdLine("\t");
+				this->printSink.PrintToCmdLine((cmd->description != nullptr) ? cmd->description : "");
+				this->printSink.PrintToCmdLine("\r\n");
+
+				// CMD PARAMETERS
+
+				this->printSink.PrintToCmdLine("Command Parameters:\r\n");
+
+				if(cmd->numParams == 0)
+					this->printSink.PrintToCmdLine("\tNO PARAMS\r\n");
+				else
+				{
+					this->printSink.PrintToCmdLine("\tindex\tdescription\r\n");
+					for(uint32_t x = 0; x < cmd->numParams; x++)
+					{
+						snprintf(tempBuff, sizeof(tempBuff), "\t%u\t", (unsigned int)x);
+						this->printSink.PrintToCmdLine(tempBuff);
+						this->printSink.PrintToCmdLine((cmd->paramA[x].description != nullptr) ? cmd->paramA[x].description : "");
+						this->printSink.PrintToCmdLine("\r\n");
+					}
+				}
+
+				// CMD OPTIONS
+
+				// The built-in help option is listed first, as if it was declared with every command
+				this->printSink.PrintToCmdLine("Command Options:\r\n");
+				this->printSink.PrintToCmdLine("\tshort\tlong\tdescription\r\n");
+				snprintf(tempBuff, sizeof(tempBuff), "\t%c\t%s\t", Cmd::HELP_SHORT_NAME, Cmd::HELP_LONG_NAME);
+				this->printSink.PrintToCmdLine(tempBuff);
+				this->printSink.PrintToCmdLine("Prints help for the command.\r\n");
+
+				for(uint32_t x = 0; x < cmd->numOptions; x++)
+				{
+					const StaticOption& option = cmd->optionA[x];
+
+					char shortName[2];
+					shortName[0] = option.shortName;
+					shortName[1] = '\0';
+
+					this->printSink.PrintToCmdLine("\t");
+					this->printSink.PrintToCmdLine(shortName);
+					this->printSink.PrintToCmdLine("\t");
+					this->printSink.PrintToCmdLine((option.longName != nullptr) ? option.longName : "");
+					this->printSink.PrintToCmdLine("\t");
+					this->printSink.PrintToCmdLine((option.description != nullptr) ? option.description : "");
+					this->printSink.PrintToCmdLine("\r\n");
+				}
+			}
+		#endif
+
+	} // namespace MClide
+} // namespace MbeddedNinja
+
+// EOF
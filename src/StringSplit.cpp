@@ -2,7 +2,7 @@
 //! @file 			StringSplit.cpp
 //! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
 //! @created		2013-04-10
-//! @last-modified 	2014-10-07
+//! @last-modified 	2026-10-16
 //! @brief 			Features a string split function which ignores delimiters inside quotation marks.
 //! @details	
 //!					See README.rst in repo root dir for more information.
@@ -33,11 +33,9 @@ namespace MbeddedNinja
 		//===============================================================================================//
 
 
-		char* StringSplit::Run(char *s, const char *delim)
+		char* StringSplit::Run(char *s, const char *delim, char **last)
 		{
-			static char *last;
-
-			return Int(s, delim, &last, '\"');
+			return Int(s, delim, last, '\"');
 		}
 
 
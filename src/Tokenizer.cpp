@@ -0,0 +1,82 @@
+//!
+//! @file 			Tokenizer.cpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! @created		2026-10-16
+//! @last-modified 	2026-10-16
+//! @brief 			Splits a command message into token views, without modifying or copying the message.
+//! @details
+//!					See README.rst in the repo root dir for more info.
+
+#ifndef __cplusplus
+	#error Please build with C++ compiler
+#endif
+
+//===============================================================================================//
+//========================================= INCLUDES ============================================//
+//===============================================================================================//
+
+//===== SYSTEM LIBRARIES =====//
+#include <stdint.h>
+#include <stddef.h>		// size_t
+
+//===== USER SOURCE =====//
+#include "../include/Tokenizer.hpp"
+
+namespace MbeddedNinja
+{
+	namespace MClideNs
+	{
+
+		//===============================================================================================//
+		//===================================== PUBLIC FUNCTIONS ========================================//
+		//===============================================================================================//
+
+		const char Tokenizer::QUOTE_CHAR;
+
+		uint32_t Tokenizer::Run(
+			const char* msg,
+			size_t msgLen,
+			char delim,
+			TokenView* tokenA,
+			uint32_t maxNumTokens)
+		{
+			uint32_t numTokens = 0;
+			size_t pos = 0;
+
+			while(pos < msgLen)
+			{
+				// Skip leading delimiters
+				if(msg[pos] == delim)
+				{
+					pos++;
+					continue;
+				}
+
+				// Start of token. Delimiters do not end the token while inside quotes.
+				size_t tokenStart = pos;
+				bool insideQuotes = false;
+				while(pos < msgLen)
+				{
+					if(msg[pos] == QUOTE_CHAR)
+						insideQuotes = !insideQuotes;
+					else if(msg[pos] == delim && !insideQuotes)
+						break;
+					pos++;
+				}
+
+				// Token ends at the delimiter, or at the end of the message (which also ends an unterminated quote)
+				if(numTokens < maxNumTokens)
+				{
+					tokenA[numTokens].offset = (uint32_t)tokenStart;
+					tokenA[numTokens].length = (uint32_t)(pos - tokenStart);
+				}
+				numTokens++;
+			}
+
+			return numTokens;
+		}
+
+	} // namespace MClide
+} // namespace MbeddedNinja
+
+// EOF
@@ -0,0 +1,357 @@
+//!
+//! @file 			ValueSpec.cpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! @created		2026-10-17
+//! @last-modified 	2026-10-17
+//! @brief 			The type (and allowed range) of a parameter or option value, and the conversion to it.
+//! @details
+//!					See README.rst in repo root dir for more info.
+
+#ifndef __cplusplus
+	#error Please build with C++ compiler
+#endif
+
+//===============================================================================================//
+//========================================= INCLUDES ============================================//
+//===============================================================================================//
+
+//===== SYSTEM LIBRARIES =====//
+#include <stdint.h>
+#include <stdio.h>		// snprintf()
+#include <stdlib.h>		// strtod()
+#include <string.h>		// strcmp(), strlen()
+#include <errno.h>		// errno, ERANGE
+#include <math.h>		// HUGE_VAL
+#include <float.h>		// FLT_EVAL_METHOD
+#include <cinttypes>	// PRId64
+
+//===== USER SOURCE =====//
+#include "../include/ValueSpec.hpp"
+
+namespace MbeddedNinja
+{
+	namespace MClideNs
+	{
+
+		//===============================================================================================//
+		//====================================== PRIVATE FUNCTIONS ======================================//
+		//===============================================================================================//
+
+		//! @brief		Compares two null-terminated strings, ignoring the case of ASCII letters.
+		static bool EqualsIgnoreCase(const char* str1, const char* str2)
+		{
+			for(; (*str1 != '\0') && (*str2 != '\0'); str1++, str2++)
+			{
+				char c1 = ((*str1 >= 'A') && (*str1 <= 'Z')) ? (char)(*str1 - 'A' + 'a') : *str1;
+				char c2 = ((*str2 >= 'A') && (*str2 <= 'Z')) ? (char)(*str2 - 'A' + 'a') : *str2;
+				if(c1 != c2)
+					return false;
+			}
+			return *str1 == *str2;
+		}
+
+		//===============================================================================================//
+		//======================================= PUBLIC METHODS ========================================//
+		//===============================================================================================//
+
+		ValueSpec::ValueSpec()
+		{
+			this->type = ValueType::STRING;
+			this->minInt = INT64_MIN;
+			this->maxInt = INT64_MAX;
+			this->minDouble = -HUGE_VAL;
+			this->maxDouble = HUGE_VAL;
+			this->enumNameA = NULL;
+			this->numEnumNames = 0;
+		}
+
+		ValueSpec ValueSpec::Int32(int32_t min, int32_t max)
+		{
+			ValueSpec valueSpec;
+			valueSpec.type = ValueType::INT32;
+			valueSpec.minInt = min;
+			valueSpec.maxInt = max;
+			return valueSpec;
+		}
+
+		ValueSpec ValueSpec::UInt32(uint32_t min, uint32_t max)
+		{
+			ValueSpec valueSpec;
+			valueSpec.type = ValueType::UINT32;
+			valueSpec.minInt = min;
+			valueSpec.maxInt = max;
+			return valueSpec;
+		}
+
+		ValueSpec ValueSpec::Int64(int64_t min, int64_t max)
+		{
+			ValueSpec valueSpec;
+			valueSpec.type = ValueType::INT64;
+			valueSpec.minInt = min;
+			valueSpec.maxInt = max;
+			return valueSpec;
+		}
+
+		ValueSpec ValueSpec::Double(double min, double max)
+		{
+			ValueSpec valueSpec;
+			valueSpec.type = ValueType::DOUBLE;
+			valueSpec.minDouble = min;
+			valueSpec.maxDouble = max;
+			return valueSpec;
+		}
+
+		ValueSpec ValueSpec::Double()
+		{
+			return ValueSpec::Double(-HUGE_VAL, HUGE_VAL);
+		}
+
+		ValueSpec ValueSpec::Bool()
+		{
+			ValueSpec valueSpec;
+			valueSpec.type = ValueType::BOOL;
+			return valueSpec;
+		}
+
+		ValueSpec ValueSpec::Enum(const char* const* enumNameA, uint32_t numEnumNames)
+		{
+			ValueSpec valueSpec;
+			valueSpec.type = ValueType::ENUM;
+			valueSpec.enumNameA = enumNameA;
+			valueSpec.numEnumNames = numEnumNames;
+			return valueSpec;
+		}
+
+		ValueSpec::Status ValueSpec::Convert(const char* str, Value* value) const
+		{
+			switch(this->type)
+			{
+				case ValueType::INT32:
+				case ValueType::UINT32:
+				case ValueType::INT64:
+				{
+					int64_t int64;
+					Status status = ValueSpec::ParseInt64(str, &int64);
+					if(status != Status::OK)
+						return status;
+					if((int64 < this->minInt) || (int64 > this->maxInt))
+						return Status::OUT_OF_RANGE;
+
+					if(this->type == ValueType::INT32)
+						value->int32 = (int32_t)int64;
+					else if(this->type == ValueType::UINT32)
+						value->uint32 = (uint32_t)int64;
+					else
+						value->int64 = int64;
+					return Status::OK;
+				}
+				case ValueType::DOUBLE:
+				{
+					double float64;
+					Status status = ValueSpec::ParseDouble(str, &float64);
+					if(status != Status::OK)
+						return status;
+					// Written so that NaN is out of range
+					if(!((float64 >= this->minDouble) && (float64 <= this->maxDouble)))
+						return Status::OUT_OF_RANGE;
+					value->float64 = float64;
+					return Status::OK;
+				}
+				case ValueType::BOOL:
+				{
+					if((strcmp(str, "1") == 0) || EqualsIgnoreCase(str, "true") || EqualsIgnoreCase(str, "on") || EqualsIgnoreCase(str, "yes"))
+						value->boolean = true;
+					else if((strcmp(str, "0") == 0) || EqualsIgnoreCase(str, "false") || EqualsIgnoreCase(str, "off") || EqualsIgnoreCase(str, "no"))
+						value->boolean = false;
+					else
+						return Status::INVALID;
+					return Status::OK;
+				}
+				case ValueType::ENUM:
+				{
+					for(uint32_t x = 0; x < this->numEnumNames; x++)
+					{
+						if(strcmp(str, this->enumNameA[x]) == 0)
+						{
+							value->enumIndex = x;
+							return Status::OK;
+						}
+					}
+					return Status::INVALID;
+				}
+				case ValueType::STRING:
+				default:
+					return Status::OK;
+			}
+		}
+
+		const char* ValueSpec::GetTypeName() const
+		{
+			switch(this->type)
+			{
+				case ValueType::INT32:
+					return "int32";
+				case ValueType::UINT32:
+					return "uint32";
+				case ValueType::INT64:
+					return "int64";
+				case ValueType::DOUBLE:
+					return "double";
+				case ValueType::BOOL:
+					return "bool";
+				case ValueType::ENUM:
+					return "enum";
+				case ValueType::STRING:
+				default:
+					return "string";
+			}
+		}
+
+		void ValueSpec::GetRangeString(char* buff, size_t buffSize) const
+		{
+			if(buffSize == 0)
+				return;
+			buff[0] = '\0';
+
+			switch(this->type)
+			{
+				case ValueType::INT32:
+				case ValueType::UINT32:
+				case ValueType::INT64:
+					snprintf(buff, buffSize, "%" PRId64 " to %" PRId64, this->minInt, this->maxInt);
+					break;
+				case ValueType::DOUBLE:
+					snprintf(buff, buffSize, "%g to %g", this->minDouble, this->maxDouble);
+					break;
+				case ValueType::BOOL:
+					snprintf(buff, buffSize, "true, false");
+					break;
+				case ValueType::ENUM:
+				{
+					size_t buffPos = 0;
+					for(uint32_t x = 0; (x < this->numEnumNames) && (buffPos < buffSize - 1); x++)
+					{
+						int numChars = snprintf(&buff[buffPos], buffSize - buffPos, (x == 0) ? "%s" : ", %s", this->enumNameA[x]);
+						if(numChars < 0)
+							break;
+						buffPos += (size_t)numChars;
+					}
+					break;
+				}
+				case ValueType::STRING:
+				default:
+					break;
+			}
+		}
+
+		ValueSpec::Status ValueSpec::ParseInt64(const char* str, int64_t* value)
+		{
+			bool isNegative = false;
+			if((*str == '-') || (*str == '+'))
+			{
+				isNegative = (*str == '-');
+				str++;
+			}
+
+			uint32_t base = 10;
+			if((str[0] == '0') && ((str[1] == 'x') || (str[1] == 'X')))
+			{
+				base = 16;
+				str += 2;
+			}
+
+			if(*str == '\0')
+				return Status::INVALID;
+
+			// The magnitude is accumulated unsigned, so INT64_MIN can be read
+			const uint64_t maxMagnitude = isNegative ? (uint64_t)INT64_MAX + 1u : (uint64_t)INT64_MAX;
+			uint64_t magnitude = 0;
+			bool isTooBig = false;
+			for(; *str != '\0'; str++)
+			{
+				uint32_t digit;
+				if((*str >= '0') && (*str <= '9'))
+					digit = (uint32_t)(*str - '0');
+				else if((base == 16) && (*str >= 'a') && (*str <= 'f'))
+					digit = (uint32_t)(*str - 'a' + 10);
+				else if((base == 16) && (*str >= 'A') && (*str <= 'F'))
+					digit = (uint32_t)(*str - 'A' + 10);
+				else
+					return Status::INVALID;
+
+				// Keep checking the rest of the characters, so "99999999999999999999x" is invalid rather than out of range
+				if(isTooBig || (magnitude > (maxMagnitude - digit)/base))
+					isTooBig = true;
+				else
+					magnitude = magnitude*base + digit;
+			}
+
+			if(isTooBig)
+				return Status::OUT_OF_RANGE;
+
+			*value = isNegative ? (int64_t)(0u - magnitude) : (int64_t)magnitude;
+			return Status::OK;
+		}
+
+		ValueSpec::Status ValueSpec::ParseDouble(const char* str, double* value)
+		{
+			#if(FLT_EVAL_METHOD == 0)
+				static const double powerOf10A[] = {
+					1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15 };
+
+				const char* pos = str;
+				bool isNegative = false;
+				if((*pos == '-') || (*pos == '+'))
+				{
+					isNegative = (*pos == '-');
+					pos++;
+				}
+
+				uint64_t digits = 0;
+				uint32_t numDigits = 0;
+				uint32_t numFractionDigits = 0;
+				bool hasPoint = false;
+				for(; *pos != '\0'; pos++)
+				{
+					if((*pos >= '0') && (*pos <= '9') && (numDigits < 15))
+					{
+						digits = digits*10 + (uint64_t)(*pos - '0');
+						numDigits++;
+						if(hasPoint)
+							numFractionDigits++;
+					}
+					else if((*pos == '.') && !hasPoint)
+						hasPoint = true;
+					else
+						break;
+				}
+
+				// Up to 15 digits and a power of 10 up to 1e15 are both exact doubles, so the division is correctly
+				// rounded and gives the same value as strtod()
+				if((*pos == '\0') && (numDigits != 0))
+				{
+					double float64 = (double)digits/powerOf10A[numFractionDigits];
+					*value = isNegative ? -float64 : float64;
+					return Status::OK;
+				}
+			#endif
+
+			// There is no locale-free from_chars() for doubles before C++17, so this uses strtod(), checking
+			// that it used the whole string
+			if(*str == '\0')
+				return Status::INVALID;
+			char* end;
+			errno = 0;
+			double float64 = strtod(str, &end);
+			if(*end != '\0')
+				return Status::INVALID;
+			if(errno == ERANGE)
+				return Status::OUT_OF_RANGE;
+			*value = float64;
+			return Status::OK;
+		}
+
+	} // namespace MClide
+} // namespace MbeddedNinja
+
+// EOF
@@ -0,0 +1,288 @@
+//!
+//! @file 			AllocationFreeTests.cpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! @created		2026-10-16
+//! @last-modified 	2026-10-16
+//! @brief 			Contains test functions which count the heap allocations made by Rx::Run() on a frozen Rx.
+//! @details
+//!					See README.rst in root dir for more info.
+
+//===== SYSTEM LIBRARIES =====//
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <new>
+
+//====== USER LIBRARIES =====//
+#include "MUnitTest/api/MUnitTestApi.hpp"
+
+//===== USER SOURCE =====//
+#include "../api/MClideApi.hpp"
+
+using namespace MbeddedNinja::MClideNs;
+
+//===============================================================================================//
+//===================================== ALLOCATION COUNTING =====================================//
+//===============================================================================================//
+
+// Every heap allocation in the test program (operator new and malloc() from MString e.t.c.) goes through
+// malloc(), which is replaced here with a version that counts calls while counting is enabled. Only glibc
+// exports __libc_malloc() and friends, so on anything else the allocation checks are skipped.
+#if defined(__GLIBC__)
+
+	#define ALLOC_COUNTING_SUPPORTED 1
+
+	extern "C"
+	{
+		void* __libc_malloc(size_t size);
+		void* __libc_calloc(size_t num, size_t size);
+		void* __libc_realloc(void* ptr, size_t size);
+		void __libc_free(void* ptr);
+	}
+
+	static thread_local bool _countAllocs = false;
+	static thread_local uint32_t _numAllocs = 0;
+
+	extern "C" void* malloc(size_t size)
+	{
+		if(_countAllocs)
+			_numAllocs++;
+		return __libc_malloc(size);
+	}
+
+	extern "C" void* calloc(size_t num, size_t size)
+	{
+		if(_countAllocs)
+			_numAllocs++;
+		return __libc_calloc(num, size);
+	}
+
+	extern "C" void* realloc(void* ptr, size_t size)
+	{
+		if(_countAllocs)
+			_numAllocs++;
+		return __libc_realloc(ptr, size);
+	}
+
+	extern "C" void free(void* ptr)
+	{
+		__libc_free(ptr);
+	}
+
+	void* operator new(size_t size)
+	{
+		void* ptr = malloc(size);
+		if(ptr == NULL)
+			throw std::bad_alloc();
+		return ptr;
+	}
+
+	void* operator new[](size_t size)
+	{
+		return operator new(size);
+	}
+
+	void operator delete(void* ptr) noexcept
+	{
+		free(ptr);
+	}
+
+	void operator delete[](void* ptr) noexcept
+	{
+		free(ptr);
+	}
+
+#else
+	#define ALLOC_COUNTING_SUPPORTED 0
+	static bool _countAllocs = false;
+	static uint32_t _numAllocs = 0;
+#endif
+
+namespace MClideTest
+{
+
+	//! @brief		Returns the number of heap allocations made by numRuns calls to rxController.Run(msg).
+	static uint32_t CountAllocs(Rx& rxController, const char* msg, uint32_t numRuns)
+	{
+		_numAllocs = 0;
+		_countAllocs = true;
+		for(uint32_t x = 0; x < numRuns; x++)
+			rxController.Run(msg);
+		_countAllocs = false;
+		return _numAllocs;
+	}
+
+	static uint32_t _numResultCallbacks = 0;
+
+	static bool ResultCallback(const ParseResult& result)
+	{
+		_numResultCallbacks++;
+		return true;
+	}
+
+	static bool Callback(Cmd* cmd)
+	{
+		return true;
+	}
+
+	class UnrecogCallbackClass
+	{
+		public:
+		void Callback(char* cmdName)
+		{
+			this->numCalls++;
+		}
+
+		uint32_t numCalls;
+	};
+
+	MTEST(AllocationCountingWorksTest)
+	{
+		if(!ALLOC_COUNTING_SUPPORTED)
+			return;
+
+		// Not frozen, so option values and parameters are copied into MStrings
+		Rx rxController;
+		Cmd cmdTest("test", &Callback, "A test command.");
+		Param cmdTestParam("A test parameter.");
+		cmdTest.RegisterParam(&cmdTestParam);
+		rxController.RegisterCmd(&cmdTest);
+
+		CHECK_EQUAL(CountAllocs(rxController, "test param1", 10) >= 10, true);
+	}
+
+	MTEST(FrozenRxRunDoesNotAllocateTest)
+	{
+		if(!ALLOC_COUNTING_SUPPORTED)
+			return;
+
+		Rx rxController;
+		Cmd cmdTest("test", NULL, "A test command.");
+		cmdTest.resultFunctionCallback = &ResultCallback;
+		Param cmdTestParam1("A test parameter.");
+		cmdTest.RegisterParam(&cmdTestParam1);
+		Param cmdTestParam2("A test parameter.");
+		cmdTest.RegisterParam(&cmdTestParam2);
+		Option cmdTestOptionA('a', "alpha", NULL, "A test option.", false);
+		cmdTest.RegisterOption(&cmdTestOptionA);
+		Option cmdTestOptionB('b', "bravo", NULL, "A test option with a value.", true);
+		cmdTest.RegisterOption(&cmdTestOptionB);
+		rxController.RegisterCmd(&cmdTest);
+		rxController.Freeze();
+
+		_numResultCallbacks = 0;
+
+		// Both option parsers
+		CHECK_EQUAL(CountAllocs(rxController, "test -a --bravo \"-1.5\" param1 param2", 1000), 0);
+		rxController.optionParserMode = Rx::OptionParserMode::SINGLE_PASS;
+		CHECK_EQUAL(CountAllocs(rxController, "test param1 --bravo=val -a param2", 1000), 0);
+
+		CHECK_EQUAL(_numResultCallbacks, 2000);
+	}
+
+	MTEST(FrozenRxLongMessageWithArenaDoesNotAllocateTest)
+	{
+		if(!ALLOC_COUNTING_SUPPORTED)
+			return;
+
+		const uint32_t numParams = 40;
+		const uint32_t numOptions = 20;
+
+		Rx rxController;
+		static uint8_t arenaBuff[4096];
+		ParseArena arena(arenaBuff, sizeof(arenaBuff));
+		rxController.parseArena = &arena;
+
+		// More arguments and options than are stored inline
+		Cmd cmdTest("test", NULL, "A test command.");
+		cmdTest.resultFunctionCallback = &ResultCallback;
+		Param* paramA[numParams];
+		for(uint32_t x = 0; x < numParams; x++)
+		{
+			paramA[x] = new Param("A test parameter.");
+			cmdTest.RegisterParam(paramA[x]);
+		}
+		Option* optionA[numOptions];
+		for(uint32_t x = 0; x < numOptions; x++)
+		{
+			optionA[x] = new Option('A' + x, "", NULL, "A test option.", false);
+			cmdTest.RegisterOption(optionA[x]);
+		}
+		rxController.RegisterCmd(&cmdTest);
+		rxController.Freeze();
+
+		char msg[300] = "test -A -T";
+		for(uint32_t x = 0; x < numParams; x++)
+			strcat(msg, " p");
+
+		_numResultCallbacks = 0;
+		CHECK_EQUAL(CountAllocs(rxController, msg, 100), 0);
+		CHECK_EQUAL(_numResultCallbacks, 100);
+		CHECK_EQUAL(arena.GetUsed(), 0);
+
+		for(uint32_t x = 0; x < numParams; x++)
+			delete paramA[x];
+		for(uint32_t x = 0; x < numOptions; x++)
+			delete optionA[x];
+	}
+
+	MTEST(FrozenRxStreamingRxBuffDoesNotAllocateTest)
+	{
+		if(!ALLOC_COUNTING_SUPPORTED)
+			return;
+
+		Rx rxController;
+		Cmd cmdTest("test", NULL, "A test command.");
+		cmdTest.resultFunctionCallback = &ResultCallback;
+		Param cmdTestParam("A test parameter.");
+		cmdTest.RegisterParam(&cmdTestParam);
+		Option cmdTestOptionB('b', "bravo", NULL, "A test option with a value.", true);
+		cmdTest.RegisterOption(&cmdTestOptionB);
+		rxController.RegisterCmd(&cmdTest);
+		rxController.Freeze();
+
+		RxBuff rxBuff(&rxController, '\n');
+		rxBuff.SetStreaming(true);
+
+		const char* msg = "test -b \"-1.5\" param1\n";
+
+		_numResultCallbacks = 0;
+		_numAllocs = 0;
+		_countAllocs = true;
+		for(uint32_t x = 0; x < 100; x++)
+		{
+			for(const char* c = msg; *c != '\0'; c++)
+				rxBuff.WriteChar(*c);
+		}
+		_countAllocs = false;
+
+		CHECK_EQUAL(_numAllocs, 0);
+		CHECK_EQUAL(_numResultCallbacks, 100);
+	}
+
+	MTEST(FrozenRxUnrecognisedCmdDoesNotAllocateTest)
+	{
+		if(!ALLOC_COUNTING_SUPPORTED)
+			return;
+
+		Rx rxController;
+		Cmd cmdTest("test", NULL, "A test command.");
+		rxController.RegisterCmd(&cmdTest);
+
+		UnrecogCallbackClass callbackClass;
+		callbackClass.numCalls = 0;
+		rxController.cmdUnrecogCallback =
+			MCallbacks::CallbackGen<UnrecogCallbackClass, void, char*>(&callbackClass, &UnrecogCallbackClass::Callback);
+		rxController.Freeze();
+
+		bool enableCmdLinePrinting = Print::enableCmdLinePrinting;
+		Print::enableCmdLinePrinting = false;
+
+		CHECK_EQUAL(CountAllocs(rxController, "tset param1", 100), 0);
+
+		Print::enableCmdLinePrinting = enableCmdLinePrinting;
+
+		CHECK_EQUAL(callbackClass.numCalls, 100);
+	}
+
+} // namespace MClideTest
@@ -0,0 +1,142 @@
+//!
+//! @file 			BuiltInHelpOptionTests.cpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! @created		2026-10-17
+//! @last-modified 	2026-10-17
+//! @brief 			Contains test functions for the built-in "-h/--help" option, which is shared by every command.
+//! @details
+//!					See README.rst in root dir for more info.
+
+//===== SYSTEM LIBRARIES =====//
+#include <stdio.h>
+#include <string>
+
+//====== USER LIBRARIES =====//
+#include "MUnitTest/api/MUnitTestApi.hpp"
+
+//===== USER SOURCE =====//
+#include "../api/MClideApi.hpp"
+
+using namespace MbeddedNinja::MClideNs;
+
+namespace MClideTest
+{
+
+	static uint32_t _numHelpOptionCallbacks = 0;
+
+	static bool HelpOptionCallback(const ParseResult& result)
+	{
+		(void)result;
+		_numHelpOptionCallbacks++;
+		return true;
+	}
+
+	//! @brief		Collects the command-line output.
+	class HelpOptionRecorder
+	{
+		public:
+		void CmdLine(const char* msg)
+		{
+			this->output += msg;
+		}
+
+		std::string output;
+	};
+
+	//! @brief		Owns an Rx with a command with no options and one with an option, whose output goes to its own
+	//!				recorder.
+	class HelpOptionParser
+	{
+		public:
+
+		Rx rxController;
+		Cmd cmdNoOptions;
+		Cmd cmdWithOption;
+		Option optionVerbose;
+		HelpOptionRecorder recorder;
+
+		HelpOptionParser() :
+			cmdNoOptions("plain", NULL, "No options."),
+			cmdWithOption("verbose", NULL, "One option."),
+			optionVerbose('v', "verbose", NULL, "Verbose.", false)
+		{
+			this->cmdNoOptions.resultFunctionCallback = &HelpOptionCallback;
+			this->cmdWithOption.resultFunctionCallback = &HelpOptionCallback;
+			this->cmdWithOption.RegisterOption(&this->optionVerbose);
+			this->rxController.RegisterCmd(&this->cmdNoOptions);
+			this->rxController.RegisterCmd(&this->cmdWithOption);
+			this->rxController.printSink.cmdLinePrintCallback =
+				MCallbacks::CallbackGen<HelpOptionRecorder, void, const char*>(&this->recorder, &HelpOptionRecorder::CmdLine);
+		}
+	};
+
+	MTEST(BuiltInHelpOptionNotRegisteredTest)
+	{
+		Cmd cmd1("cmd1", NULL, "A test command.");
+		Cmd cmd2("cmd2", NULL, "A test command.");
+		Option optionA('a', "alpha", NULL, "A test option.", false);
+
+		// Nothing is registered for help, and the first option registered is the first in optionA
+		CHECK_EQUAL(cmd1.optionA.Size(), 0);
+		CHECK_EQUAL(cmd1.RegisterOption(&optionA).index, 0);
+		CHECK_EQUAL(cmd1.optionA.Size(), 1);
+		CHECK_EQUAL(cmd1.FindOptionByShortName('h') == nullptr, true);
+		CHECK_EQUAL(cmd1.FindOptionByLongName("help") == nullptr, true);
+
+		// One help option for every command
+		CHECK_EQUAL(Cmd::GetHelpOption() != nullptr, true);
+		CHECK_EQUAL(Cmd::GetHelpOption() == Cmd::GetHelpOption(), true);
+		CHECK_EQUAL(Cmd::GetHelpOption()->shortName, 'h');
+		CHECK_EQUAL(Cmd::GetHelpOption()->longName, "help");
+		CHECK_EQUAL(Cmd::GetHelpOption()->parentCmd == nullptr, true);
+	}
+
+	MTEST(BuiltInHelpOptionRecognisedTest)
+	{
+		HelpOptionParser parser;
+		const char* helpMsgA[] = { "plain -h", "plain --help", "plain --hel", "verbose -h", "verbose -vh", "verbose --help p1" };
+
+		// Both option parsers, unfrozen and frozen
+		for(uint32_t pass = 0; pass < 4; pass++)
+		{
+			parser.rxController.optionParserMode = (pass % 2 == 0) ? Rx::OptionParserMode::GETOPT : Rx::OptionParserMode::SINGLE_PASS;
+			if(pass == 2)
+				parser.rxController.Freeze();
+
+			for(uint32_t x = 0; x < sizeof(helpMsgA)/sizeof(helpMsgA[0]); x++)
+			{
+				_numHelpOptionCallbacks = 0;
+				parser.recorder.output.clear();
+				CHECK_EQUAL(parser.rxController.Run(helpMsgA[x]), true);
+
+				// Help is printed instead of calling the callback
+				CHECK_EQUAL(_numHelpOptionCallbacks, 0);
+				CHECK_EQUAL(parser.recorder.output.find("Prints help for the command.") != std::string::npos, true);
+			}
+
+			// Other options still work
+			_numHelpOptionCallbacks = 0;
+			CHECK_EQUAL(parser.rxController.Run("verbose -v"), true);
+			CHECK_EQUAL(_numHelpOptionCallbacks, 1);
+		}
+	}
+
+	MTEST(BuiltInHelpOptionListedTest)
+	{
+		HelpOptionParser parser;
+
+		// Listed first, as if registered with every command
+		parser.rxController.Run("plain -h");
+		CHECK_EQUAL(parser.recorder.output.find("NO OPTIONS") == std::string::npos, true);
+		CHECK_EQUAL(parser.recorder.output.find("\th\thelp\tPrints help for the command.\r\n") != std::string::npos, true);
+
+		parser.recorder.output.clear();
+		parser.rxController.Run("verbose -h");
+		size_t helpPos = parser.recorder.output.find("\th\thelp\t");
+		size_t verbosePos = parser.recorder.output.find("\tv\tverbose\t");
+		CHECK_EQUAL(helpPos != std::string::npos, true);
+		CHECK_EQUAL(verbosePos != std::string::npos, true);
+		CHECK_EQUAL(helpPos < verbosePos, true);
+	}
+
+} // namespace MClideTest
@@ -0,0 +1,146 @@
+//!
+//! @file 			CmdBindTests.cpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! @created		2026-10-17
+//! @last-modified 	2026-10-17
+//! @brief 			Contains test functions for commands bound to plain functions with Comm::Bind().
+//! @details
+//!					See README.rst in root dir for more info.
+
+//===== SYSTEM LIBRARIES =====//
+#include <stdio.h>
+#include <string>
+
+//====== USER LIBRARIES =====//
+#include "MUnitTest/api/MUnitTestApi.hpp"
+
+//===== USER SOURCE =====//
+#include "../api/MClideApi.hpp"
+
+using namespace MbeddedNinja::MClideNs;
+
+namespace MClideTest
+{
+
+	static uint32_t _numBoundCalls = 0;
+	static int32_t _boundSpeed = 0;
+	static bool _boundRamp = false;
+	static uint32_t _boundChannel = 0;
+	static int64_t _boundOffset = 0;
+	static float _boundGain = 0.0f;
+	static std::string _boundName;
+
+	//! @brief		Bound to "set-speed".
+	static void BoundSetSpeed(int32_t speed, bool ramp)
+	{
+		_numBoundCalls++;
+		_boundSpeed = speed;
+		_boundRamp = ramp;
+	}
+
+	//! @brief		Bound to "config", with one argument of every other supported type. The return value is ignored.
+	static bool BoundConfig(uint32_t channel, int64_t offset, float gain, const char* name)
+	{
+		_numBoundCalls++;
+		_boundChannel = channel;
+		_boundOffset = offset;
+		_boundGain = gain;
+		_boundName = name;
+		return false;
+	}
+
+	//! @brief		Bound to "reset", which has no parameters.
+	static void BoundReset()
+	{
+		_numBoundCalls++;
+	}
+
+	//! @brief		Collects the command-line output.
+	class BindRecorder
+	{
+		public:
+		void CmdLine(const char* msg)
+		{
+			this->output += msg;
+		}
+
+		std::string output;
+	};
+
+	MTEST(CmdBindCallTest)
+	{
+		Rx rxController;
+		Cmd* cmdSetSpeed = rxController.Bind("set-speed", &BoundSetSpeed, "Sets the speed.");
+		Cmd* cmdConfig = rxController.Bind("config", &BoundConfig, "Configures a channel.");
+		Cmd* cmdReset = rxController.Bind("reset", &BoundReset, "Resets.");
+
+		// A parameter for each argument, typed from the signature
+		CHECK_EQUAL(cmdSetSpeed != NULL, true);
+		CHECK_EQUAL(cmdSetSpeed->paramA.Size(), 2);
+		CHECK_EQUAL(cmdSetSpeed->paramA[0]->valueSpec.type == ValueType::INT32, true);
+		CHECK_EQUAL(cmdSetSpeed->paramA[1]->valueSpec.type == ValueType::BOOL, true);
+		CHECK_EQUAL(cmdConfig->paramA.Size(), 4);
+		CHECK_EQUAL(cmdConfig->paramA[3]->valueSpec.type == ValueType::STRING, true);
+		CHECK_EQUAL(cmdReset->paramA.Size(), 0);
+
+		_numBoundCalls = 0;
+		CHECK_EQUAL(rxController.Run("set-speed 1200 true"), true);
+		CHECK_EQUAL(_numBoundCalls, 1);
+		CHECK_EQUAL(_boundSpeed, 1200);
+		CHECK_EQUAL(_boundRamp, true);
+
+		CHECK_EQUAL(rxController.Run("config 0x0F 5000000000 0.25 left"), true);
+		CHECK_EQUAL(_numBoundCalls, 2);
+		CHECK_EQUAL(_boundChannel, 15);
+		CHECK_EQUAL(_boundOffset == 5000000000LL, true);
+		CHECK_EQUAL(_boundGain == 0.25f, true);
+		CHECK_EQUAL(_boundName == "left", true);
+
+		CHECK_EQUAL(rxController.Run("reset"), true);
+		CHECK_EQUAL(_numBoundCalls, 3);
+	}
+
+	MTEST(CmdBindRejectTest)
+	{
+		Rx rxController;
+		BindRecorder recorder;
+		rxController.printSink.cmdLinePrintCallback =
+			MCallbacks::CallbackGen<BindRecorder, void, const char*>(&recorder, &BindRecorder::CmdLine);
+		Cmd* cmdSetSpeed = rxController.Bind("set-speed", &BoundSetSpeed, "Sets the speed.");
+
+		// The range can be narrowed after binding
+		cmdSetSpeed->paramA[0]->valueSpec = ValueSpec::Int32(0, 5000);
+
+		_numBoundCalls = 0;
+		CHECK_EQUAL(rxController.Run("set-speed 6000 true"), false);
+		CHECK_EQUAL(rxController.Run("set-speed 100 maybe"), false);
+		CHECK_EQUAL(_numBoundCalls, 0);
+		CHECK_EQUAL(recorder.output.find("error \"Param 1 value '6000' is out of range (0 to 5000).\"") != std::string::npos, true);
+		CHECK_EQUAL(recorder.output.find("Param 2 value 'maybe'") != std::string::npos, true);
+
+		CHECK_EQUAL(rxController.Run("set-speed 5000 off"), true);
+		CHECK_EQUAL(_numBoundCalls, 1);
+		CHECK_EQUAL(_boundRamp, false);
+	}
+
+	MTEST(CmdBindFrozenTest)
+	{
+		bool enableErrorPrinting = Print::enableErrorPrinting;
+		Print::enableErrorPrinting = false;
+
+		Rx rxController;
+		CHECK_EQUAL(rxController.Bind("set-speed", &BoundSetSpeed, "Sets the speed.") != NULL, true);
+		rxController.Freeze();
+
+		CHECK_EQUAL(rxController.Bind("reset", &BoundReset, "Resets.") == NULL, true);
+
+		// Bound commands work once frozen, since they only read the ParseResult
+		_numBoundCalls = 0;
+		CHECK_EQUAL(rxController.Run("set-speed 42 no"), true);
+		CHECK_EQUAL(_numBoundCalls, 1);
+		CHECK_EQUAL(_boundSpeed, 42);
+
+		Print::enableErrorPrinting = enableErrorPrinting;
+	}
+
+} // namespace MClideTest
@@ -0,0 +1,177 @@
+//!
+//! @file 			CmdGroupTests.cpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! @created		2026-10-17
+//! @last-modified 	2026-10-17
+//! @brief 			Contains test functions for command group IDs, Cmd::IsInGroup(), Cmd::IsInGroupId() and the group-to-commands index.
+//! @details
+//!					See README.rst in root dir for more info.
+
+//===== SYSTEM LIBRARIES =====//
+#include <stdio.h>
+#include <string>
+
+//====== USER LIBRARIES =====//
+#include "MUnitTest/api/MUnitTestApi.hpp"
+
+//===== USER SOURCE =====//
+#include "../api/MClideApi.hpp"
+
+using namespace MbeddedNinja::MClideNs;
+
+namespace MClideTest
+{
+
+	//! @brief		Collects the command-line output.
+	class GroupRecorder
+	{
+		public:
+		void CmdLine(const char* msg)
+		{
+			this->output += msg;
+		}
+
+		std::string output;
+	};
+
+	//! @brief		Owns an Rx with three commands and two groups.
+	class CmdGroupParser
+	{
+		public:
+
+		Rx rxController;
+		Cmd cmdAlpha;
+		Cmd cmdBeta;
+		Cmd cmdGamma;
+		CmdGroup cmdGroupUser;
+		CmdGroup cmdGroupDev;
+		GroupRecorder recorder;
+
+		CmdGroupParser() :
+			cmdAlpha("alpha", NULL, "The first command."),
+			cmdBeta("beta", NULL, "The second command."),
+			cmdGamma("gamma", NULL, "The third command."),
+			cmdGroupUser("user", "User commands."),
+			cmdGroupDev("dev", "Developer commands.")
+		{
+			// Added to a group before being registered
+			this->cmdBeta.AddToGroup(&this->cmdGroupDev);
+
+			this->rxController.RegisterCmd(&this->cmdAlpha);
+			this->rxController.RegisterCmd(&this->cmdBeta);
+			this->rxController.RegisterCmd(&this->cmdGamma);
+
+			// Added to a group after being registered, and out of order
+			this->cmdGamma.AddToGroup(&this->cmdGroupUser);
+			this->cmdAlpha.AddToGroup(&this->cmdGroupUser);
+
+			this->rxController.printSink.cmdLinePrintCallback =
+				MCallbacks::CallbackGen<GroupRecorder, void, const char*>(&this->recorder, &GroupRecorder::CmdLine);
+		}
+	};
+
+	MTEST(CmdGroupIsInGroupTest)
+	{
+		CmdGroupParser parser;
+
+		CHECK_EQUAL(parser.cmdAlpha.IsInGroup(&parser.cmdGroupUser), true);
+		CHECK_EQUAL(parser.cmdAlpha.IsInGroup(&parser.cmdGroupDev), false);
+		CHECK_EQUAL(parser.cmdBeta.IsInGroup(&parser.cmdGroupDev), true);
+		CHECK_EQUAL(parser.cmdBeta.IsInGroup(parser.rxController.cmdGroupAll), true);
+
+		// By ID
+		CHECK_EQUAL(parser.rxController.FindCmdGroupId("all"), 0);
+		uint32_t userGroupId = parser.rxController.FindCmdGroupId("user");
+		CHECK_EQUAL(userGroupId != HashIndex::NOT_FOUND, true);
+		CHECK_EQUAL(parser.cmdGamma.IsInGroupId(userGroupId), true);
+		CHECK_EQUAL(parser.cmdBeta.IsInGroupId(userGroupId), false);
+
+		// Groups no command is in have no ID
+		CmdGroup cmdGroupUnused("unused", "Not used.");
+		CHECK_EQUAL(parser.rxController.FindCmdGroupId("unused"), HashIndex::NOT_FOUND);
+		CHECK_EQUAL(parser.cmdAlpha.IsInGroup(&cmdGroupUnused), false);
+		CHECK_EQUAL(parser.cmdAlpha.IsInGroupId(HashIndex::NOT_FOUND), false);
+
+		// Not registered
+		Cmd cmdDelta("delta", NULL, "Not registered.");
+		cmdDelta.AddToGroup(&parser.cmdGroupUser);
+		CHECK_EQUAL(cmdDelta.IsInGroup(&parser.cmdGroupUser), true);
+		CHECK_EQUAL(cmdDelta.IsInGroup(&parser.cmdGroupDev), false);
+		CHECK_EQUAL(cmdDelta.IsInGroupId(userGroupId), false);
+	}
+
+	MTEST(CmdGroupIndexTest)
+	{
+		CmdGroupParser parser;
+
+		// Listed in the order the commands were registered
+		uint32_t userGroupId = parser.rxController.FindCmdGroupId("user");
+		CHECK_EQUAL(parser.rxController.GetNumCmdsInGroup(userGroupId), 2);
+		CHECK_EQUAL(parser.rxController.GetCmdInGroup(userGroupId, 0) == &parser.cmdAlpha, true);
+		CHECK_EQUAL(parser.rxController.GetCmdInGroup(userGroupId, 1) == &parser.cmdGamma, true);
+
+		// Adding a command to the same group again, or to another group with the same name, changes nothing
+		CmdGroup cmdGroupUser2("user", "Also user commands.");
+		parser.cmdAlpha.AddToGroup(&parser.cmdGroupUser);
+		parser.cmdAlpha.AddToGroup(&cmdGroupUser2);
+		CHECK_EQUAL(parser.rxController.GetNumCmdsInGroup(userGroupId), 2);
+		CHECK_EQUAL(parser.cmdAlpha.IsInGroup(&cmdGroupUser2), true);
+
+		parser.rxController.Run("help -g user");
+		std::string output = parser.recorder.output;
+		size_t alphaPos = output.find("alpha");
+		size_t gammaPos = output.find("gamma");
+		CHECK_EQUAL(alphaPos != std::string::npos, true);
+		CHECK_EQUAL(gammaPos != std::string::npos, true);
+		CHECK_EQUAL(alphaPos < gammaPos, true);
+		CHECK_EQUAL(output.find("beta") == std::string::npos, true);
+		CHECK_EQUAL(output.find("alpha", alphaPos + 1) == std::string::npos, true);
+
+		// A group no command is in lists nothing
+		parser.recorder.output.clear();
+		parser.rxController.Run("help -g nothing");
+		CHECK_EQUAL(parser.recorder.output.find("alpha") == std::string::npos, true);
+		CHECK_EQUAL(parser.recorder.output.find("help") == std::string::npos, true);
+	}
+
+	MTEST(CmdGroupManyGroupsTest)
+	{
+		// More groups than fit in one word of the bitset
+		const uint32_t numGroups = 70;
+		Rx rxController;
+		Cmd cmdEven("even", NULL, "In the even groups.");
+		rxController.RegisterCmd(&cmdEven);
+
+		CmdGroup* cmdGroupA[numGroups];
+		char name[20];
+		for(uint32_t x = 0; x < numGroups; x++)
+		{
+			snprintf(name, sizeof(name), "group%02u", (unsigned int)x);
+			cmdGroupA[x] = new CmdGroup(name, "A test group.");
+			if(x % 2 == 0)
+				cmdEven.AddToGroup(cmdGroupA[x]);
+		}
+
+		for(uint32_t x = 0; x < numGroups; x++)
+			CHECK_EQUAL(cmdEven.IsInGroup(cmdGroupA[x]), x % 2 == 0);
+
+		for(uint32_t x = 0; x < numGroups; x++)
+			delete cmdGroupA[x];
+	}
+
+	MTEST(CmdGroupFrozenTest)
+	{
+		bool enableErrorPrinting = Print::enableErrorPrinting;
+		Print::enableErrorPrinting = false;
+
+		CmdGroupParser parser;
+		parser.rxController.Freeze();
+
+		parser.cmdBeta.AddToGroup(&parser.cmdGroupUser);
+		CHECK_EQUAL(parser.cmdBeta.IsInGroup(&parser.cmdGroupUser), false);
+		CHECK_EQUAL(parser.cmdBeta.GetNumCmdGroups(), 2);
+
+		Print::enableErrorPrinting = enableErrorPrinting;
+	}
+
+} // namespace MClideTest
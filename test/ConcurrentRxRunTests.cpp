@@ -0,0 +1,182 @@
+//!
+//! @file 			ConcurrentRxRunTests.cpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! @created		2026-10-16
+//! @last-modified 	2026-10-16
+//! @brief 			Stress test which runs many Rx objects on separate threads at the same time.
+//! @details
+//!					See README.rst in root dir for more info.
+
+//===== SYSTEM LIBRARIES =====//
+#include <stdio.h>
+#include <string.h>
+#include <thread>
+#include <vector>
+
+//====== USER LIBRARIES =====//
+#include "MUnitTest/api/MUnitTestApi.hpp"
+
+//===== USER SOURCE =====//
+#include "../api/MClideApi.hpp"
+
+using namespace MbeddedNinja::MClideNs;
+
+namespace MClideTest
+{
+
+	static bool Callback(Cmd *cmd)
+	{
+		return true;
+	}
+
+	//! @brief		Messages parsed by every thread. Covers short and long options, option values,
+	//!				quoted parameters, parameter count errors and unrecognised commands.
+	static const char* concurrentMsgA[] =
+	{
+		"test1 param1 -a",
+		"test1 -b optVal param2",
+		"test1 --alpha --bravo \"quoted val\" param3",
+		"test2 p1 p2",
+		"test2 --charlie=longVal p3 p4",
+		"test2 p5",
+		"test1 param4 -a -b val",
+		"test3",
+		"test2 \"-1.5\" \"-2\"",
+		"  test1 lastParam",
+	};
+
+	static const uint32_t numConcurrentMsgs = sizeof(concurrentMsgA)/sizeof(concurrentMsgA[0]);
+
+	//! @brief		Owns its own Rx and commands, so that each thread has no shared state.
+	class ConcurrentParser
+	{
+		public:
+
+		Rx rxController;
+
+		Cmd cmd1;
+		Param cmd1Param;
+		Option cmd1OptionA;
+		Option cmd1OptionB;
+
+		Cmd cmd2;
+		Param cmd2Param1;
+		Param cmd2Param2;
+		Option cmd2OptionC;
+
+		ConcurrentParser() :
+			cmd1("test1", &Callback, "Test command 1."),
+			cmd1Param("A test parameter."),
+			cmd1OptionA('a', "alpha", NULL, "A test option.", false),
+			cmd1OptionB('b', "bravo", NULL, "A test option with a value.", true),
+			cmd2("test2", &Callback, "Test command 2."),
+			cmd2Param1("A test parameter."),
+			cmd2Param2("A test parameter."),
+			cmd2OptionC('c', "charlie", NULL, "A test option with a value.", true)
+		{
+			this->cmd1.RegisterParam(&this->cmd1Param);
+			this->cmd1.RegisterOption(&this->cmd1OptionA);
+			this->cmd1.RegisterOption(&this->cmd1OptionB);
+			this->rxController.RegisterCmd(&this->cmd1);
+
+			this->cmd2.RegisterParam(&this->cmd2Param1);
+			this->cmd2.RegisterParam(&this->cmd2Param2);
+			this->cmd2.RegisterOption(&this->cmd2OptionC);
+			this->rxController.RegisterCmd(&this->cmd2);
+		}
+
+		//! @brief		Parses a message and writes everything that was detected into result.
+		void Parse(const char* msg, char* result, size_t resultSize)
+		{
+			char msgCpy[100];
+			strncpy(msgCpy, msg, sizeof(msgCpy) - 1);
+			msgCpy[sizeof(msgCpy) - 1] = '\0';
+
+			bool success = this->rxController.Run(msgCpy);
+
+			snprintf(
+				result,
+				resultSize,
+				"%d|%d:%s:%d:%d:%s|%d:%s:%s:%d:%s",
+				success,
+				this->cmd1.IsDetected(),
+				this->cmd1Param.value.cStr,
+				this->cmd1OptionA.IsDetected(),
+				this->cmd1OptionB.IsDetected(),
+				this->cmd1OptionB.value.cStr,
+				this->cmd2.IsDetected(),
+				this->cmd2Param1.value.cStr,
+				this->cmd2Param2.value.cStr,
+				this->cmd2OptionC.IsDetected(),
+				this->cmd2OptionC.value.cStr);
+		}
+	};
+
+	MTEST(ConcurrentRxRunMatchesSingleThreadedTest)
+	{
+		const uint32_t numThreads = 8;
+		const uint32_t numIterations = 500;
+		const size_t resultSize = 200;
+
+		// Don't let the printing callbacks slow the test down
+		bool enableCmdLinePrinting = Print::enableCmdLinePrinting;
+		bool enableErrorPrinting = Print::enableErrorPrinting;
+		bool enableDebugInfoPrinting = Print::enableDebugInfoPrinting;
+		Print::enableCmdLinePrinting = false;
+		Print::enableErrorPrinting = false;
+		Print::enableDebugInfoPrinting = false;
+
+		// Work out the expected results with a single thread. Parameter and option values carry over
+		// between messages, so the first pass over the messages starts from a different state to all
+		// of the passes after it, which all give the same results.
+		char expectedA[2][numConcurrentMsgs][resultSize];
+		char thirdPassA[numConcurrentMsgs][resultSize];
+		{
+			ConcurrentParser parser;
+			for(uint32_t x = 0; x < numConcurrentMsgs; x++)
+				parser.Parse(concurrentMsgA[x], expectedA[0][x], resultSize);
+			for(uint32_t x = 0; x < numConcurrentMsgs; x++)
+				parser.Parse(concurrentMsgA[x], expectedA[1][x], resultSize);
+			for(uint32_t x = 0; x < numConcurrentMsgs; x++)
+				parser.Parse(concurrentMsgA[x], thirdPassA[x], resultSize);
+		}
+
+		// Every thread parses the same messages with its own parser, many times over
+		uint32_t numMismatchesA[numThreads] = {0};
+		std::vector<std::thread> threadA;
+		for(uint32_t t = 0; t < numThreads; t++)
+		{
+			threadA.push_back(std::thread([&expectedA, &numMismatchesA, t, numIterations, resultSize]()
+			{
+				ConcurrentParser parser;
+				char result[resultSize];
+				for(uint32_t i = 0; i < numIterations; i++)
+				{
+					for(uint32_t x = 0; x < numConcurrentMsgs; x++)
+					{
+						parser.Parse(concurrentMsgA[x], result, resultSize);
+						if(strcmp(result, expectedA[(i == 0) ? 0 : 1][x]) != 0)
+							numMismatchesA[t]++;
+					}
+				}
+			}));
+		}
+
+		for(uint32_t t = 0; t < numThreads; t++)
+			threadA[t].join();
+
+		Print::enableCmdLinePrinting = enableCmdLinePrinting;
+		Print::enableErrorPrinting = enableErrorPrinting;
+		Print::enableDebugInfoPrinting = enableDebugInfoPrinting;
+
+		for(uint32_t t = 0; t < numThreads; t++)
+			CHECK_EQUAL(numMismatchesA[t], 0);
+
+		// Sanity check the expected results themselves
+		for(uint32_t x = 0; x < numConcurrentMsgs; x++)
+			CHECK_EQUAL(strcmp(thirdPassA[x], expectedA[1][x]), 0);
+		CHECK_EQUAL(strncmp(expectedA[0][0], "1|1:param1:1:0", 14), 0);
+		CHECK_EQUAL(strncmp(expectedA[0][7], "0|0", 3), 0);
+	}
+
+} // namespace MClideTest
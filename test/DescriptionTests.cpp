@@ -2,7 +2,7 @@
 //! @file 			DscriptionTests.cpp
 //! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
 //! @created		2014-01-24
-//! @last-modified 	2014-10-07
+//! @last-modified 	2026-10-16
 //! @brief 			Contains test functions for Clide command, parameter and option descriptions.
 //! @details
 //!					See README.rst in root dir for more info.
@@ -152,7 +152,7 @@ namespace MClideTest
 
 		CHECK_EQUAL(callbackCalled, true);
 		// Even though description is empty, option should still be recognised
-		CHECK_EQUAL(cmdTestOption.isDetected, true);
+		CHECK_EQUAL(cmdTestOption.IsDetected(), true);
 	}
 
 } // namespace MClideTest
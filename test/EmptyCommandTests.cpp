@@ -2,7 +2,7 @@
 //! @file 			EmptyCommandTests.cpp
 //! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
 //! @created		2013-07-04
-//! @last-modified 	2014-10-07
+//! @last-modified 	2026-10-16
 //! @brief 			Contains test functions for MClide command options with negative numbers.
 //! @details
 //!					See README.rst in root dir for more info.
@@ -45,7 +45,7 @@ namespace MClideTest
 		// Run rx controller
 		rxController.Run(rxBuff1);
 
-		CHECK_EQUAL(testOption.isDetected, false);
+		CHECK_EQUAL(testOption.IsDetected(), false);
 
 		// Create fake input buffer
 		char rxBuff2[50] = "test";
@@ -53,7 +53,7 @@ namespace MClideTest
 		// Run rx controller
 		rxController.Run(rxBuff2);
 
-		CHECK_EQUAL(testOption.isDetected, false);
+		CHECK_EQUAL(testOption.IsDetected(), false);
 	}
 
 } // namespace MClideTest
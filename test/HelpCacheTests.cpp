@@ -0,0 +1,187 @@
+//!
+//! @file 			HelpCacheTests.cpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! @created		2026-10-16
+//! @last-modified 	2026-10-16
+//! @brief 			Contains test functions for the help cache (rendered help is reused until something changes).
+//! @details
+//!					See README.rst in root dir for more info.
+
+//===== SYSTEM LIBRARIES =====//
+#include <stdio.h>
+#include <string>
+
+//====== USER LIBRARIES =====//
+#include "MUnitTest/api/MUnitTestApi.hpp"
+
+//===== USER SOURCE =====//
+#include "../api/MClideApi.hpp"
+
+using namespace MbeddedNinja::MClideNs;
+
+namespace MClideTest
+{
+
+	//! @brief		Collects the command-line output, and counts the calls.
+	class HelpRecorder
+	{
+		public:
+		void CmdLine(const char* msg)
+		{
+			this->output += msg;
+			this->numCalls++;
+		}
+
+		void Clear()
+		{
+			this->output.clear();
+			this->numCalls = 0;
+		}
+
+		std::string output;
+		uint32_t numCalls = 0;
+	};
+
+	//! @brief		Owns an Rx with two commands, one of them in a group, whose output goes to a recorder.
+	class HelpCacheParser
+	{
+		public:
+
+		Rx rxController;
+		Cmd cmdAlpha;
+		Cmd cmdBeta;
+		CmdGroup cmdGroupTools;
+		HelpRecorder recorder;
+
+		HelpCacheParser() :
+			cmdAlpha("alpha", NULL, "The first command."),
+			cmdBeta("beta", NULL, "The second command."),
+			cmdGroupTools("tools", "Tool commands.")
+		{
+			this->rxController.RegisterCmd(&this->cmdAlpha);
+			this->rxController.RegisterCmd(&this->cmdBeta);
+			this->cmdBeta.AddToGroup(&this->cmdGroupTools);
+			this->rxController.printSink.cmdLinePrintCallback =
+				MCallbacks::CallbackGen<HelpRecorder, void, const char*>(&this->recorder, &HelpRecorder::CmdLine);
+		}
+	};
+
+	MTEST(HelpCacheRepeatTest)
+	{
+		HelpCacheParser parser;
+
+		parser.rxController.Run("help");
+		std::string firstOutput = parser.recorder.output;
+		CHECK_EQUAL(firstOutput.find("alpha") != std::string::npos, true);
+		CHECK_EQUAL(firstOutput.find("beta") != std::string::npos, true);
+
+		// The whole listing is printed in one go, and is the same every time
+		parser.recorder.Clear();
+		parser.rxController.Run("help");
+		CHECK_EQUAL(parser.recorder.numCalls, 1);
+		CHECK_EQUAL(parser.recorder.output == firstOutput, true);
+
+		// Each group is cached separately
+		parser.recorder.Clear();
+		parser.rxController.Run("help -g tools");
+		CHECK_EQUAL(parser.recorder.numCalls, 1);
+		CHECK_EQUAL(parser.recorder.output.find("alpha") == std::string::npos, true);
+		CHECK_EQUAL(parser.recorder.output.find("beta") != std::string::npos, true);
+
+		// Same for the help for one command
+		parser.recorder.Clear();
+		parser.rxController.Run("alpha -h");
+		std::string cmdHelpOutput = parser.recorder.output;
+		CHECK_EQUAL(cmdHelpOutput.find("The first command.") != std::string::npos, true);
+		parser.recorder.Clear();
+		parser.rxController.Run("alpha -h");
+		CHECK_EQUAL(parser.recorder.numCalls, 1);
+		CHECK_EQUAL(parser.recorder.output == cmdHelpOutput, true);
+	}
+
+	MTEST(HelpCacheInvalidationTest)
+	{
+		HelpCacheParser parser;
+		parser.rxController.Run("help");
+		parser.rxController.Run("help -g tools");
+		parser.rxController.Run("alpha -h");
+
+		// New commands show up
+		Cmd cmdGamma("gamma", NULL, "The third command.");
+		parser.rxController.RegisterCmd(&cmdGamma);
+		parser.recorder.Clear();
+		parser.rxController.Run("help");
+		CHECK_EQUAL(parser.recorder.output.find("gamma") != std::string::npos, true);
+
+		// So do changes to groups
+		cmdGamma.AddToGroup(&parser.cmdGroupTools);
+		parser.recorder.Clear();
+		parser.rxController.Run("help -g tools");
+		CHECK_EQUAL(parser.recorder.output.find("gamma") != std::string::npos, true);
+
+		// And new options and parameters
+		Option optionVerbose('v', "verbose", NULL, "Verbose output.", false);
+		parser.cmdAlpha.RegisterOption(&optionVerbose);
+		Param paramFile("The file.");
+		parser.cmdAlpha.RegisterParam(&paramFile);
+		parser.recorder.Clear();
+		parser.rxController.Run("alpha -h");
+		CHECK_EQUAL(parser.recorder.output.find("verbose") != std::string::npos, true);
+		CHECK_EQUAL(parser.recorder.output.find("The file.") != std::string::npos, true);
+
+		// And changes to the config
+		parser.rxController.config.enableAdvTextFormatting = true;
+		parser.recorder.Clear();
+		parser.rxController.Run("help");
+		CHECK_EQUAL(parser.recorder.output.find(clide_TERM_TEXT_FORMAT_BOLD) != std::string::npos, true);
+		parser.rxController.config.enableAdvTextFormatting = false;
+		parser.recorder.Clear();
+		parser.rxController.Run("help");
+		CHECK_EQUAL(parser.recorder.output.find(clide_TERM_TEXT_FORMAT_BOLD) == std::string::npos, true);
+
+		// Descriptions can be changed directly, which needs an explicit invalidation
+		parser.cmdBeta.description = "Changed.";
+		parser.rxController.InvalidateHelpCache();
+		parser.recorder.Clear();
+		parser.rxController.Run("help");
+		CHECK_EQUAL(parser.recorder.output.find("Changed.") != std::string::npos, true);
+	}
+
+	MTEST(HelpCacheDisabledOutputTest)
+	{
+		// Help asked for while command-line output is off must not leave an empty entry in the cache
+		HelpCacheParser parser;
+		parser.rxController.printSink.enableCmdLinePrinting = false;
+		parser.rxController.Run("help");
+		CHECK_EQUAL(parser.recorder.output.empty(), true);
+
+		parser.rxController.printSink.enableCmdLinePrinting = true;
+		parser.rxController.Run("help");
+		CHECK_EQUAL(parser.recorder.output.find("alpha") != std::string::npos, true);
+	}
+
+	MTEST(HelpCacheFrozenTest)
+	{
+		HelpCacheParser parser;
+		parser.rxController.Freeze();
+
+		// The plain listing is rendered by Freeze()
+		parser.rxController.Run("help");
+		CHECK_EQUAL(parser.recorder.numCalls, 1);
+		CHECK_EQUAL(parser.recorder.output.find("beta") != std::string::npos, true);
+
+		// Anything else is not cached once frozen, but is still printed
+		parser.recorder.Clear();
+		parser.rxController.Run("help -g tools");
+		CHECK_EQUAL(parser.recorder.numCalls > 1, true);
+		CHECK_EQUAL(parser.recorder.output.find("beta") != std::string::npos, true);
+		CHECK_EQUAL(parser.recorder.output.find("alpha") == std::string::npos, true);
+
+		// Nor is the cache used with a different config
+		parser.rxController.config.enableAdvTextFormatting = true;
+		parser.recorder.Clear();
+		parser.rxController.Run("help");
+		CHECK_EQUAL(parser.recorder.output.find(clide_TERM_TEXT_FORMAT_BOLD) != std::string::npos, true);
+	}
+
+} // namespace MClideTest
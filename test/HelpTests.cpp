@@ -2,13 +2,13 @@
 //! @file 			HelpTests.cpp
 //! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
 //! @created		2014-01-07
-//! @last-modified 	2014-10-07
+//! @last-modified 	2026-10-16
 //! @brief 			Contains test functions for MClide help.
 //! @details
 //!					See README.rst in root dir for more info.
 
 //===== SYSTEM LIBRARIES =====//
-// none
+#include <string>
 
 //====== USER LIBRARIES =====//
 #include "MUnitTest/api/MUnitTestApi.hpp"
@@ -26,6 +26,18 @@ namespace MClideTest
 		return true;
 	}
 
+	//! @brief		Collects everything an Rx prints to the command-line.
+	class ConfigHelpRecorder
+	{
+		public:
+		void CmdLine(const char* msg)
+		{
+			this->output += msg;
+		}
+
+		std::string output;
+	};
+
 	MTEST(HelpNoDefaultTest)
 	{
 		Rx rxController;
@@ -114,7 +126,7 @@ namespace MClideTest
 		rxController.Run(rxBuff);
 		
 		//CHECK_EQUAL(cmdTestParam.value, "param1");
-		//CHECK_EQUAL(cmdTestOption.isDetected, true);
+		//CHECK_EQUAL(cmdTestOption.IsDetected(), true);
 	}
 
 	MTEST(HelpGroupsWithSelectionTest)
@@ -150,4 +162,44 @@ namespace MClideTest
 
 	}
 
+	MTEST(HelpWithPerRxConfigTest)
+	{
+		// Two Rx objects with different settings at the same time
+		ConfigHelpRecorder recorder1;
+		ConfigHelpRecorder recorder2;
+		Rx rxController1;
+		Rx rxController2;
+		rxController2.config.enableAdvTextFormatting = false;
+		rxController2.config.paddingBeforeCmdInHelp = 0;
+		rxController2.config.cmdPaddingForHelp = 30;
+
+		CHECK_EQUAL(rxController1.config.enableAdvTextFormatting, clide_ENABLE_ADV_TEXT_FORMATTING == 1);
+		CHECK_EQUAL(rxController1.config.cmdPaddingForHelp, config_CMD_PADDING_FOR_HELP);
+
+		Cmd cmdTest1("test", &Callback, "A test command.");
+		rxController1.RegisterCmd(&cmdTest1);
+		Cmd cmdTest2("test", &Callback, "A test command.");
+		rxController2.RegisterCmd(&cmdTest2);
+
+		rxController1.printSink.cmdLinePrintCallback =
+			MCallbacks::CallbackGen<ConfigHelpRecorder, void, const char*>(&recorder1, &ConfigHelpRecorder::CmdLine);
+		rxController2.printSink.cmdLinePrintCallback =
+			MCallbacks::CallbackGen<ConfigHelpRecorder, void, const char*>(&recorder2, &ConfigHelpRecorder::CmdLine);
+
+		CHECK_EQUAL(rxController1.Run("help"), true);
+		CHECK_EQUAL(rxController2.Run("help"), true);
+
+		// Each Rx pads the command column with its own settings
+		CHECK_EQUAL(recorder1.output.find("     cmd            description\r\n") != std::string::npos, true);
+		CHECK_EQUAL(recorder1.output.find("test           ") != std::string::npos, true);
+		CHECK_EQUAL(recorder2.output.find("\r\ncmd                           description\r\n") != std::string::npos, true);
+		CHECK_EQUAL(recorder2.output.find("\r\ntest                          A test command.\r\n") != std::string::npos, true);
+
+		// Only the first one uses escape codes
+		CHECK_EQUAL(recorder1.output.find("\x1B[") != std::string::npos, clide_ENABLE_ADV_TEXT_FORMATTING == 1);
+		CHECK_EQUAL(recorder2.output.find("\x1B["), std::string::npos);
+
+		CHECK_EQUAL(rxController2.Run("test -h"), true);
+	}
+
 } // namespace MClideTest
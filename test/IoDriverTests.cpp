@@ -0,0 +1,299 @@
+//!
+//! @file 			IoDriverTests.cpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! @created		2026-10-16
+//! @last-modified 	2026-10-16
+//! @brief 			Contains test functions for IoDriver, which runs many channels from one epoll loop.
+//! @details
+//!					See README.rst in root dir for more info.
+
+#if(defined __linux__)
+
+//===== SYSTEM LIBRARIES =====//
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <termios.h>
+#include <sys/socket.h>
+#include <chrono>
+
+//====== USER LIBRARIES =====//
+#include "MUnitTest/api/MUnitTestApi.hpp"
+
+//===== USER SOURCE =====//
+#include "../api/MClideApi.hpp"
+
+using namespace MbeddedNinja::MClideNs;
+
+namespace MClideTest
+{
+
+	static uint32_t _numIoCmds = 0;
+
+	//! @brief		Replies on the channel the command came from.
+	static bool OkCallback(Cmd *cmd)
+	{
+		_numIoCmds++;
+		cmd->parentComm->printSink.PrintToCmdLine("ok\r\n");
+		return true;
+	}
+
+	//! @brief		Replies with far more than a socket buffer holds.
+	static bool FloodCallback(Cmd *cmd)
+	{
+		char line[1024];
+		memset(line, 'x', sizeof(line) - 3);
+		strcpy(&line[sizeof(line) - 3], "\r\n");
+		for(uint32_t x = 0; x < 1024; x++)
+			cmd->parentComm->printSink.PrintToCmdLine(line);
+		return true;
+	}
+
+	//! @brief		Records which channels closed.
+	class ClosedRecorder
+	{
+		public:
+		void ChannelClosed(int fd)
+		{
+			this->lastFd = fd;
+			this->numClosed++;
+		}
+
+		int lastFd = -1;
+		uint32_t numClosed = 0;
+	};
+
+	//! @brief		Owns an Rx with the "test" command.
+	class IoParser
+	{
+		public:
+
+		Rx rxController;
+		Cmd cmdTest;
+
+		IoParser() :
+			cmdTest("test", &OkCallback, "A test command.")
+		{
+			this->rxController.RegisterCmd(&this->cmdTest);
+			this->rxController.Freeze();
+			_numIoCmds = 0;
+		}
+	};
+
+	//! @brief		Opens a pseudo-terminal, with the slave in raw mode (no echo, no character translation).
+	//! @returns	false if one could not be opened.
+	static bool OpenPty(int* masterFd, int* slaveFd)
+	{
+		*masterFd = posix_openpt(O_RDWR | O_NOCTTY);
+		if(*masterFd < 0)
+			return false;
+
+		if((grantpt(*masterFd) != 0) || (unlockpt(*masterFd) != 0))
+		{
+			close(*masterFd);
+			return false;
+		}
+
+		*slaveFd = open(ptsname(*masterFd), O_RDWR | O_NOCTTY);
+		if(*slaveFd < 0)
+		{
+			close(*masterFd);
+			return false;
+		}
+
+		struct termios settings;
+		tcgetattr(*slaveFd, &settings);
+		cfmakeraw(&settings);
+		tcsetattr(*slaveFd, TCSANOW, &settings);
+
+		fcntl(*masterFd, F_SETFL, fcntl(*masterFd, F_GETFL) | O_NONBLOCK);
+		return true;
+	}
+
+	MTEST(IoDriverSocketTest)
+	{
+		bool enableCmdLinePrinting = Print::enableCmdLinePrinting;
+		Print::enableCmdLinePrinting = true;
+
+		IoParser parser;
+		RxBuff rxBuff(&parser.rxController, '\n');
+		IoDriver ioDriver;
+		ClosedRecorder recorder;
+		ioDriver.channelClosedCallback =
+			MCallbacks::CallbackGen<ClosedRecorder, void, int>(&recorder, &ClosedRecorder::ChannelClosed);
+
+		int fdA[2];
+		CHECK_EQUAL(socketpair(AF_UNIX, SOCK_STREAM, 0, fdA), 0);
+
+		CHECK_EQUAL(ioDriver.AddChannel(fdA[1], &rxBuff), true);
+		CHECK_EQUAL(ioDriver.AddChannel(fdA[1], &rxBuff), false);
+		CHECK_EQUAL(ioDriver.GetNumChannels(), 1);
+
+		// Nothing to read yet
+		CHECK_EQUAL(ioDriver.Poll(0), 0);
+
+		// The reply goes back to the same file descriptor
+		CHECK_EQUAL(write(fdA[0], "test\ntes", 8), 8);
+		CHECK_EQUAL(ioDriver.Poll(1000), 1);
+		CHECK_EQUAL(write(fdA[0], "t\n", 2), 2);
+		CHECK_EQUAL(ioDriver.Poll(1000), 1);
+		CHECK_EQUAL(_numIoCmds, 2);
+
+		char reply[20] = {0};
+		CHECK_EQUAL(read(fdA[0], reply, sizeof(reply) - 1), 8);
+		CHECK_EQUAL(strcmp(reply, "ok\r\nok\r\n"), 0);
+
+		// Closing the other end removes the channel
+		close(fdA[0]);
+		CHECK_EQUAL(ioDriver.Poll(1000), 1);
+		CHECK_EQUAL(ioDriver.GetNumChannels(), 0);
+		CHECK_EQUAL(recorder.numClosed, 1);
+		CHECK_EQUAL(recorder.lastFd, fdA[1]);
+		close(fdA[1]);
+
+		Print::enableCmdLinePrinting = enableCmdLinePrinting;
+	}
+
+	MTEST(IoDriverStalledPeerTest)
+	{
+		bool enableCmdLinePrinting = Print::enableCmdLinePrinting;
+		Print::enableCmdLinePrinting = true;
+
+		Rx floodRxController;
+		Cmd cmdFlood("flood", &FloodCallback, "Prints 1MB.");
+		floodRxController.RegisterCmd(&cmdFlood);
+		RxBuff floodRxBuff(&floodRxController, '\n');
+
+		IoParser parser;
+		RxBuff rxBuff(&parser.rxController, '\n');
+
+		IoDriver ioDriver;
+		ClosedRecorder recorder;
+		ioDriver.channelClosedCallback =
+			MCallbacks::CallbackGen<ClosedRecorder, void, int>(&recorder, &ClosedRecorder::ChannelClosed);
+
+		int floodFdA[2];
+		int fdA[2];
+		CHECK_EQUAL(socketpair(AF_UNIX, SOCK_STREAM, 0, floodFdA), 0);
+		CHECK_EQUAL(socketpair(AF_UNIX, SOCK_STREAM, 0, fdA), 0);
+		CHECK_EQUAL(ioDriver.AddChannel(floodFdA[1], &floodRxBuff), true);
+		CHECK_EQUAL(ioDriver.AddChannel(fdA[1], &rxBuff), true);
+
+		// The peer never reads the response, so the channel is closed once a write times out
+		CHECK_EQUAL(write(floodFdA[0], "flood\n", 6), 6);
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		CHECK_EQUAL(ioDriver.Poll(1000), 1);
+		int64_t elapsedMs = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+		CHECK_EQUAL(elapsedMs < clide_IO_DRIVER_WRITE_TIMEOUT_MS + 1000, true);
+		CHECK_EQUAL(recorder.numClosed, 1);
+		CHECK_EQUAL(recorder.lastFd, floodFdA[1]);
+		CHECK_EQUAL(ioDriver.GetNumChannels(), 1);
+
+		// The other channel still works
+		CHECK_EQUAL(write(fdA[0], "test\n", 5), 5);
+		CHECK_EQUAL(ioDriver.Poll(1000), 1);
+		char reply[20] = {0};
+		CHECK_EQUAL(read(fdA[0], reply, sizeof(reply) - 1), 4);
+		CHECK_EQUAL(strcmp(reply, "ok\r\n"), 0);
+
+		close(floodFdA[0]);
+		close(floodFdA[1]);
+		close(fdA[0]);
+		close(fdA[1]);
+
+		Print::enableCmdLinePrinting = enableCmdLinePrinting;
+	}
+
+	MTEST(IoDriverManyPtysTest)
+	{
+		const uint32_t numChannels = 100;
+		const uint32_t numRounds = 50;
+		const uint32_t numCmdsPerWrite = 4;
+		const char* cmds = "test\ntest\ntest\ntest\n";
+		const uint32_t replyLen = 4;
+
+		bool enableCmdLinePrinting = Print::enableCmdLinePrinting;
+		Print::enableCmdLinePrinting = true;
+
+		IoParser parser;
+		IoDriver ioDriver;
+		int masterFdA[numChannels];
+		int slaveFdA[numChannels];
+		RxBuff* rxBuffA[numChannels];
+
+		uint32_t numOpened = 0;
+		for(; numOpened < numChannels; numOpened++)
+		{
+			if(!OpenPty(&masterFdA[numOpened], &slaveFdA[numOpened]))
+				break;
+			rxBuffA[numOpened] = new RxBuff(&parser.rxController, '\n');
+			ioDriver.AddChannel(slaveFdA[numOpened], rxBuffA[numOpened]);
+		}
+		CHECK_EQUAL(numOpened, numChannels);
+		CHECK_EQUAL(ioDriver.GetNumChannels(), numOpened);
+
+		// Every channel gets a few commands at once each round, and every reply is read back from the right channel
+		uint32_t numReplyBytesA[numChannels] = {0};
+		uint32_t numCmds = 0;
+		uint32_t numWrongReplies = 0;
+		auto start = std::chrono::steady_clock::now();
+		for(uint32_t round = 0; round < numRounds; round++)
+		{
+			for(uint32_t x = 0; x < numOpened; x++)
+			{
+				if(write(masterFdA[x], cmds, strlen(cmds)) != (ssize_t)strlen(cmds))
+					numWrongReplies++;
+			}
+			numCmds += numOpened*numCmdsPerWrite;
+
+			uint32_t numReplied = 0;
+			while(numReplied < numOpened*numCmdsPerWrite)
+			{
+				if(ioDriver.Poll(1000) <= 0)
+					break;
+
+				for(uint32_t x = 0; x < numOpened; x++)
+				{
+					char reply[100];
+					ssize_t numRead;
+					while((numRead = read(masterFdA[x], reply, sizeof(reply))) > 0)
+					{
+						for(ssize_t y = 0; y < numRead; y++)
+						{
+							if(reply[y] != "ok\r\n"[(numReplyBytesA[x] + y) % replyLen])
+								numWrongReplies++;
+						}
+						numReplyBytesA[x] += numRead;
+						numReplied += (numReplyBytesA[x]/replyLen) - ((numReplyBytesA[x] - numRead)/replyLen);
+					}
+				}
+			}
+		}
+		auto end = std::chrono::steady_clock::now();
+
+		CHECK_EQUAL(_numIoCmds, numCmds);
+		CHECK_EQUAL(numWrongReplies, 0);
+		for(uint32_t x = 0; x < numOpened; x++)
+			CHECK_EQUAL(numReplyBytesA[x], numRounds*numCmdsPerWrite*replyLen);
+
+		double seconds = std::chrono::duration<double>(end - start).count();
+		printf("IoDriverManyPtysTest: %u channels, %u commands, %.0f commands/s\n",
+			(unsigned int)numOpened, (unsigned int)numCmds, numCmds/seconds);
+
+		for(uint32_t x = 0; x < numOpened; x++)
+		{
+			ioDriver.RemoveChannel(slaveFdA[x]);
+			close(slaveFdA[x]);
+			close(masterFdA[x]);
+			delete rxBuffA[x];
+		}
+		CHECK_EQUAL(ioDriver.GetNumChannels(), 0);
+
+		Print::enableCmdLinePrinting = enableCmdLinePrinting;
+	}
+
+} // namespace MClideTest
+
+#endif	// #if(defined __linux__)
@@ -2,13 +2,14 @@
 //! @file 			IsDetectedTests.cpp
 //! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
 //! @created		2013-07-04
-//! @last-modified 	2014-10-07
-//! @brief 			Contains test functions for MClide command isDetected flag.
+//! @last-modified 	2026-10-16
+//! @brief 			Contains test functions for MClide command and option IsDetected() state.
 //! @details
 //!					See README.rst in root dir for more info.
 
 //===== SYSTEM LIBRARIES =====//
 #include <stdio.h>
+#include <stdint.h>		// UINT64_MAX
 
 //====== USER LIBRARIES =====//
 #include "MUnitTest/api/MUnitTestApi.hpp"
@@ -44,7 +45,7 @@ namespace MClideTest
 		rxController.Run(rxBuff1);
 
 		// Make sure cmd1 is true, cmd2 is false
-		CHECK_EQUAL(cmdTest1.isDetected, true);
+		CHECK_EQUAL(cmdTest1.IsDetected(), true);
 	}
 
 	MTEST(IsDetectedGetsResetTest)
@@ -66,8 +67,8 @@ namespace MClideTest
 		rxController.Run(rxBuff1);
 
 		// Make sure cmd1 is true, cmd2 is false
-		CHECK_EQUAL(cmdTest1.isDetected, true);
-		CHECK_EQUAL(cmdTest2.isDetected, false);
+		CHECK_EQUAL(cmdTest1.IsDetected(), true);
+		CHECK_EQUAL(cmdTest2.IsDetected(), false);
 
 		// Create input buffer
 		char rxBuff2[50] = "test2";
@@ -76,8 +77,8 @@ namespace MClideTest
 		rxController.Run(rxBuff2);
 
 		// Make sure cmd1 is false, cmd2 is true
-		CHECK_EQUAL(cmdTest1.isDetected, false);
-		CHECK_EQUAL(cmdTest2.isDetected, true);
+		CHECK_EQUAL(cmdTest1.IsDetected(), false);
+		CHECK_EQUAL(cmdTest2.IsDetected(), true);
 
 		// TEST ALL CMDS ARE CLEARED
 
@@ -88,8 +89,83 @@ namespace MClideTest
 		rxController.Run(rxBuff3);
 
 		// Make sure cmd1 is false, cmd2 is true
-		CHECK_EQUAL(cmdTest1.isDetected, false);
-		CHECK_EQUAL(cmdTest2.isDetected, false);
+		CHECK_EQUAL(cmdTest1.IsDetected(), false);
+		CHECK_EQUAL(cmdTest2.IsDetected(), false);
+	}
+
+	MTEST(OptionIsDetectedGetsResetTest)
+	{
+		Rx rxController;
+
+		Cmd cmdTest1("test1", &Callback1, "Test command 1.");
+		Option cmdTest1Option('a', "alpha", NULL, "Test option.", false);
+		cmdTest1.RegisterOption(&cmdTest1Option);
+
+		// Register commands
+		rxController.RegisterCmd(&cmdTest1);
+
+		char rxBuff1[50] = "test1 --alpha";
+		rxController.Run(rxBuff1);
+
+		CHECK_EQUAL(cmdTest1.IsDetected(), true);
+		CHECK_EQUAL(cmdTest1Option.IsDetected(), true);
+
+		// Same command, without the option
+		char rxBuff2[50] = "test1";
+		rxController.Run(rxBuff2);
+
+		CHECK_EQUAL(cmdTest1.IsDetected(), true);
+		CHECK_EQUAL(cmdTest1Option.IsDetected(), false);
+
+		// Option state belongs to the last time the command was received, so a different
+		// (here, unrecognised) command does not clear it
+		char rxBuff3[50] = "test1 -a";
+		rxController.Run(rxBuff3);
+
+		char rxBuff4[50] = "test3";
+		rxController.Run(rxBuff4);
+
+		CHECK_EQUAL(cmdTest1.IsDetected(), false);
+		CHECK_EQUAL(cmdTest1Option.IsDetected(), true);
+	}
+
+	MTEST(IsDetectedAfterGenerationWrapTest)
+	{
+		Rx rxController;
+
+		Cmd cmdTest1("test1", &Callback1, "Test command 1.");
+		Option cmdTest1Option('a', "alpha", NULL, "Test option.", false);
+		cmdTest1.RegisterOption(&cmdTest1Option);
+		Cmd cmdTest2("test2", &Callback1, "Test command 2.");
+
+		rxController.RegisterCmd(&cmdTest1);
+		rxController.RegisterCmd(&cmdTest2);
+
+		// Stamped with generation 1
+		char rxBuff1[50] = "test1 --alpha";
+		rxController.Run(rxBuff1);
+		CHECK_EQUAL(cmdTest1Option.IsDetected(), true);
+
+		// Skip to just before the wrap
+		rxController.parseGeneration = UINT64_MAX - 1;
+
+		char rxBuff2[50] = "test2";
+		rxController.Run(rxBuff2);
+		CHECK_EQUAL(cmdTest1.IsDetected(), false);
+		CHECK_EQUAL(cmdTest2.IsDetected(), true);
+
+		// Wraps back to generation 1, which must not bring back the stamps from the first parse
+		char rxBuff3[50] = "test3";
+		rxController.Run(rxBuff3);
+		CHECK_EQUAL(rxController.parseGeneration == 1, true);
+		CHECK_EQUAL(cmdTest1.IsDetected(), false);
+		CHECK_EQUAL(cmdTest1Option.IsDetected(), false);
+		CHECK_EQUAL(cmdTest2.IsDetected(), false);
+
+		char rxBuff4[50] = "test1";
+		rxController.Run(rxBuff4);
+		CHECK_EQUAL(cmdTest1.IsDetected(), true);
+		CHECK_EQUAL(cmdTest1Option.IsDetected(), false);
 	}
 
 } // namespace MClideTest
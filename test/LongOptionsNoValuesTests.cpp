@@ -2,7 +2,7 @@
 //! @file 			LongOptionsNoValuesTests.cpp
 //! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
 //! @created		2013-07-08
-//! @last-modified 	2014-10-07
+//! @last-modified 	2026-10-16
 //! @brief 			Contains test functions for MClide command long options with no values.
 //! @details
 //!					See README.rst in root dir for more info.
@@ -46,7 +46,7 @@ namespace MClideTest
 		// Run rx controller
 		rxController.Run(rxBuff);
 
-		CHECK_EQUAL(testOption.isDetected, true);
+		CHECK_EQUAL(testOption.IsDetected(), true);
 	}
 
 	MTEST(TwoPosLongOptionNoValuesTest)
@@ -71,8 +71,8 @@ namespace MClideTest
 		// Run rx controller
 		rxController.Run(rxBuff);
 		
-		CHECK_EQUAL(testOption1.isDetected, true);
-		CHECK_EQUAL(testOption2.isDetected, true);
+		CHECK_EQUAL(testOption1.IsDetected(), true);
+		CHECK_EQUAL(testOption2.IsDetected(), true);
 	}
 			
 	MTEST(OnePosOneNegOptionNoValuesTest)
@@ -98,8 +98,8 @@ namespace MClideTest
 		// Run rx controller
 		rxController.Run(rxBuff);
 		
-		CHECK_EQUAL(testOption1.isDetected, true);
-		CHECK_EQUAL(testOption2.isDetected, false);
+		CHECK_EQUAL(testOption1.IsDetected(), true);
+		CHECK_EQUAL(testOption2.IsDetected(), false);
 	}
 
 } // namespace MClideTest
@@ -0,0 +1,75 @@
+//!
+//! @file 			ManyOptionsTests.cpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! @created		2026-10-16
+//! @last-modified 	2026-10-16
+//! @brief 			Contains test functions for commands with more options than the old fixed-size option buffers could hold.
+//! @details
+//!					See README.rst in root dir for more info.
+
+//===== SYSTEM LIBRARIES =====//
+#include <stdio.h>
+
+//====== USER LIBRARIES =====//
+#include "MUnitTest/api/MUnitTestApi.hpp"
+
+//===== USER SOURCE =====//
+#include "../api/MClideApi.hpp"
+
+using namespace MbeddedNinja::MClideNs;
+
+namespace MClideTest
+{
+
+	static bool Callback(Cmd *cmd)
+	{
+		return true;
+	}
+
+	//! @brief		30 options with values gives a 61 char short option string and 31 long options (including help),
+	//!				which used to overflow the 50 char and 20 element buffers in Rx.
+	MTEST(ThirtyOptionsWithValuesTest)
+	{
+		const uint32_t numOptions = 30;
+
+		Rx rxController;
+
+		Cmd cmdTest("test", &Callback, "A test command.");
+
+		Option* optionA[numOptions];
+		char longName[10];
+		for(uint32_t x = 0; x < numOptions; x++)
+		{
+			char shortName = (x < 26) ? ('A' + x) : ('a' + (x - 26));
+			snprintf(longName, sizeof(longName), "opt%02u", (unsigned int)x);
+			optionA[x] = new Option(shortName, longName, NULL, "A test option.", true);
+			cmdTest.RegisterOption(optionA[x]);
+		}
+
+		rxController.RegisterCmd(&cmdTest);
+
+		// First and last options, as short options
+		char rxBuff1[50] = "test -A val1 -d val2";
+		rxController.Run(rxBuff1);
+
+		CHECK_EQUAL(optionA[0]->IsDetected(), true);
+		CHECK_EQUAL(optionA[0]->value, "val1");
+		CHECK_EQUAL(optionA[29]->IsDetected(), true);
+		CHECK_EQUAL(optionA[29]->value, "val2");
+		CHECK_EQUAL(optionA[15]->IsDetected(), false);
+
+		// Last options, as long options
+		char rxBuff2[50] = "test --opt28 val3 --opt29 val4";
+		rxController.Run(rxBuff2);
+
+		CHECK_EQUAL(optionA[0]->IsDetected(), false);
+		CHECK_EQUAL(optionA[28]->IsDetected(), true);
+		CHECK_EQUAL(optionA[28]->value, "val3");
+		CHECK_EQUAL(optionA[29]->IsDetected(), true);
+		CHECK_EQUAL(optionA[29]->value, "val4");
+
+		for(uint32_t x = 0; x < numOptions; x++)
+			delete optionA[x];
+	}
+
+} // namespace MClideTest
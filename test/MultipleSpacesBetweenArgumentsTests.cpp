@@ -2,7 +2,7 @@
 //! @file 			MultipleSpacesBetweenArgumentsTests.cpp
 //! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
 //! @created		2013-07-12
-//! @last-modified 	2014-10-07
+//! @last-modified 	2026-10-16
 //! @brief 			Contains test functions for MClide commands with multiple spaces between arguments.
 //! @details
 //!					See README.rst in root dir for more info.
@@ -52,7 +52,7 @@ namespace MClideTest
 		rxController.Run(rxBuff);
 
 		CHECK_EQUAL(cmdTestParam.value, "param1");
-		CHECK_EQUAL(cmdTestOption.isDetected, true);
+		CHECK_EQUAL(cmdTestOption.IsDetected(), true);
 	}
 
 	MTEST(MultipleSpacesBetweenArgumentsTest2)
@@ -81,7 +81,7 @@ namespace MClideTest
 		rxController.Run(rxBuff);
 
 		CHECK_EQUAL(cmdTestParam.value, "param1");
-		CHECK_EQUAL(cmdTestOption.isDetected, true);
+		CHECK_EQUAL(cmdTestOption.IsDetected(), true);
 	}
 
 	MTEST(MultipleSpacesBetweenArgumentsTest3)
@@ -117,8 +117,8 @@ namespace MClideTest
 
 		CHECK_EQUAL(cmdTestParam1.value, "param1");
 		CHECK_EQUAL(cmdTestParam2.value, "param2");
-		CHECK_EQUAL(cmdTestOption1.isDetected, true);
-		CHECK_EQUAL(cmdTestOption2.isDetected, true);
+		CHECK_EQUAL(cmdTestOption1.IsDetected(), true);
+		CHECK_EQUAL(cmdTestOption2.IsDetected(), true);
 	}
 
 	MTEST(MultipleSpacesBetweenArgumentsTest4)
@@ -154,8 +154,8 @@ namespace MClideTest
 
 		CHECK_EQUAL(cmdTestParam1.value, "param1");
 		CHECK_EQUAL(cmdTestParam2.value, "param2");
-		CHECK_EQUAL(cmdTestOption1.isDetected, true);
-		CHECK_EQUAL(cmdTestOption2.isDetected, true);
+		CHECK_EQUAL(cmdTestOption1.IsDetected(), true);
+		CHECK_EQUAL(cmdTestOption2.IsDetected(), true);
 	}
 
 	MTEST(MultipleSpacesBetweenArgumentsTest5)
@@ -191,8 +191,8 @@ namespace MClideTest
 		
 		CHECK_EQUAL(cmdTestParam1.value, "param1");
 		CHECK_EQUAL(cmdTestParam2.value, "param2");
-		CHECK_EQUAL(cmdTestOption1.isDetected, true);
-		CHECK_EQUAL(cmdTestOption2.isDetected, true);
+		CHECK_EQUAL(cmdTestOption1.IsDetected(), true);
+		CHECK_EQUAL(cmdTestOption2.IsDetected(), true);
 		
 		// Create fake input buffer
 		char rxBuff2[50] = "test    param1 param2";
@@ -202,8 +202,8 @@ namespace MClideTest
 		
 		CHECK_EQUAL(cmdTestParam1.value, "param1");
 		CHECK_EQUAL(cmdTestParam2.value, "param2");
-		CHECK_EQUAL(cmdTestOption1.isDetected, false);
-		CHECK_EQUAL(cmdTestOption2.isDetected, false);
+		CHECK_EQUAL(cmdTestOption1.IsDetected(), false);
+		CHECK_EQUAL(cmdTestOption2.IsDetected(), false);
 	}
 		
 } // namespace MClideTest
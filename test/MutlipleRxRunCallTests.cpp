@@ -2,7 +2,7 @@
 //! @file 			MultipleRxRunCallTests.cpp
 //! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
 //! @created		2013-07-04
-//! @last-modified 	2014-10-07
+//! @last-modified 	2026-10-16
 //! @brief 			Contains test functions for multiple calls to MClide::Rx.Run().
 //! @details
 //!					See README.rst in root dir for more info.
@@ -54,8 +54,8 @@ namespace MClideTest
 		rxController.Run(rxBuff1);
 
 		CHECK_EQUAL(cmdTestParam.value, "param1");
-		CHECK_EQUAL(cmdTestOption1.isDetected, true);
-		CHECK_EQUAL(cmdTestOption2.isDetected, false);
+		CHECK_EQUAL(cmdTestOption1.IsDetected(), true);
+		CHECK_EQUAL(cmdTestOption2.IsDetected(), false);
 
 		// Create fake input buffer
 		char rxBuff2[50] = "test param1 --topt";
@@ -64,8 +64,8 @@ namespace MClideTest
 		rxController.Run(rxBuff2);
 
 		CHECK_EQUAL(cmdTestParam.value, "param1");
-		CHECK_EQUAL(cmdTestOption1.isDetected, false);
-		CHECK_EQUAL(cmdTestOption2.isDetected, true);
+		CHECK_EQUAL(cmdTestOption1.IsDetected(), false);
+		CHECK_EQUAL(cmdTestOption2.IsDetected(), true);
 
 		// Create fake input buffer
 		char rxBuff3[50] = "test param1";
@@ -74,8 +74,8 @@ namespace MClideTest
 		rxController.Run(rxBuff3);
 
 		CHECK_EQUAL(cmdTestParam.value, "param1");
-		CHECK_EQUAL(cmdTestOption1.isDetected, false);
-		CHECK_EQUAL(cmdTestOption2.isDetected, false);
+		CHECK_EQUAL(cmdTestOption1.IsDetected(), false);
+		CHECK_EQUAL(cmdTestOption2.IsDetected(), false);
 
 		// Create fake input buffer
 		char rxBuff4[50] = "test --topt -a param1";
@@ -84,8 +84,8 @@ namespace MClideTest
 		rxController.Run(rxBuff4);
 		
 		CHECK_EQUAL(cmdTestParam.value, "param1");
-		CHECK_EQUAL(cmdTestOption1.isDetected, true);
-		CHECK_EQUAL(cmdTestOption2.isDetected, true);
+		CHECK_EQUAL(cmdTestOption1.IsDetected(), true);
+		CHECK_EQUAL(cmdTestOption2.IsDetected(), true);
 	}
 
 } // namespace MClideTest
@@ -2,7 +2,7 @@
 //! @file 			OptionFindByLongNameTests.cpp
 //! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
 //! @created		2014-05-16
-//! @last-modified 	2014-10-07
+//! @last-modified 	2026-10-16
 //! @brief 			Contains test functions for finding options by their long name.
 //! @details
 //!					See README.rst in root dir for more info.
@@ -51,7 +51,7 @@ namespace MClideTest
 		if(returnedOption == nullptr)
 			CHECK(false);
 		else
-			CHECK_EQUAL(returnedOption->isDetected, true);
+			CHECK_EQUAL(returnedOption->IsDetected(), true);
 	}
 
 	MTEST(TwoPosOptionFindByLongNameTest)
@@ -84,14 +84,14 @@ namespace MClideTest
 		if(returnedOption == nullptr)
 			CHECK(false);
 		else
-			CHECK_EQUAL(returnedOption->isDetected, true);
+			CHECK_EQUAL(returnedOption->IsDetected(), true);
 
 		returnedOption = cmdTest.FindOptionByLongName("optb");
 
 		if(returnedOption == nullptr)
 			CHECK(false);
 		else
-			CHECK_EQUAL(returnedOption->isDetected, true);
+			CHECK_EQUAL(returnedOption->IsDetected(), true);
 	}
 
 	MTEST(OnePosOneNegOptionFindByNameTest)
@@ -124,7 +124,7 @@ namespace MClideTest
 		if(returnedOption == nullptr)
 			CHECK(false);
 		else
-			CHECK_EQUAL(returnedOption->isDetected, true);
+			CHECK_EQUAL(returnedOption->IsDetected(), true);
 
 		returnedOption = cmdTest.FindOptionByLongName("optb");
 
@@ -132,7 +132,7 @@ namespace MClideTest
 			CHECK(false);
 		else
 			// Should of not been detected
-			CHECK_EQUAL(returnedOption->isDetected, false);
+			CHECK_EQUAL(returnedOption->IsDetected(), false);
 	}
 
 	MTEST(FindNonexistantOptionByLongNameTest)
@@ -2,7 +2,7 @@
 //! @file 			OptionFindByShortNameTests.cpp
 //! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
 //! @created		2014-05-16
-//! @last-modified 	2014-10-07
+//! @last-modified 	2026-10-16
 //! @brief 			Contains test functions for finding options by their short name.
 //! @details
 //!					See README.rst in root dir for more info.
@@ -51,7 +51,7 @@ namespace MClideTest
 		if(returnedOption == nullptr)
 			CHECK(false);
 		else
-			CHECK_EQUAL(returnedOption->isDetected, true);
+			CHECK_EQUAL(returnedOption->IsDetected(), true);
 	}
 
 	MTEST(TwoPosOptionFindByShortNameTest)
@@ -84,14 +84,14 @@ namespace MClideTest
 		if(returnedOption == nullptr)
 			CHECK(false);
 		else
-			CHECK_EQUAL(returnedOption->isDetected, true);
+			CHECK_EQUAL(returnedOption->IsDetected(), true);
 
 		returnedOption = cmdTest.FindOptionByShortName('b');
 
 		if(returnedOption == nullptr)
 			CHECK(false);
 		else
-			CHECK_EQUAL(returnedOption->isDetected, true);
+			CHECK_EQUAL(returnedOption->IsDetected(), true);
 	}
 
 	MTEST(OnePosOneNegOptionFindByShortNameTest)
@@ -124,7 +124,7 @@ namespace MClideTest
 		if(returnedOption == nullptr)
 			CHECK(false);
 		else
-			CHECK_EQUAL(returnedOption->isDetected, true);
+			CHECK_EQUAL(returnedOption->IsDetected(), true);
 
 		returnedOption = cmdTest.FindOptionByShortName('b');
 
@@ -132,7 +132,7 @@ namespace MClideTest
 			CHECK(false);
 		else
 			// Should of not been detected
-			CHECK_EQUAL(returnedOption->isDetected, false);
+			CHECK_EQUAL(returnedOption->IsDetected(), false);
 	}
 
 	MTEST(FindNonexistantOptionByShortNameTest)
@@ -0,0 +1,120 @@
+//!
+//! @file 			OptionHandleTests.cpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! @created		2026-10-17
+//! @last-modified 	2026-10-17
+//! @brief 			Contains test functions for the option handles returned by Cmd::RegisterOption(), and the indexed
+//!					option lookups by name.
+//! @details
+//!					See README.rst in root dir for more info.
+
+//===== SYSTEM LIBRARIES =====//
+#include <stdio.h>
+
+//====== USER LIBRARIES =====//
+#include "MUnitTest/api/MUnitTestApi.hpp"
+
+//===== USER SOURCE =====//
+#include "../api/MClideApi.hpp"
+
+using namespace MbeddedNinja::MClideNs;
+
+namespace MClideTest
+{
+
+	static OptionHandle _handleVerbose;
+	static OptionHandle _handleLevel;
+	static uint32_t _numHandleCalls = 0;
+	static bool _handleVerboseDetected = false;
+	static const char* _handleLevelValue = NULL;
+
+	//! @brief		Reads the options through their handles.
+	static bool OptionHandleCallback(const ParseResult& result)
+	{
+		_numHandleCalls++;
+		_handleVerboseDetected = result.IsDetected(_handleVerbose);
+		_handleLevelValue = result.GetValue(_handleLevel);
+		return true;
+	}
+
+	MTEST(OptionHandleRegisterTest)
+	{
+		Cmd cmdTest("test", NULL, "A test command.");
+		Option optionVerbose('v', "verbose", NULL, "Verbose.", false);
+		Option optionLevel('l', "level", NULL, "The level.", true);
+
+		OptionHandle handleVerbose = cmdTest.RegisterOption(&optionVerbose);
+		OptionHandle handleLevel = cmdTest.RegisterOption(&optionLevel);
+
+		CHECK_EQUAL(handleVerbose.IsValid(), true);
+		CHECK_EQUAL(handleLevel.IsValid(), true);
+		CHECK_EQUAL(handleVerbose.index != handleLevel.index, true);
+		CHECK_EQUAL(cmdTest.GetOption(handleVerbose) == &optionVerbose, true);
+		CHECK_EQUAL(cmdTest.GetOption(handleLevel) == &optionLevel, true);
+		CHECK_EQUAL(cmdTest.GetOption(OptionHandle()) == nullptr, true);
+		CHECK_EQUAL(cmdTest.GetOption(OptionHandle(100)) == nullptr, true);
+
+		// Can't register once frozen
+		bool enableErrorPrinting = Print::enableErrorPrinting;
+		Print::enableErrorPrinting = false;
+		Rx rxController;
+		rxController.RegisterCmd(&cmdTest);
+		rxController.Freeze();
+		Option optionLate('z', "late", NULL, "Too late.", false);
+		CHECK_EQUAL(cmdTest.RegisterOption(&optionLate).IsValid(), false);
+		Print::enableErrorPrinting = enableErrorPrinting;
+	}
+
+	MTEST(OptionHandleParseResultTest)
+	{
+		Rx rxController;
+		Cmd cmdTest("test", NULL, "A test command.");
+		Option optionVerbose('v', "verbose", NULL, "Verbose.", false);
+		Option optionLevel('l', "level", NULL, "The level.", true);
+		_handleVerbose = cmdTest.RegisterOption(&optionVerbose);
+		_handleLevel = cmdTest.RegisterOption(&optionLevel);
+		cmdTest.resultFunctionCallback = &OptionHandleCallback;
+		rxController.RegisterCmd(&cmdTest);
+		rxController.Freeze();
+
+		_numHandleCalls = 0;
+		CHECK_EQUAL(rxController.Run("test -v --level 3"), true);
+		CHECK_EQUAL(_numHandleCalls, 1);
+		CHECK_EQUAL(_handleVerboseDetected, true);
+		CHECK_EQUAL(_handleLevelValue != NULL, true);
+		CHECK_EQUAL(_handleLevelValue[0], '3');
+
+		CHECK_EQUAL(rxController.Run("test"), true);
+		CHECK_EQUAL(_numHandleCalls, 2);
+		CHECK_EQUAL(_handleVerboseDetected, false);
+		CHECK_EQUAL(_handleLevelValue == NULL, true);
+	}
+
+	MTEST(OptionHandleIndexedFindTest)
+	{
+		Cmd cmdTest("test", NULL, "A test command.");
+		Option optionA('a', "same", NULL, "First with the names.", false);
+		Option optionB('a', "same", NULL, "Second with the names.", false);
+		Option optionHigh((char)0xE9, "high", NULL, "Not a 7-bit ASCII short name.", false);
+		Option optionNoShort('\0', "long-only", NULL, "No short name.", false);
+		cmdTest.RegisterOption(&optionA);
+		cmdTest.RegisterOption(&optionB);
+		cmdTest.RegisterOption(&optionHigh);
+		cmdTest.RegisterOption(&optionNoShort);
+
+		// The first option registered with a name wins, as it did with a linear search
+		CHECK_EQUAL(cmdTest.FindOptionByShortName('a') == &optionA, true);
+		CHECK_EQUAL(cmdTest.FindOptionByLongName("same") == &optionA, true);
+		CHECK_EQUAL(cmdTest.FindOptionByLongName(MString("same")) == &optionA, true);
+
+		CHECK_EQUAL(cmdTest.FindOptionByShortName((char)0xE9) == &optionHigh, true);
+		CHECK_EQUAL(cmdTest.FindOptionByLongName("long-only") == &optionNoShort, true);
+
+		CHECK_EQUAL(cmdTest.FindOptionByShortName('q') == nullptr, true);
+		CHECK_EQUAL(cmdTest.FindOptionByShortName('\0') == nullptr, true);
+		CHECK_EQUAL(cmdTest.FindOptionByLongName("sam") == nullptr, true);
+		CHECK_EQUAL(cmdTest.FindOptionByLongName("") == nullptr, true);
+		CHECK_EQUAL(cmdTest.FindOptionByLongName((const char*)NULL) == nullptr, true);
+	}
+
+} // namespace MClideTest
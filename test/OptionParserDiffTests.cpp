@@ -0,0 +1,246 @@
+//!
+//! @file 			OptionParserDiffTests.cpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! @created		2026-10-16
+//! @last-modified 	2026-10-17
+//! @brief 			Differential tests which check the single-pass OptionParser gives the same results as getopt_long().
+//! @details
+//!					See README.rst in root dir for more info.
+
+//===== SYSTEM LIBRARIES =====//
+#include <stdio.h>
+#include <string.h>
+
+//====== USER LIBRARIES =====//
+#include "MUnitTest/api/MUnitTestApi.hpp"
+
+//===== USER SOURCE =====//
+#include "../api/MClideApi.hpp"
+
+using namespace MbeddedNinja::MClideNs;
+
+namespace MClideTest
+{
+
+	static bool Callback(Cmd *cmd)
+	{
+		return true;
+	}
+
+	//! @brief		A command with a mix of short, long, valued and abbreviation-ambiguous options, run with
+	//!				either option parser.
+	class DiffParser
+	{
+		public:
+
+		Rx rxController;
+
+		Cmd cmd;
+		Param param1;
+		Param param2;
+		Option optionA;
+		Option optionB;
+		Option optionC;
+		Option optionD;
+		Option optionD2;
+		Option optionE;
+
+		DiffParser(Rx::OptionParserMode mode) :
+			cmd("test", &Callback, "A test command."),
+			param1("A test parameter."),
+			param2("A test parameter."),
+			optionA('a', "alpha", NULL, "No value.", false),
+			optionB('b', "bravo", NULL, "With value.", true),
+			optionC('c', "charlie", NULL, "With value.", true),
+			optionD('\0', "delta", NULL, "Long only, no value.", false),
+			optionD2('\0', "delta-two", NULL, "Long only, with value.", true),
+			optionE('e', "", NULL, "Short only, no value.", false)
+		{
+			this->rxController.optionParserMode = mode;
+
+			this->cmd.RegisterParam(&this->param1);
+			this->cmd.RegisterParam(&this->param2);
+			this->cmd.RegisterOption(&this->optionA);
+			this->cmd.RegisterOption(&this->optionB);
+			this->cmd.RegisterOption(&this->optionC);
+			this->cmd.RegisterOption(&this->optionD);
+			this->cmd.RegisterOption(&this->optionD2);
+			this->cmd.RegisterOption(&this->optionE);
+			this->rxController.RegisterCmd(&this->cmd);
+		}
+
+		//! @brief		Parses a message and writes everything that was detected into result.
+		void Parse(const char* msg, char* result, size_t resultSize)
+		{
+			bool success = this->rxController.Run(msg);
+
+			snprintf(
+				result,
+				resultSize,
+				"%d|%d|%s|%s|%d%d%d%d%d%d|%s|%s|%s",
+				success,
+				this->cmd.IsDetected(),
+				this->param1.value.cStr,
+				this->param2.value.cStr,
+				this->optionA.IsDetected(),
+				this->optionB.IsDetected(),
+				this->optionC.IsDetected(),
+				this->optionD.IsDetected(),
+				this->optionD2.IsDetected(),
+				this->optionE.IsDetected(),
+				this->optionB.value.cStr,
+				this->optionC.value.cStr,
+				this->optionD2.value.cStr);
+		}
+	};
+
+	//! @brief		Runs msg through both parsers, and returns true if they gave the same results.
+	static bool ParsersAgree(DiffParser& getOptParser, DiffParser& singlePassParser, const char* msg)
+	{
+		char getOptResult[200];
+		char singlePassResult[200];
+
+		getOptParser.Parse(msg, getOptResult, sizeof(getOptResult));
+		singlePassParser.Parse(msg, singlePassResult, sizeof(singlePassResult));
+
+		if(strcmp(getOptResult, singlePassResult) != 0)
+		{
+			printf("Parsers disagree on '%s': getopt = '%s', single-pass = '%s'.\r\n", msg, getOptResult, singlePassResult);
+			return false;
+		}
+
+		return true;
+	}
+
+	MTEST(OptionParserMatchesGetOptTest)
+	{
+		static const char* msgA[] =
+		{
+			"test p1 p2",
+			"test -a p1 p2",
+			"test p1 -a p2",
+			"test p1 p2 -a",
+			"test -b val p1 p2",
+			"test -bval p1 p2",
+			"test -ab val p1 p2",
+			"test -abval p1 p2",
+			"test -ae p1 p2",
+			"test -ea -c cval p1 p2",
+			"test --alpha p1 p2",
+			"test --bravo val p1 p2",
+			"test --bravo=val p1 p2",
+			"test --bravo= p1 p2",
+			"test --bravo -a p1 p2",
+			"test -b -a p1 p2",
+			"test --alp p1 p2",
+			"test --br=abbrev p1 p2",
+			"test --del p1 p2",
+			"test --delta p1 p2",
+			"test --delta-t=d2 p1 p2",
+			"test --delta=val p1 p2",
+			"test --alpha=val p1 p2",
+			"test --unknown p1 p2",
+			"test -x p1 p2",
+			"test -xa p1 p2",
+			"test -a: p1 p2",
+			"test --=x p1 p2",
+			"test -- -a p2",
+			"test p1 -- -a",
+			"test -a -- p1 p2",
+			"test - p2",
+			"test \"-8\" \"-1.5\"",
+			"test -b \"-8\" p1 p2",
+			"test -b -8 p1 p2",
+			"test p1 p2 -b",
+			"test p1 p2 --bravo",
+			"test p1",
+			"test p1 p2 p3",
+			"test -a -a -a p1 p2",
+			"test -b v1 -b v2 p1 p2",
+			"test -h",
+			"test p1 --help p2",
+			"test -ah p1 p2",
+		};
+
+		bool enableCmdLinePrinting = Print::enableCmdLinePrinting;
+		Print::enableCmdLinePrinting = false;
+
+		DiffParser getOptParser(Rx::OptionParserMode::GETOPT);
+		DiffParser singlePassParser(Rx::OptionParserMode::SINGLE_PASS);
+
+		for(uint32_t x = 0; x < sizeof(msgA)/sizeof(msgA[0]); x++)
+			CHECK_EQUAL(ParsersAgree(getOptParser, singlePassParser, msgA[x]), true);
+
+		Print::enableCmdLinePrinting = enableCmdLinePrinting;
+	}
+
+	MTEST(OptionParserMatchesGetOptRandomTest)
+	{
+		static const char* tokenA[] =
+		{
+			"p1", "p2", "-a", "-b", "-c", "-e", "-x", "-ab", "-ba", "-bval", "-aeb", "--alpha", "--bravo",
+			"--bravo=v", "--charlie", "--ch=v", "--d", "--delta", "--delta-two", "--delta-two=v", "--alpha=v",
+			"--", "-", "\"-8\"", "--zulu",
+		};
+		const uint32_t numTokens = sizeof(tokenA)/sizeof(tokenA[0]);
+
+		bool enableCmdLinePrinting = Print::enableCmdLinePrinting;
+		Print::enableCmdLinePrinting = false;
+
+		DiffParser getOptParser(Rx::OptionParserMode::GETOPT);
+		DiffParser singlePassParser(Rx::OptionParserMode::SINGLE_PASS);
+
+		// Simple LCG, so the test is the same every time
+		uint32_t seed = 12345;
+		uint32_t numDisagreements = 0;
+		char msg[200];
+		for(uint32_t x = 0; x < 2000; x++)
+		{
+			strcpy(msg, "test");
+			seed = seed*1103515245u + 12345u;
+			uint32_t numArgs = (seed >> 16) % 7;
+			for(uint32_t y = 0; y < numArgs; y++)
+			{
+				seed = seed*1103515245u + 12345u;
+				strcat(msg, " ");
+				strcat(msg, tokenA[(seed >> 16) % numTokens]);
+			}
+
+			if(!ParsersAgree(getOptParser, singlePassParser, msg))
+				numDisagreements++;
+		}
+
+		Print::enableCmdLinePrinting = enableCmdLinePrinting;
+
+		CHECK_EQUAL(numDisagreements, 0);
+	}
+
+	MTEST(OptionParserReadsMessageInPlaceTest)
+	{
+		DiffParser singlePassParser(Rx::OptionParserMode::SINGLE_PASS);
+
+		// Not null-terminated, the values and parameters at the end of the message are copied to be terminated
+		static const char msg[] = "test -bbv --charlie=cv --delta-two d2 p1 p2XXXX";
+		bool success = singlePassParser.rxController.Run(msg, sizeof(msg) - 1 - 4);
+
+		CHECK_EQUAL(success, true);
+		CHECK_EQUAL(strcmp(singlePassParser.optionB.value.cStr, "bv"), 0);
+		CHECK_EQUAL(strcmp(singlePassParser.optionC.value.cStr, "cv"), 0);
+		CHECK_EQUAL(strcmp(singlePassParser.optionD2.value.cStr, "d2"), 0);
+		CHECK_EQUAL(strcmp(singlePassParser.param1.value.cStr, "p1"), 0);
+		CHECK_EQUAL(strcmp(singlePassParser.param2.value.cStr, "p2"), 0);
+		CHECK_EQUAL(strcmp(msg, "test -bbv --charlie=cv --delta-two d2 p1 p2XXXX"), 0);
+
+		// argv strings are already null-terminated, so the values and parameters point into them
+		char arg0[] = "program", arg1[] = "test", arg2[] = "-bbv", arg3[] = "--charlie=cv", arg4[] = "q1", arg5[] = "q2";
+		char* argv[] = { arg0, arg1, arg2, arg3, arg4, arg5 };
+		success = singlePassParser.rxController.Run(6, argv);
+
+		CHECK_EQUAL(success, true);
+		CHECK_EQUAL(strcmp(singlePassParser.optionB.value.cStr, "bv"), 0);
+		CHECK_EQUAL(strcmp(singlePassParser.optionC.value.cStr, "cv"), 0);
+		CHECK_EQUAL(strcmp(singlePassParser.param1.value.cStr, "q1"), 0);
+		CHECK_EQUAL(strcmp(singlePassParser.param2.value.cStr, "q2"), 0);
+	}
+
+} // namespace MClideTest
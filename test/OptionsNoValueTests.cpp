@@ -2,7 +2,7 @@
 //! @file 			OptionsNoValueTests.cpp
 //! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
 //! @created		2013-07-04
-//! @last-modified 	2014-10-07
+//! @last-modified 	2026-10-16
 //! @brief 			Contains test functions for Clide command options.
 //! @details
 //!					See README.rst in root dir for more info.
@@ -54,7 +54,7 @@ namespace MClideTest
 		rxController.Run(rxBuff);
 
 		if(_cmd != NULL)
-			CHECK_EQUAL(testOption.isDetected, true);
+			CHECK_EQUAL(testOption.IsDetected(), true);
 		else
 			CHECK(false);
 			
@@ -87,8 +87,8 @@ namespace MClideTest
 		
 		if(_cmd != NULL)
 		{
-			CHECK_EQUAL(testOption1.isDetected, true);
-			CHECK_EQUAL(testOption2.isDetected, true);
+			CHECK_EQUAL(testOption1.IsDetected(), true);
+			CHECK_EQUAL(testOption2.IsDetected(), true);
 		}
 		else
 			CHECK(false);
@@ -122,8 +122,8 @@ namespace MClideTest
 
 		if(_cmd != NULL)
 		{
-			CHECK_EQUAL(testOption1.isDetected, true);
-			CHECK_EQUAL(testOption2.isDetected, false);
+			CHECK_EQUAL(testOption1.IsDetected(), true);
+			CHECK_EQUAL(testOption2.IsDetected(), false);
 		}
 		else
 			CHECK(false);
@@ -2,7 +2,7 @@
 //! @file 			OptionsWithValueTests.cpp
 //! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
 //! @created		2013-07-04
-//! @last-modified 	2014-10-07
+//! @last-modified 	2026-10-16
 //! @brief 			Contains test functions for MClide command options.
 //! @details
 //!					See README.rst in root dir for more info.
@@ -47,7 +47,7 @@ namespace MClideTest
 		// Run rx controller
 		rxController.Run(rxBuff1);
 
-		CHECK_EQUAL(testOption.isDetected, true);
+		CHECK_EQUAL(testOption.IsDetected(), true);
 		CHECK_EQUAL(testOption.value, "optVal");
 		
 		// Create fake input buffer
@@ -56,7 +56,7 @@ namespace MClideTest
 		// Run rx controller
 		rxController.Run(rxBuff2);
 
-		CHECK_EQUAL(testOption.isDetected, false);
+		CHECK_EQUAL(testOption.IsDetected(), false);
 	}
 
 
@@ -83,8 +83,8 @@ namespace MClideTest
 		// Run rx controller
 		rxController.Run(rxBuff);
 
-		CHECK_EQUAL(testOption1.isDetected, true);
-		CHECK_EQUAL(testOption2.isDetected, true);
+		CHECK_EQUAL(testOption1.IsDetected(), true);
+		CHECK_EQUAL(testOption2.IsDetected(), true);
 
 		
 	}
@@ -112,8 +112,8 @@ namespace MClideTest
 		// Run rx controller
 		rxController.Run(rxBuff);
 
-		CHECK_EQUAL(testOption1.isDetected, true);
-		CHECK_EQUAL(testOption2.isDetected, false);
+		CHECK_EQUAL(testOption1.IsDetected(), true);
+		CHECK_EQUAL(testOption2.IsDetected(), false);
 
 		}
 		
@@ -2,7 +2,7 @@
 //! @file 			ParamsAndOptionTests.cpp
 //! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
 //! @created		2013-07-04
-//! @last-modified 	2014-10-07
+//! @last-modified 	2026-10-16
 //! @brief 			Contains test functions for MClide command parameters and options in the same command.
 //! @details
 //!					See README.rst in root dir for more info.
@@ -52,7 +52,7 @@ namespace MClideTest
 		rxController.Run(rxBuff);
 
 		CHECK_EQUAL(cmdTestParam.value, "param1");
-		CHECK_EQUAL(cmdTestOption.isDetected, true);
+		CHECK_EQUAL(cmdTestOption.IsDetected(), true);
 	}
 
 	MTEST(OneOptionThenOneParamRxTest)
@@ -81,7 +81,7 @@ namespace MClideTest
 		rxController.Run(rxBuff);
 
 		CHECK_EQUAL(cmdTestParam.value, "param1");
-		CHECK_EQUAL(cmdTestOption.isDetected, true);
+		CHECK_EQUAL(cmdTestOption.IsDetected(), true);
 	}
 
 	MTEST(TwoParamTwoOptionRxTest1)
@@ -116,8 +116,8 @@ namespace MClideTest
 
 		CHECK_EQUAL(cmdTestParam1.value, "param1");
 		CHECK_EQUAL(cmdTestParam2.value, "param2");
-		CHECK_EQUAL(cmdTestOption1.isDetected, true);
-		CHECK_EQUAL(cmdTestOption2.isDetected, true);
+		CHECK_EQUAL(cmdTestOption1.IsDetected(), true);
+		CHECK_EQUAL(cmdTestOption2.IsDetected(), true);
 	}
 
 	MTEST(TwoParamTwoOptionRxTest2)
@@ -153,8 +153,8 @@ namespace MClideTest
 
 		CHECK_EQUAL(cmdTestParam1.value, "param1");
 		CHECK_EQUAL(cmdTestParam2.value, "param2");
-		CHECK_EQUAL(cmdTestOption1.isDetected, true);
-		CHECK_EQUAL(cmdTestOption2.isDetected, true);
+		CHECK_EQUAL(cmdTestOption1.IsDetected(), true);
+		CHECK_EQUAL(cmdTestOption2.IsDetected(), true);
 	}
 
 	MTEST(TwoParamTwoOptionRxTest3)
@@ -190,8 +190,8 @@ namespace MClideTest
 		
 		CHECK_EQUAL(cmdTestParam1.value, "param1");
 		CHECK_EQUAL(cmdTestParam2.value, "param2");
-		CHECK_EQUAL(cmdTestOption1.isDetected, true);
-		CHECK_EQUAL(cmdTestOption2.isDetected, true);
+		CHECK_EQUAL(cmdTestOption1.IsDetected(), true);
+		CHECK_EQUAL(cmdTestOption2.IsDetected(), true);
 		
 		// Create fake input buffer
 		char rxBuff2[50] = "test param1 param2";
@@ -201,8 +201,8 @@ namespace MClideTest
 		
 		CHECK_EQUAL(cmdTestParam1.value, "param1");
 		CHECK_EQUAL(cmdTestParam2.value, "param2");
-		CHECK_EQUAL(cmdTestOption1.isDetected, false);
-		CHECK_EQUAL(cmdTestOption2.isDetected, false);
+		CHECK_EQUAL(cmdTestOption1.IsDetected(), false);
+		CHECK_EQUAL(cmdTestOption2.IsDetected(), false);
 	}
 
 } // namespace MClideTest
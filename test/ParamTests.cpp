@@ -2,7 +2,7 @@
 //! @file 			ParamTests.cpp
 //! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
 //! @created		2013-07-04
-//! @last-modified 	2014-10-07
+//! @last-modified 	2026-10-16
 //! @brief 			Contains test functions for Clide command parameters.
 //! @details
 //!					See README.rst in root dir for more info.
@@ -49,7 +49,7 @@ namespace MClideTest
 		rxController.Run(rxBuff);
 
 		if(_cmd != NULL)
-			CHECK_EQUAL(_cmd->isDetected, true);
+			CHECK_EQUAL(_cmd->IsDetected(), true);
 		else
 			CHECK(false);
 	}
@@ -76,7 +76,7 @@ namespace MClideTest
 		rxController.Run(rxBuff);
 
 		if(_cmd != NULL)
-			CHECK_EQUAL(_cmd->isDetected, true);
+			CHECK_EQUAL(_cmd->IsDetected(), true);
 		else
 			CHECK(false);
 	}
@@ -106,7 +106,7 @@ namespace MClideTest
 		rxController.Run(rxBuff);
 		
 		if(_cmd != NULL)
-			CHECK_EQUAL(_cmd->isDetected, true);
+			CHECK_EQUAL(_cmd->IsDetected(), true);
 		else
 			CHECK(false);
 	}
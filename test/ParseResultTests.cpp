@@ -0,0 +1,239 @@
+//!
+//! @file 			ParseResultTests.cpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! @created		2026-10-16
+//! @last-modified 	2026-10-16
+//! @brief 			Contains test functions for the per-parse ParseResult, and for running a frozen Rx from many threads.
+//! @details
+//!					See README.rst in root dir for more info.
+
+//===== SYSTEM LIBRARIES =====//
+#include <stdio.h>
+#include <string.h>
+#include <thread>
+#include <vector>
+
+//====== USER LIBRARIES =====//
+#include "MUnitTest/api/MUnitTestApi.hpp"
+
+//===== USER SOURCE =====//
+#include "../api/MClideApi.hpp"
+
+using namespace MbeddedNinja::MClideNs;
+
+namespace MClideTest
+{
+
+	//! @brief		Holds the options and parameter of the "test" command, so the result callbacks can look them up.
+	struct ResultTestCmd
+	{
+		Cmd cmd;
+		Param param;
+		Option optionA;
+		Option optionB;
+
+		ResultTestCmd() :
+			cmd("test", NULL, "A test command."),
+			param("A test parameter."),
+			optionA('a', "alpha", NULL, "A test option.", false),
+			optionB('b', "bravo", NULL, "A test option with a value.", true)
+		{
+			this->cmd.RegisterParam(&this->param);
+			this->cmd.RegisterOption(&this->optionA);
+			this->cmd.RegisterOption(&this->optionB);
+		}
+	};
+
+	static ResultTestCmd* _resultTestCmd = NULL;
+
+	//! @brief		Written by the result callbacks with everything read from the result.
+	static thread_local char _resultStr[100];
+
+	static void WriteResultStr(const ParseResult& result)
+	{
+		const char* value = result.GetValue(&_resultTestCmd->optionB);
+		snprintf(
+			_resultStr,
+			sizeof(_resultStr),
+			"%s:%d:%d:%s:%s",
+			result.GetCmd()->name.cStr,
+			result.IsDetected(&_resultTestCmd->optionA),
+			result.IsDetected(&_resultTestCmd->optionB),
+			(value != NULL) ? value : "null",
+			result.GetParam(0));
+	}
+
+	static bool ResultCallback(const ParseResult& result)
+	{
+		WriteResultStr(result);
+		return true;
+	}
+
+	class ResultCallbackClass
+	{
+		public:
+		void Callback(const ParseResult& result)
+		{
+			WriteResultStr(result);
+			this->numCalls++;
+		}
+
+		uint32_t numCalls;
+	};
+
+	MTEST(ParseResultFunctionCallbackTest)
+	{
+		Rx rxController;
+		ResultTestCmd testCmd;
+		_resultTestCmd = &testCmd;
+		testCmd.cmd.resultFunctionCallback = &ResultCallback;
+		rxController.RegisterCmd(&testCmd.cmd);
+
+		CHECK_EQUAL(rxController.Run("test -b val param1"), true);
+		CHECK_EQUAL(strcmp(_resultStr, "test:0:1:val:param1"), 0);
+
+		// Nothing carries over from the previous parse
+		CHECK_EQUAL(rxController.Run("test --alpha param2"), true);
+		CHECK_EQUAL(strcmp(_resultStr, "test:1:0:null:param2"), 0);
+
+		// Not frozen, so the results are still mirrored into the command, options and parameters
+		CHECK_EQUAL(testCmd.cmd.IsDetected(), true);
+		CHECK_EQUAL(testCmd.optionA.IsDetected(), true);
+		CHECK_EQUAL(testCmd.param.value, "param2");
+	}
+
+	MTEST(ParseResultMethodCallbackTest)
+	{
+		Rx rxController;
+		ResultTestCmd testCmd;
+		_resultTestCmd = &testCmd;
+		ResultCallbackClass callbackClass;
+		callbackClass.numCalls = 0;
+		testCmd.cmd.resultMethodCallback =
+			MCallbacks::CallbackGen<ResultCallbackClass, void, const ParseResult&>(&callbackClass, &ResultCallbackClass::Callback);
+		rxController.RegisterCmd(&testCmd.cmd);
+
+		rxController.optionParserMode = Rx::OptionParserMode::SINGLE_PASS;
+		CHECK_EQUAL(rxController.Run("test param1 --bravo=val -a"), true);
+		CHECK_EQUAL(strcmp(_resultStr, "test:1:1:val:param1"), 0);
+		CHECK_EQUAL(callbackClass.numCalls, 1);
+
+		// Wrong number of parameters, so the callback is not called
+		CHECK_EQUAL(rxController.Run("test"), false);
+		CHECK_EQUAL(callbackClass.numCalls, 1);
+	}
+
+	MTEST(ParseResultOptionNotInCmdTest)
+	{
+		Rx rxController;
+		ResultTestCmd testCmd;
+		rxController.RegisterCmd(&testCmd.cmd);
+
+		Option otherOption('c', "charlie", NULL, "An option not registered with the command.", true);
+
+		ParseResult result(&testCmd.cmd, NULL);
+		result.SetDetected(&testCmd.optionB, "val");
+		CHECK_EQUAL(result.IsDetected(&testCmd.optionB), true);
+		CHECK_EQUAL(strcmp(result.GetValue(&testCmd.optionB), "val"), 0);
+		CHECK_EQUAL(result.IsDetected(&otherOption), false);
+		CHECK_EQUAL(result.GetValue(&otherOption) == NULL, true);
+		CHECK_EQUAL(result.GetParam(0) == NULL, true);
+	}
+
+	MTEST(FrozenRxDoesNotWriteToCmdTest)
+	{
+		Rx rxController;
+		ResultTestCmd testCmd;
+		_resultTestCmd = &testCmd;
+		testCmd.cmd.resultFunctionCallback = &ResultCallback;
+		rxController.RegisterCmd(&testCmd.cmd);
+
+		rxController.Freeze();
+		CHECK_EQUAL(rxController.IsFrozen(), true);
+
+		CHECK_EQUAL(rxController.Run("test -a -b val param1"), true);
+		CHECK_EQUAL(strcmp(_resultStr, "test:1:1:val:param1"), 0);
+
+		// Results are only in the ParseResult
+		CHECK_EQUAL(testCmd.cmd.IsDetected(), false);
+		CHECK_EQUAL(testCmd.optionA.IsDetected(), false);
+		CHECK_EQUAL(testCmd.optionB.value, "");
+		CHECK_EQUAL(testCmd.param.value, "");
+
+		// Help still works once frozen
+		CHECK_EQUAL(rxController.Run("help -g user"), true);
+
+		// Nothing can be registered once frozen
+		bool enableErrorPrinting = Print::enableErrorPrinting;
+		Print::enableErrorPrinting = false;
+
+		Cmd cmdOther("other", NULL, "Another test command.");
+		rxController.RegisterCmd(&cmdOther);
+		Option optionOther('c', "charlie", NULL, "Another test option.", false);
+		testCmd.cmd.RegisterOption(&optionOther);
+
+		Print::enableErrorPrinting = enableErrorPrinting;
+
+		CHECK_EQUAL(rxController.Run("other"), false);
+		CHECK_EQUAL(rxController.Run("test -c param1"), true);
+		CHECK_EQUAL(strcmp(_resultStr, "test:0:0:null:param1"), 0);
+	}
+
+	MTEST(FrozenRxConcurrentRunTest)
+	{
+		const uint32_t numThreads = 8;
+		const uint32_t numIterations = 2000;
+
+		static const char* msgA[] =
+		{
+			"test -a p0",
+			"test -b v1 p1",
+			"test --alpha --bravo=v2 p2",
+			"test p3",
+		};
+		static const char* expectedA[] =
+		{
+			"test:1:0:null:p0",
+			"test:0:1:v1:p1",
+			"test:1:1:v2:p2",
+			"test:0:0:null:p3",
+		};
+		const uint32_t numMsgs = sizeof(msgA)/sizeof(msgA[0]);
+
+		// One Rx shared between every thread
+		Rx rxController;
+		ResultTestCmd testCmd;
+		_resultTestCmd = &testCmd;
+		testCmd.cmd.resultFunctionCallback = &ResultCallback;
+		rxController.RegisterCmd(&testCmd.cmd);
+		rxController.Freeze();
+
+		bool enableDebugInfoPrinting = Print::enableDebugInfoPrinting;
+		Print::enableDebugInfoPrinting = false;
+
+		uint32_t numMismatchesA[numThreads] = {0};
+		std::vector<std::thread> threadA;
+		for(uint32_t t = 0; t < numThreads; t++)
+		{
+			threadA.push_back(std::thread([&rxController, &numMismatchesA, t, numIterations, numMsgs]()
+			{
+				for(uint32_t i = 0; i < numIterations; i++)
+				{
+					// Each thread starts at a different message, so they are not all parsing the same thing
+					uint32_t x = (i + t) % numMsgs;
+					if(!rxController.Run(msgA[x]) || (strcmp(_resultStr, expectedA[x]) != 0))
+						numMismatchesA[t]++;
+				}
+			}));
+		}
+
+		for(uint32_t t = 0; t < numThreads; t++)
+			threadA[t].join();
+
+		Print::enableDebugInfoPrinting = enableDebugInfoPrinting;
+
+		for(uint32_t t = 0; t < numThreads; t++)
+			CHECK_EQUAL(numMismatchesA[t], 0);
+	}
+
+} // namespace MClideTest
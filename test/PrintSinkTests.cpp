@@ -0,0 +1,220 @@
+//!
+//! @file 			PrintSinkTests.cpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! @created		2026-10-16
+//! @last-modified 	2026-10-17
+//! @brief 			Contains test functions for per-object output (Comm::printSink).
+//! @details
+//!					See README.rst in root dir for more info.
+
+//===== SYSTEM LIBRARIES =====//
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <thread>
+
+//====== USER LIBRARIES =====//
+#include "MUnitTest/api/MUnitTestApi.hpp"
+
+//===== USER SOURCE =====//
+#include "../api/MClideApi.hpp"
+
+using namespace MbeddedNinja::MClideNs;
+
+namespace MClideTest
+{
+
+	//! @brief		Collects everything written to it.
+	class SinkRecorder
+	{
+		public:
+		void CmdLine(const char* msg)
+		{
+			this->cmdLineOutput += msg;
+		}
+
+		void Error(const char* msg)
+		{
+			this->errorOutput += msg;
+		}
+
+		void Write(PrintChunk chunk)
+		{
+			this->writeOutput.append(chunk.chars, chunk.numChars);
+			this->numWrites++;
+		}
+
+		std::string cmdLineOutput;
+		std::string errorOutput;
+		std::string writeOutput;
+		uint32_t numWrites = 0;
+	};
+
+	//! @brief		Replies through the sink of the Rx the command was received by.
+	static bool ReplyCallback(Cmd *cmd)
+	{
+		cmd->parentComm->printSink.PrintToCmdLine("reply\r\n");
+		return true;
+	}
+
+	//! @brief		Owns an Rx with one command, whose output goes to its own recorder.
+	class SinkParser
+	{
+		public:
+
+		Rx rxController;
+		Cmd cmdReply;
+		SinkRecorder recorder;
+
+		SinkParser() :
+			cmdReply("reply", &ReplyCallback, "Replies.")
+		{
+			this->rxController.RegisterCmd(&this->cmdReply);
+			this->rxController.printSink.cmdLinePrintCallback =
+				MCallbacks::CallbackGen<SinkRecorder, void, const char*>(&this->recorder, &SinkRecorder::CmdLine);
+			this->rxController.printSink.errorPrintCallback =
+				MCallbacks::CallbackGen<SinkRecorder, void, const char*>(&this->recorder, &SinkRecorder::Error);
+		}
+	};
+
+	MTEST(PrintSinkSeparateRxTest)
+	{
+		// Print's flags don't apply to sinks with their own callbacks
+		bool enableCmdLinePrinting = Print::enableCmdLinePrinting;
+		Print::enableCmdLinePrinting = false;
+
+		SinkParser parser1;
+		SinkParser parser2;
+
+		parser1.rxController.Run("reply");
+		CHECK_EQUAL(parser1.recorder.cmdLineOutput == "reply\r\n", true);
+		CHECK_EQUAL(parser2.recorder.cmdLineOutput.empty(), true);
+
+		// Help goes to the Rx that received it
+		parser2.rxController.Run("help");
+		CHECK_EQUAL(parser2.recorder.cmdLineOutput.find("reply") != std::string::npos, true);
+		CHECK_EQUAL(parser1.recorder.cmdLineOutput == "reply\r\n", true);
+
+		// So do the responses to unrecognised commands
+		parser1.recorder.cmdLineOutput.clear();
+		parser1.rxController.Run("nonsense");
+		CHECK_EQUAL(parser1.recorder.cmdLineOutput.find("nonsense") != std::string::npos, true);
+
+		Print::enableCmdLinePrinting = enableCmdLinePrinting;
+	}
+
+	MTEST(PrintSinkGetOptErrorTest)
+	{
+		SinkParser parser1;
+		SinkParser parser2;
+
+		// The option parser's error messages go to the Rx that received the command
+		parser1.rxController.Run("reply --bogus");
+		CHECK_EQUAL(parser1.recorder.errorOutput.find("unrecognized option '--bogus'") != std::string::npos, true);
+		CHECK_EQUAL(parser2.recorder.errorOutput.empty(), true);
+	}
+
+	MTEST(PrintSinkDisableTest)
+	{
+		SinkParser parser;
+		parser.rxController.printSink.enableCmdLinePrinting = false;
+
+		parser.rxController.Run("reply");
+		parser.rxController.Run("help");
+		CHECK_EQUAL(parser.recorder.cmdLineOutput.empty(), true);
+	}
+
+	MTEST(PrintSinkThreadsTest)
+	{
+		const uint32_t numRuns = 2000;
+
+		// Each thread has its own frozen Rx and sink, so nothing is shared
+		SinkParser parser1;
+		SinkParser parser2;
+		parser1.rxController.Freeze();
+		parser2.rxController.Freeze();
+
+		std::thread thread1([&parser1, numRuns]()
+		{
+			for(uint32_t x = 0; x < numRuns; x++)
+				parser1.rxController.Run("reply");
+		});
+		std::thread thread2([&parser2, numRuns]()
+		{
+			for(uint32_t x = 0; x < numRuns; x++)
+				parser2.rxController.Run("reply");
+		});
+		thread1.join();
+		thread2.join();
+
+		CHECK_EQUAL(parser1.recorder.cmdLineOutput.size(), numRuns*strlen("reply\r\n"));
+		CHECK_EQUAL(parser2.recorder.cmdLineOutput.size(), numRuns*strlen("reply\r\n"));
+	}
+
+	MTEST(PrintSinkBufferedHelpTest)
+	{
+		SinkParser parser;
+		Cmd* cmdA[50];
+		char name[20];
+		for(uint32_t x = 0; x < 50; x++)
+		{
+			snprintf(name, sizeof(name), "cmd%02u", (unsigned int)x);
+			cmdA[x] = new Cmd(name, NULL, "A test command.");
+			parser.rxController.RegisterCmd(cmdA[x]);
+		}
+
+		// Unbuffered, for comparison
+		parser.rxController.Run("help");
+		std::string unbufferedOutput = parser.recorder.cmdLineOutput;
+		CHECK_EQUAL(unbufferedOutput.find("cmd49") != std::string::npos, true);
+
+		// Buffered, the whole response is written in one go
+		char buff[4096];
+		parser.rxController.printSink.cmdLineWriteCallback =
+			MCallbacks::CallbackGen<SinkRecorder, void, PrintChunk>(&parser.recorder, &SinkRecorder::Write);
+		parser.rxController.printSink.SetBuffer(buff, sizeof(buff));
+		parser.rxController.Run("help");
+		CHECK_EQUAL(parser.recorder.numWrites, 1);
+		CHECK_EQUAL(parser.recorder.writeOutput == unbufferedOutput, true);
+
+		// Help comes from the help cache in one piece, so with a buffer too small for it, it is written straight away
+		char smallBuff[64];
+		parser.recorder.writeOutput.clear();
+		parser.recorder.numWrites = 0;
+		parser.rxController.printSink.SetBuffer(smallBuff, sizeof(smallBuff));
+		parser.rxController.Run("help");
+		CHECK_EQUAL(parser.recorder.numWrites, 1);
+		CHECK_EQUAL(parser.recorder.writeOutput == unbufferedOutput, true);
+
+		for(uint32_t x = 0; x < 50; x++)
+			delete cmdA[x];
+	}
+
+	MTEST(PrintSinkWriteCallbackNoBufferTest)
+	{
+		// Without a buffer, every message is passed on as it is printed
+		PrintSink printSink;
+		SinkRecorder recorder;
+		printSink.cmdLineWriteCallback =
+			MCallbacks::CallbackGen<SinkRecorder, void, PrintChunk>(&recorder, &SinkRecorder::Write);
+
+		printSink.PrintToCmdLine("abc");
+		printSink.PrintToCmdLine("de");
+		CHECK_EQUAL(recorder.numWrites, 2);
+		CHECK_EQUAL(recorder.writeOutput == "abcde", true);
+
+		// Printing outside of Rx::Run() needs a Flush()
+		char buff[16];
+		printSink.SetBuffer(buff, sizeof(buff));
+		printSink.PrintToCmdLine("fgh");
+		CHECK_EQUAL(recorder.numWrites, 2);
+		printSink.Flush();
+		CHECK_EQUAL(recorder.numWrites, 3);
+
+		// Too big for the buffer, passed on straight away
+		printSink.PrintToCmdLine("0123456789abcdefghij");
+		CHECK_EQUAL(recorder.numWrites, 4);
+		CHECK_EQUAL(recorder.writeOutput == "abcdefgh0123456789abcdefghij", true);
+	}
+
+} // namespace MClideTest
@@ -2,7 +2,7 @@
 //! @file 			QuotesAndNegativeNumberTests.cpp
 //! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
 //! @created		2013-07-04
-//! @last-modified 	2014-10-07
+//! @last-modified 	2026-10-16
 //! @brief 			Contains test functions for Clide command options with negative numbers.
 //! @details
 //!					See README.rst in root dir for more info.
@@ -45,7 +45,7 @@ namespace MClideTest
 		// Run rx controller
 		rxController.Run(rxBuff1);
 
-		CHECK_EQUAL(testOption.isDetected, true);
+		CHECK_EQUAL(testOption.IsDetected(), true);
 		CHECK_EQUAL(testOption.value, "\"-8\"");
 
 		// Create fake input buffer
@@ -54,7 +54,7 @@ namespace MClideTest
 		// Run rx controller
 		rxController.Run(rxBuff2);
 		
-		CHECK_EQUAL(testOption.isDetected, false);
+		CHECK_EQUAL(testOption.IsDetected(), false);
 	}
 
 } // namespace MClideTest
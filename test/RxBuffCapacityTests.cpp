@@ -0,0 +1,102 @@
+//!
+//! @file 			RxBuffCapacityTests.cpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! @created		2026-10-16
+//! @last-modified 	2026-10-16
+//! @brief 			Contains test functions for RxBuff objects with different buffer sizes in the same program.
+//! @details
+//!					See README.rst in root dir for more info.
+
+//===== SYSTEM LIBRARIES =====//
+#include <stdio.h>
+#include <string.h>
+
+//====== USER LIBRARIES =====//
+#include "MUnitTest/api/MUnitTestApi.hpp"
+
+//===== USER SOURCE =====//
+#include "../api/MClideApi.hpp"
+
+using namespace MbeddedNinja::MClideNs;
+
+namespace MClideTest
+{
+
+	static uint32_t _numCallbacks = 0;
+
+	static bool Callback(Cmd *cmd)
+	{
+		_numCallbacks++;
+		return true;
+	}
+
+	MTEST(RxBuffDefaultCapacityTest)
+	{
+		Rx rxController;
+		RxBuff rxBuff(&rxController, '\r');
+		CHECK_EQUAL(rxBuff.GetCapacity(), clide_RX_BUFF_SIZE);
+	}
+
+	MTEST(StaticRxBuffLargeAndSmallTest)
+	{
+		Rx rxController;
+		Cmd cmdTest("test", &Callback, "A test command.");
+		Param cmdTestParam("A test parameter.");
+		cmdTest.RegisterParam(&cmdTestParam);
+		rxController.RegisterCmd(&cmdTest);
+
+		// Both at once, sharing the same Rx
+		StaticRxBuff<4096> largeRxBuff(&rxController, '\n');
+		StaticRxBuff<16> smallRxBuff(&rxController, '\n');
+		CHECK_EQUAL(largeRxBuff.GetCapacity(), 4096);
+		CHECK_EQUAL(smallRxBuff.GetCapacity(), 16);
+
+		// A 1000 character parameter, written one character at a time so the command has to be buffered
+		char param[1000];
+		memset(param, 'a', sizeof(param));
+
+		_numCallbacks = 0;
+		largeRxBuff.WriteString("test ");
+		for(uint32_t x = 0; x < sizeof(param); x++)
+			CHECK_EQUAL(largeRxBuff.WriteChar(param[x]), true);
+		largeRxBuff.WriteChar('\n');
+		CHECK_EQUAL(_numCallbacks, 1);
+		CHECK_EQUAL(strlen(cmdTestParam.value.cStr), sizeof(param));
+
+		// Too long for the small buffer, the command is truncated to 16 characters
+		bool enableErrorPrinting = Print::enableErrorPrinting;
+		Print::enableErrorPrinting = false;
+		smallRxBuff.WriteString("test ");
+		bool success = true;
+		for(uint32_t x = 0; x < 50; x++)
+			success &= smallRxBuff.WriteChar(param[x]);
+		Print::enableErrorPrinting = enableErrorPrinting;
+		CHECK_EQUAL(success, false);
+		smallRxBuff.WriteChar('\n');
+		CHECK_EQUAL(_numCallbacks, 2);
+		CHECK_EQUAL(strlen(cmdTestParam.value.cStr), 16 - 5);
+	}
+
+	MTEST(RxBuffCallerProvidedBufferTest)
+	{
+		Rx rxController;
+		Cmd cmdTest("test", &Callback, "A test command.");
+		Param cmdTestParam("A test parameter.");
+		cmdTest.RegisterParam(&cmdTestParam);
+		rxController.RegisterCmd(&cmdTest);
+
+		char buff[32];
+		RxBuff rxBuff(&rxController, '\r', buff, sizeof(buff));
+		CHECK_EQUAL(rxBuff.GetCapacity(), sizeof(buff));
+
+		_numCallbacks = 0;
+		rxBuff.WriteString("te");
+		rxBuff.WriteString("st param1\r");
+		CHECK_EQUAL(_numCallbacks, 1);
+		CHECK_EQUAL(cmdTestParam.value, "param1");
+
+		// The start of the command was kept in the caller's buffer
+		CHECK_EQUAL(strncmp(buff, "test param1", 11), 0);
+	}
+
+} // namespace MClideTest
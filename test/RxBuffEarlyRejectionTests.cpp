@@ -0,0 +1,210 @@
+//!
+//! @file 			RxBuffEarlyRejectionTests.cpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! @created		2026-10-16
+//! @last-modified 	2026-10-16
+//! @brief 			Contains test functions for RxBuff early rejection of unrecognised and too long commands.
+//! @details
+//!					See README.rst in root dir for more info.
+
+//===== SYSTEM LIBRARIES =====//
+#include <stdio.h>
+#include <string.h>
+
+//====== USER LIBRARIES =====//
+#include "MUnitTest/api/MUnitTestApi.hpp"
+
+//===== USER SOURCE =====//
+#include "../api/MClideApi.hpp"
+#include "../include/HashIndex.hpp"
+
+using namespace MbeddedNinja::MClideNs;
+
+namespace MClideTest
+{
+
+	static uint32_t _numCallbacks = 0;
+
+	static bool Callback(Cmd *cmd)
+	{
+		_numCallbacks++;
+		return true;
+	}
+
+	//! @brief		Records what the RxBuff rejected.
+	class RejectionRecorder
+	{
+		public:
+		void UnrecogCallback(char* cmdName)
+		{
+			strncpy(this->lastCmdName, cmdName, sizeof(this->lastCmdName) - 1);
+			this->numUnrecogCmds++;
+		}
+
+		void OverflowCallback(RxBuff* rxBuff)
+		{
+			this->lastOverflowRxBuff = rxBuff;
+			this->numOverflows++;
+		}
+
+		char lastCmdName[50] = {0};
+		uint32_t numUnrecogCmds = 0;
+		RxBuff* lastOverflowRxBuff = NULL;
+		uint32_t numOverflows = 0;
+	};
+
+	//! @brief		Owns an Rx with one command, and a streaming RxBuff with early rejection.
+	class RejectingParser
+	{
+		public:
+
+		Rx rxController;
+		Cmd cmdTest;
+		Param cmdTestParam;
+		char buff[20];
+		RxBuff rxBuff;
+		RejectionRecorder recorder;
+
+		RejectingParser() :
+			cmdTest("test", &Callback, "A test command."),
+			cmdTestParam("A test parameter."),
+			rxBuff(&rxController, '\n', buff, sizeof(buff))
+		{
+			this->cmdTest.RegisterParam(&this->cmdTestParam);
+			this->rxController.RegisterCmd(&this->cmdTest);
+
+			this->rxController.cmdUnrecogCallback =
+				MCallbacks::CallbackGen<RejectionRecorder, void, char*>(&this->recorder, &RejectionRecorder::UnrecogCallback);
+			this->rxBuff.overflowCallback =
+				MCallbacks::CallbackGen<RejectionRecorder, void, RxBuff*>(&this->recorder, &RejectionRecorder::OverflowCallback);
+
+			this->rxBuff.SetStreaming(true);
+			this->rxBuff.SetEarlyRejection(true);
+		}
+	};
+
+	MTEST(CmdPrefixIndexTest)
+	{
+		Rx rxController;
+		Cmd cmdTest("test", &Callback, "A test command.");
+		rxController.RegisterCmd(&cmdTest);
+
+		// Can't rule anything out until the index is enabled
+		CHECK_EQUAL(rxController.IsCmdPrefix("x", 1, HashIndex::Hash("x", 1)), true);
+
+		rxController.EnableCmdPrefixIndex();
+		CHECK_EQUAL(rxController.IsCmdPrefix("t", 1, HashIndex::Hash("t", 1)), true);
+		CHECK_EQUAL(rxController.IsCmdPrefix("tes", 3, HashIndex::Hash("tes", 3)), true);
+		CHECK_EQUAL(rxController.IsCmdPrefix("test", 4, HashIndex::Hash("test", 4)), true);
+		CHECK_EQUAL(rxController.IsCmdPrefix("tests", 5, HashIndex::Hash("tests", 5)), false);
+		CHECK_EQUAL(rxController.IsCmdPrefix("x", 1, HashIndex::Hash("x", 1)), false);
+		// The help command is registered by Rx
+		CHECK_EQUAL(rxController.IsCmdPrefix("hel", 3, HashIndex::Hash("hel", 3)), true);
+
+		// Commands registered afterwards are added too
+		Cmd cmdOther("xray", &Callback, "Another test command.");
+		rxController.RegisterCmd(&cmdOther);
+		CHECK_EQUAL(rxController.IsCmdPrefix("x", 1, HashIndex::Hash("x", 1)), true);
+	}
+
+	MTEST(EarlyRejectionUnknownPrefixTest)
+	{
+		bool enableCmdLinePrinting = Print::enableCmdLinePrinting;
+		Print::enableCmdLinePrinting = false;
+
+		RejectingParser parser;
+		_numCallbacks = 0;
+
+		// Rejected as soon as the name can't be any command, and only reported once
+		CHECK_EQUAL(parser.rxBuff.WriteString("  tx"), true);
+		CHECK_EQUAL(parser.recorder.numUnrecogCmds, 1);
+		CHECK_EQUAL(strcmp(parser.recorder.lastCmdName, "tx"), 0);
+
+		// Junk longer than the buffer is discarded without overflowing
+		CHECK_EQUAL(parser.rxBuff.WriteString("yz lots more junk than fits in the buffer"), true);
+		CHECK_EQUAL(parser.rxBuff.WriteChar('\n'), true);
+		CHECK_EQUAL(parser.recorder.numUnrecogCmds, 1);
+		CHECK_EQUAL(parser.recorder.numOverflows, 0);
+		CHECK_EQUAL(_numCallbacks, 0);
+
+		// The next command is not affected
+		CHECK_EQUAL(parser.rxBuff.WriteString("test p1\n"), true);
+		CHECK_EQUAL(_numCallbacks, 1);
+		CHECK_EQUAL(parser.cmdTestParam.value, "p1");
+
+		Print::enableCmdLinePrinting = enableCmdLinePrinting;
+	}
+
+	MTEST(EarlyRejectionIncompleteNameTest)
+	{
+		bool enableCmdLinePrinting = Print::enableCmdLinePrinting;
+		Print::enableCmdLinePrinting = false;
+
+		RejectingParser parser;
+		_numCallbacks = 0;
+
+		// "tes" is the start of "test", but not a command
+		parser.rxBuff.WriteString("tes p1");
+		CHECK_EQUAL(parser.recorder.numUnrecogCmds, 1);
+		CHECK_EQUAL(strcmp(parser.recorder.lastCmdName, "tes"), 0);
+		parser.rxBuff.WriteChar('\n');
+
+		// Same when the name ends with the end-of-command character
+		parser.rxBuff.WriteString("te");
+		parser.rxBuff.WriteChar('\n');
+		CHECK_EQUAL(parser.recorder.numUnrecogCmds, 2);
+		CHECK_EQUAL(strcmp(parser.recorder.lastCmdName, "te"), 0);
+
+		CHECK_EQUAL(_numCallbacks, 0);
+
+		Print::enableCmdLinePrinting = enableCmdLinePrinting;
+	}
+
+	MTEST(EarlyRejectionOverflowTest)
+	{
+		bool enableErrorPrinting = Print::enableErrorPrinting;
+		Print::enableErrorPrinting = false;
+
+		RejectingParser parser;
+		_numCallbacks = 0;
+
+		// Longer than the buffer, discarded instead of truncated, and reported once
+		CHECK_EQUAL(parser.rxBuff.WriteString("test abcdefghijklmnopqrstuvwxyz"), false);
+		CHECK_EQUAL(parser.recorder.numOverflows, 1);
+		CHECK_EQUAL(parser.recorder.lastOverflowRxBuff == &parser.rxBuff, true);
+		CHECK_EQUAL(parser.rxBuff.WriteString("more characters past the end\n"), true);
+		CHECK_EQUAL(parser.recorder.numOverflows, 1);
+		CHECK_EQUAL(parser.recorder.numUnrecogCmds, 0);
+		CHECK_EQUAL(_numCallbacks, 0);
+
+		// A whole command in the same chunk as the end of the discarded one still runs
+		parser.rxBuff.WriteString("test abcdefghijklmnopqrstuvwxyz");
+		CHECK_EQUAL(parser.rxBuff.WriteString("xyz\ntest p2\n"), true);
+		CHECK_EQUAL(parser.recorder.numOverflows, 2);
+		CHECK_EQUAL(_numCallbacks, 1);
+		CHECK_EQUAL(parser.cmdTestParam.value, "p2");
+
+		Print::enableErrorPrinting = enableErrorPrinting;
+	}
+
+	MTEST(EarlyRejectionOffTruncatesTest)
+	{
+		bool enableErrorPrinting = Print::enableErrorPrinting;
+		Print::enableErrorPrinting = false;
+
+		RejectingParser parser;
+		parser.rxBuff.SetEarlyRejection(false);
+		CHECK_EQUAL(parser.rxBuff.IsRejectingEarly(), false);
+		_numCallbacks = 0;
+
+		// Without early rejection, long commands are truncated (and no callback is called)
+		CHECK_EQUAL(parser.rxBuff.WriteString("test abcdefghijklmnopqrstuvwxyz"), false);
+		CHECK_EQUAL(parser.rxBuff.WriteChar('\n'), true);
+		CHECK_EQUAL(parser.recorder.numOverflows, 0);
+		CHECK_EQUAL(_numCallbacks, 1);
+		CHECK_EQUAL(parser.cmdTestParam.value, "abcdefghijklmn");
+
+		Print::enableErrorPrinting = enableErrorPrinting;
+	}
+
+} // namespace MClideTest
@@ -2,7 +2,7 @@
 //! @file 			RxBuffEndOfCmdCharTests.cpp
 //! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
 //! @created		2014-03-21
-//! @last-modified 	2014-10-07
+//! @last-modified 	2026-10-16
 //! @brief 			Contains functions which test that the end-of-command char variable in the RxBuff object works.
 //! @details
 //!					See README.rst in root dir for more info.
@@ -52,7 +52,7 @@ namespace MClideTest
 
 		// Check that the command was processed successfully
 		CHECK_EQUAL(cmdTestParam.value, "param1");
-		CHECK_EQUAL(cmdTestOption.isDetected, true);
+		CHECK_EQUAL(cmdTestOption.IsDetected(), true);
 	}
 
 	MTEST(NewLineTest)
@@ -81,7 +81,7 @@ namespace MClideTest
 		
 		// Check that the command was processed successfully
 		CHECK_EQUAL(cmdTestParam.value, "param1");
-		CHECK_EQUAL(cmdTestOption.isDetected, true);
+		CHECK_EQUAL(cmdTestOption.IsDetected(), true);
 	}
 
 	MTEST(ZCharTest)
@@ -124,10 +124,10 @@ namespace MClideTest
 
 		// Check that the command was processed successfully
 		CHECK_EQUAL(cmd1Param.value, "param1");
-		CHECK_EQUAL(cmd1Option.isDetected, true);
+		CHECK_EQUAL(cmd1Option.IsDetected(), true);
 
 		CHECK_EQUAL(cmd2Param.value, "param1");
-		CHECK_EQUAL(cmd2Option.isDetected, true);
+		CHECK_EQUAL(cmd2Option.IsDetected(), true);
 
 	}
 		
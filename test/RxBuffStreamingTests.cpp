@@ -0,0 +1,274 @@
+//!
+//! @file 			RxBuffStreamingTests.cpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! @created		2026-10-16
+//! @last-modified 	2026-10-17
+//! @brief 			Contains test functions for RxBuff streaming mode, which parses commands while they are arriving.
+//! @details
+//!					See README.rst in root dir for more info.
+
+//===== SYSTEM LIBRARIES =====//
+#include <stdio.h>
+#include <string.h>
+
+//====== USER LIBRARIES =====//
+#include "MUnitTest/api/MUnitTestApi.hpp"
+
+//===== USER SOURCE =====//
+#include "../api/MClideApi.hpp"
+
+using namespace MbeddedNinja::MClideNs;
+
+namespace MClideTest
+{
+
+	//! @brief		Messages covering leading non-alphanumeric characters, repeated delimiters, quotes, both kinds
+	//!				of option, parameter count errors, unrecognised commands and messages with no command.
+	static const char* streamMsgA[] =
+	{
+		"test1 param1 -a",
+		"  test1   -b optVal    param2  ",
+		"test1 --alpha --bravo \"quoted val\" param3",
+		"test2 p1 p2",
+		"test2 --charlie=longVal p3 p4",
+		"test2 p5",
+		"#test1 param4 -a -b val",
+		"test3 p1",
+		"test2 \"-1.5\" \"-2\"",
+		"te\"st\"1 p1",
+		"test1",
+		"  ",
+		"",
+	};
+
+	static const uint32_t numStreamMsgs = sizeof(streamMsgA)/sizeof(streamMsgA[0]);
+
+	//! @brief		Written by the result callback with everything read from the result (every option, then every
+	//!				parameter).
+	static char _resultStr[200];
+
+	static uint32_t _numUnrecogCmds = 0;
+
+	static bool ResultCallback(const ParseResult& result)
+	{
+		const Cmd* cmd = result.GetCmd();
+		size_t len = strlen(_resultStr);
+		snprintf(&_resultStr[len], sizeof(_resultStr) - len, "%s", cmd->name.cStr);
+		for(uint32_t x = 0; x < cmd->optionA.Size(); x++)
+		{
+			const char* value = result.GetValue(cmd->optionA[x]);
+			len = strlen(_resultStr);
+			snprintf(
+				&_resultStr[len],
+				sizeof(_resultStr) - len,
+				":%d:%s",
+				result.IsDetected(cmd->optionA[x]),
+				(value != NULL) ? value : "null");
+		}
+		for(uint32_t x = 0; x < cmd->paramA.Size(); x++)
+		{
+			len = strlen(_resultStr);
+			snprintf(&_resultStr[len], sizeof(_resultStr) - len, ":%s", result.GetParam(x));
+		}
+		return true;
+	}
+
+	class StreamUnrecogCallbackClass
+	{
+		public:
+		void Callback(char* cmdName)
+		{
+			size_t len = strlen(_resultStr);
+			snprintf(&_resultStr[len], sizeof(_resultStr) - len, "unrecog:%s", cmdName);
+			_numUnrecogCmds++;
+		}
+	};
+
+	//! @brief		Owns an Rx and its commands.
+	class StreamingParser
+	{
+		public:
+
+		Rx rxController;
+		StreamUnrecogCallbackClass unrecogCallbackClass;
+
+		Cmd cmd1;
+		Param cmd1Param;
+		Option cmd1OptionA;
+		Option cmd1OptionB;
+
+		Cmd cmd2;
+		Param cmd2Param1;
+		Param cmd2Param2;
+		Option cmd2OptionC;
+
+		StreamingParser() :
+			cmd1("test1", NULL, "Test command 1."),
+			cmd1Param("A test parameter."),
+			cmd1OptionA('a', "alpha", NULL, "A test option.", false),
+			cmd1OptionB('b', "bravo", NULL, "A test option with a value.", true),
+			cmd2("test2", NULL, "Test command 2."),
+			cmd2Param1("A test parameter."),
+			cmd2Param2("A test parameter."),
+			cmd2OptionC('c', "charlie", NULL, "A test option with a value.", true)
+		{
+			this->cmd1.resultFunctionCallback = &ResultCallback;
+			this->cmd1.RegisterParam(&this->cmd1Param);
+			this->cmd1.RegisterOption(&this->cmd1OptionA);
+			this->cmd1.RegisterOption(&this->cmd1OptionB);
+			this->rxController.RegisterCmd(&this->cmd1);
+
+			this->cmd2.resultFunctionCallback = &ResultCallback;
+			this->cmd2.RegisterParam(&this->cmd2Param1);
+			this->cmd2.RegisterParam(&this->cmd2Param2);
+			this->cmd2.RegisterOption(&this->cmd2OptionC);
+			this->rxController.RegisterCmd(&this->cmd2);
+
+			this->rxController.cmdUnrecogCallback =
+				MCallbacks::CallbackGen<StreamUnrecogCallbackClass, void, char*>(&this->unrecogCallbackClass, &StreamUnrecogCallbackClass::Callback);
+		}
+	};
+
+	//! @brief		Writes msg to rxBuff in chunks of chunkSize characters, followed by the end-of-command character.
+	static void WriteInChunks(RxBuff& rxBuff, const char* msg, size_t chunkSize)
+	{
+		size_t msgLen = strlen(msg);
+		for(size_t pos = 0; pos < msgLen; pos += chunkSize)
+			rxBuff.WriteBytes(&msg[pos], (msgLen - pos < chunkSize) ? msgLen - pos : chunkSize);
+		rxBuff.WriteChar('\n');
+	}
+
+	MTEST(RxBuffStreamingMatchesRunTest)
+	{
+		bool enableCmdLinePrinting = Print::enableCmdLinePrinting;
+		bool enableErrorPrinting = Print::enableErrorPrinting;
+		Print::enableCmdLinePrinting = false;
+		Print::enableErrorPrinting = false;
+
+		StreamingParser parser;
+		parser.rxController.Freeze();
+
+		RxBuff rxBuff(&parser.rxController, '\n');
+		rxBuff.SetStreaming(true);
+		CHECK_EQUAL(rxBuff.IsStreaming(), true);
+
+		char expected[200];
+		for(uint32_t x = 0; x < numStreamMsgs; x++)
+		{
+			_resultStr[0] = '\0';
+			parser.rxController.Run(streamMsgA[x]);
+			strcpy(expected, _resultStr);
+
+			// Every chunk size, including one character at a time
+			for(size_t chunkSize = 1; chunkSize <= 8; chunkSize++)
+			{
+				_resultStr[0] = '\0';
+				WriteInChunks(rxBuff, streamMsgA[x], chunkSize);
+				CHECK_EQUAL(strcmp(_resultStr, expected), 0);
+			}
+
+			// One character at a time with WriteChar()
+			_resultStr[0] = '\0';
+			for(const char* c = streamMsgA[x]; *c != '\0'; c++)
+				rxBuff.WriteChar(*c);
+			rxBuff.WriteChar('\n');
+			CHECK_EQUAL(strcmp(_resultStr, expected), 0);
+		}
+
+		Print::enableCmdLinePrinting = enableCmdLinePrinting;
+		Print::enableErrorPrinting = enableErrorPrinting;
+
+		// Sanity check the expected results themselves
+		_resultStr[0] = '\0';
+		WriteInChunks(rxBuff, "test1 -b \"a b\" p1", 3);
+		CHECK_EQUAL(strcmp(_resultStr, "test1:0:null:1:\"a b\":p1"), 0);
+	}
+
+	MTEST(RxBuffStreamingUnrecognisedCmdTest)
+	{
+		bool enableCmdLinePrinting = Print::enableCmdLinePrinting;
+		Print::enableCmdLinePrinting = false;
+
+		StreamingParser parser;
+		RxBuff rxBuff(&parser.rxController, '\n');
+		rxBuff.SetStreaming(true);
+
+		_numUnrecogCmds = 0;
+		_resultStr[0] = '\0';
+		rxBuff.WriteString("tes");
+		rxBuff.WriteString("t4 p1 p2\n");
+
+		Print::enableCmdLinePrinting = enableCmdLinePrinting;
+
+		CHECK_EQUAL(_numUnrecogCmds, 1);
+		CHECK_EQUAL(strcmp(_resultStr, "unrecog:test4"), 0);
+	}
+
+	MTEST(RxBuffStreamingCapacityTest)
+	{
+		StreamingParser parser;
+		char buff[12];
+		RxBuff rxBuff(&parser.rxController, '\n', buff, sizeof(buff));
+		rxBuff.SetStreaming(true);
+
+		// One character is kept for the null character after the last argument
+		_resultStr[0] = '\0';
+		CHECK_EQUAL(rxBuff.WriteString("test1 p1234"), true);
+		CHECK_EQUAL(rxBuff.WriteString("\n"), true);
+		CHECK_EQUAL(strcmp(_resultStr, "test1:0:null:0:null:p1234"), 0);
+
+		bool enableErrorPrinting = Print::enableErrorPrinting;
+		Print::enableErrorPrinting = false;
+
+		_resultStr[0] = '\0';
+		CHECK_EQUAL(rxBuff.WriteString("test1 p12345"), false);
+		CHECK_EQUAL(rxBuff.WriteString("\n"), true);
+		CHECK_EQUAL(strcmp(_resultStr, "test1:0:null:0:null:p1234"), 0);
+
+		Print::enableErrorPrinting = enableErrorPrinting;
+
+		// Turning streaming off gives back the last character
+		rxBuff.SetStreaming(false);
+		_resultStr[0] = '\0';
+		CHECK_EQUAL(rxBuff.WriteString("test1 p12345"), true);
+		CHECK_EQUAL(rxBuff.WriteString("\n"), true);
+		CHECK_EQUAL(strcmp(_resultStr, "test1:0:null:0:null:p12345"), 0);
+	}
+
+	MTEST(RxBuffStreamingManyArgumentsTest)
+	{
+		const uint32_t numParams = 40;
+
+		Rx rxController;
+		Cmd cmdTest("test", NULL, "A test command.");
+		cmdTest.resultFunctionCallback = &ResultCallback;
+		Param* paramA[numParams];
+		for(uint32_t x = 0; x < numParams; x++)
+		{
+			paramA[x] = new Param("A test parameter.");
+			cmdTest.RegisterParam(paramA[x]);
+		}
+		rxController.RegisterCmd(&cmdTest);
+
+		RxBuff rxBuff(&rxController, '\n');
+		rxBuff.SetStreaming(true);
+
+		// More arguments than are stored inline, twice, so the grown argument array is reused
+		for(uint32_t run = 0; run < 2; run++)
+		{
+			_resultStr[0] = '\0';
+			for(uint32_t x = 0; x < numParams; x++)
+				rxBuff.WriteString((x == 0) ? "test p" : " p");
+			rxBuff.WriteChar('\n');
+
+			// Command name, then the parameters
+			CHECK_EQUAL(strncmp(_resultStr, "test:p:p:", 9), 0);
+			CHECK_EQUAL(strlen(_resultStr), 4 + 2*numParams);
+			CHECK_EQUAL(paramA[numParams - 1]->value, "p");
+		}
+
+		for(uint32_t x = 0; x < numParams; x++)
+			delete paramA[x];
+	}
+
+} // namespace MClideTest
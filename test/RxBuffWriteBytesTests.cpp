@@ -0,0 +1,151 @@
+//!
+//! @file 			RxBuffWriteBytesTests.cpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! @created		2026-10-16
+//! @last-modified 	2026-10-16
+//! @brief 			Contains test functions for writing chunks of characters to RxBuff with RxBuff::WriteBytes().
+//! @details
+//!					See README.rst in root dir for more info.
+
+//===== SYSTEM LIBRARIES =====//
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+//====== USER LIBRARIES =====//
+#include "MUnitTest/api/MUnitTestApi.hpp"
+
+//===== USER SOURCE =====//
+#include "../api/MClideApi.hpp"
+
+using namespace MbeddedNinja::MClideNs;
+
+namespace MClideTest
+{
+
+	static uint32_t _numCallbacks = 0;
+	static uint32_t _paramSum = 0;
+
+	static bool Callback(Cmd *cmd)
+	{
+		_numCallbacks++;
+		_paramSum += atoi(cmd->paramA[0]->value.cStr);
+		return true;
+	}
+
+	MTEST(WriteBytesManyCmdsInOneChunkTest)
+	{
+		Rx rxController;
+		RxBuff rxBuff(&rxController, '\n');
+
+		Cmd cmdTest("test", &Callback, "A test command.");
+		Param cmdTestParam("A test parameter.");
+		cmdTest.RegisterParam(&cmdTestParam);
+		rxController.RegisterCmd(&cmdTest);
+
+		// A 4KB chunk holding as many complete commands as fit
+		char chunk[4096];
+		size_t chunkLen = 0;
+		uint32_t numCmds = 0;
+		uint32_t paramSum = 0;
+		while(chunkLen + 20 < sizeof(chunk))
+		{
+			chunkLen += snprintf(&chunk[chunkLen], sizeof(chunk) - chunkLen, "test %u\n", (unsigned int)numCmds);
+			paramSum += numCmds;
+			numCmds++;
+		}
+
+		_numCallbacks = 0;
+		_paramSum = 0;
+		CHECK_EQUAL(rxBuff.WriteBytes(chunk, chunkLen), true);
+		CHECK_EQUAL(_numCallbacks, numCmds);
+		CHECK_EQUAL(_paramSum, paramSum);
+	}
+
+	MTEST(WriteBytesCmdsSplitAcrossChunksTest)
+	{
+		Rx rxController;
+		RxBuff rxBuff(&rxController, '\n');
+
+		Cmd cmdTest("test", &Callback, "A test command.");
+		Param cmdTestParam("A test parameter.");
+		cmdTest.RegisterParam(&cmdTestParam);
+		rxController.RegisterCmd(&cmdTest);
+
+		const char* msg = "test 1\ntest 22\n\ntest 333\ntest 4444\ntest 55555\n";
+		size_t msgLen = strlen(msg);
+
+		// Every way of splitting the message into three chunks gives the same result
+		for(size_t split1 = 0; split1 <= msgLen; split1++)
+		{
+			for(size_t split2 = split1; split2 <= msgLen; split2++)
+			{
+				_numCallbacks = 0;
+				_paramSum = 0;
+				rxBuff.WriteBytes(msg, split1);
+				rxBuff.WriteBytes(&msg[split1], split2 - split1);
+				rxBuff.WriteBytes(&msg[split2], msgLen - split2);
+				CHECK_EQUAL(_numCallbacks, 5);
+				CHECK_EQUAL(_paramSum, 1 + 22 + 333 + 4444 + 55555);
+			}
+		}
+	}
+
+	MTEST(WriteBytesNotNullTerminatedTest)
+	{
+		Rx rxController;
+		RxBuff rxBuff(&rxController, '\r');
+
+		Cmd cmdTest("test", &Callback, "A test command.");
+		Param cmdTestParam("A test parameter.");
+		cmdTest.RegisterParam(&cmdTestParam);
+		rxController.RegisterCmd(&cmdTest);
+
+		// Only the first 8 characters are written, the rest must be ignored
+		const char msg[] = "test 12\rtest 99\r";
+
+		_numCallbacks = 0;
+		_paramSum = 0;
+		CHECK_EQUAL(rxBuff.WriteBytes(msg, 8), true);
+		CHECK_EQUAL(_numCallbacks, 1);
+		CHECK_EQUAL(_paramSum, 12);
+	}
+
+	MTEST(WriteBytesLongCmdIsTruncatedTest)
+	{
+		Rx rxController;
+		RxBuff rxBuff(&rxController, '\n');
+
+		Cmd cmdTest("test", &Callback, "A test command.");
+		Param cmdTestParam("A test parameter.");
+		cmdTest.RegisterParam(&cmdTestParam);
+		rxController.RegisterCmd(&cmdTest);
+
+		bool enableErrorPrinting = Print::enableErrorPrinting;
+		bool enableCmdLinePrinting = Print::enableCmdLinePrinting;
+		Print::enableErrorPrinting = false;
+		Print::enableCmdLinePrinting = false;
+
+		// A parameter longer than the buffer, written in two parts
+		char longParam[clide_RX_BUFF_SIZE + 50];
+		memset(longParam, '1', sizeof(longParam));
+
+		_numCallbacks = 0;
+		CHECK_EQUAL(rxBuff.WriteBytes("test ", 5), true);
+		CHECK_EQUAL(rxBuff.WriteBytes(longParam, sizeof(longParam)), false);
+		CHECK_EQUAL(rxBuff.WriteBytes("\n", 1), true);
+		CHECK_EQUAL(_numCallbacks, 1);
+		CHECK_EQUAL(cmdTestParam.value.cStr[clide_RX_BUFF_SIZE - 5 - 1], '1');
+		CHECK_EQUAL(strlen(cmdTestParam.value.cStr), clide_RX_BUFF_SIZE - 5);
+
+		// The buffer is usable again afterwards
+		_paramSum = 0;
+		CHECK_EQUAL(rxBuff.WriteBytes("test 7\n", 7), true);
+		CHECK_EQUAL(_numCallbacks, 2);
+		CHECK_EQUAL(_paramSum, 7);
+
+		Print::enableErrorPrinting = enableErrorPrinting;
+		Print::enableCmdLinePrinting = enableCmdLinePrinting;
+	}
+
+} // namespace MClideTest
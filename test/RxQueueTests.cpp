@@ -0,0 +1,165 @@
+//!
+//! @file 			RxQueueTests.cpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! @created		2026-10-16
+//! @last-modified 	2026-10-16
+//! @brief 			Contains test functions for RxQueue, the single-producer/single-consumer queue in front of RxBuff.
+//! @details
+//!					See README.rst in root dir for more info.
+
+//===== SYSTEM LIBRARIES =====//
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <thread>
+#include <atomic>
+
+//====== USER LIBRARIES =====//
+#include "MUnitTest/api/MUnitTestApi.hpp"
+
+//===== USER SOURCE =====//
+#include "../api/MClideApi.hpp"
+
+using namespace MbeddedNinja::MClideNs;
+
+namespace MClideTest
+{
+
+	//! @brief		The number of commands received by the result callback.
+	static std::atomic<uint32_t> _numQueuedCmds(0);
+
+	//! @brief		The number of commands whose parameter was not the expected sequence number.
+	static uint32_t _numOutOfOrder = 0;
+
+	//! @brief		Each command's parameter is a sequence number, which must arrive in order.
+	static bool SequenceCallback(const ParseResult& result)
+	{
+		uint32_t seqNum = (uint32_t)strtoul(result.GetParam(0), NULL, 10);
+		if(seqNum != _numQueuedCmds.load())
+			_numOutOfOrder++;
+		_numQueuedCmds++;
+		return true;
+	}
+
+	//! @brief		Owns a frozen Rx with one command, and an RxBuff.
+	class QueueParser
+	{
+		public:
+
+		Rx rxController;
+		Cmd cmdTest;
+		Param cmdTestParam;
+		RxBuff rxBuff;
+
+		QueueParser() :
+			cmdTest("test", NULL, "A test command."),
+			cmdTestParam("A test parameter."),
+			rxBuff(&rxController, '\n')
+		{
+			this->cmdTest.resultFunctionCallback = &SequenceCallback;
+			this->cmdTest.RegisterParam(&this->cmdTestParam);
+			this->rxController.RegisterCmd(&this->cmdTest);
+			this->rxController.Freeze();
+
+			_numQueuedCmds = 0;
+			_numOutOfOrder = 0;
+		}
+	};
+
+	MTEST(RxQueueBasicTest)
+	{
+		QueueParser parser;
+		StaticRxQueue<64> rxQueue(&parser.rxBuff);
+		CHECK_EQUAL(rxQueue.GetCapacity(), 64);
+
+		// Nothing runs until the consumer drains the queue
+		CHECK_EQUAL(rxQueue.Write("test 0\ntest 1\nte", 16), 16);
+		CHECK_EQUAL(rxQueue.GetNumQueued(), 16);
+		CHECK_EQUAL(_numQueuedCmds.load(), 0);
+
+		CHECK_EQUAL(rxQueue.Drain(), 16);
+		CHECK_EQUAL(rxQueue.GetNumQueued(), 0);
+		CHECK_EQUAL(_numQueuedCmds.load(), 2);
+
+		// The partial command is completed by the next drain
+		CHECK_EQUAL(rxQueue.WriteChar('s'), true);
+		CHECK_EQUAL(rxQueue.Write("t 2\n", 4), 4);
+		CHECK_EQUAL(rxQueue.Drain(), 5);
+		CHECK_EQUAL(rxQueue.Drain(), 0);
+		CHECK_EQUAL(_numQueuedCmds.load(), 3);
+		CHECK_EQUAL(_numOutOfOrder, 0);
+	}
+
+	MTEST(RxQueueWrapAroundTest)
+	{
+		QueueParser parser;
+		RxQueue rxQueue(&parser.rxBuff, 16);
+
+		// Messages are not a factor of the ring size, so they wrap around the end at every position
+		char msg[20];
+		for(uint32_t x = 0; x < 100; x++)
+		{
+			int msgLen = snprintf(msg, sizeof(msg), "test %u\n", (unsigned int)x);
+			CHECK_EQUAL(rxQueue.Write(msg, msgLen), (uint32_t)msgLen);
+			rxQueue.Drain();
+		}
+
+		CHECK_EQUAL(_numQueuedCmds.load(), 100);
+		CHECK_EQUAL(_numOutOfOrder, 0);
+		CHECK_EQUAL(rxQueue.GetNumDropped(), 0);
+	}
+
+	MTEST(RxQueueFullTest)
+	{
+		QueueParser parser;
+		StaticRxQueue<8> rxQueue(&parser.rxBuff);
+
+		// Whatever does not fit is dropped and counted
+		CHECK_EQUAL(rxQueue.Write("test 0\ntest 1\n", 14), 8);
+		CHECK_EQUAL(rxQueue.WriteChar('x'), false);
+		CHECK_EQUAL(rxQueue.GetNumDropped(), 7);
+		CHECK_EQUAL(rxQueue.GetNumQueued(), 8);
+
+		CHECK_EQUAL(rxQueue.Drain(), 8);
+		CHECK_EQUAL(_numQueuedCmds.load(), 1);
+
+		// Room again once drained
+		CHECK_EQUAL(rxQueue.WriteChar('x'), true);
+	}
+
+	MTEST(RxQueueProducerConsumerThreadsTest)
+	{
+		const uint32_t numMsgs = 20000;
+
+		QueueParser parser;
+		StaticRxQueue<64> rxQueue(&parser.rxBuff);
+
+		// The consumer drains and runs the commands on its own thread
+		std::atomic<bool> stop(false);
+		std::thread consumer([&rxQueue, &stop]()
+		{
+			while(!stop.load())
+				rxQueue.Drain();
+			rxQueue.Drain();
+		});
+
+		// The producer never drops anything, it retries whatever did not fit
+		char msg[20];
+		for(uint32_t x = 0; x < numMsgs; x++)
+		{
+			uint32_t msgLen = (uint32_t)snprintf(msg, sizeof(msg), "test %u\n", (unsigned int)x);
+			uint32_t numWritten = 0;
+			while(numWritten < msgLen)
+				numWritten += rxQueue.Write(&msg[numWritten], msgLen - numWritten);
+		}
+
+		while(rxQueue.GetNumQueued() != 0)
+			std::this_thread::yield();
+		stop = true;
+		consumer.join();
+
+		CHECK_EQUAL(_numQueuedCmds.load(), numMsgs);
+		CHECK_EQUAL(_numOutOfOrder, 0);
+	}
+
+} // namespace MClideTest
@@ -2,7 +2,7 @@
 //! @file 			StandardMainVariablesAsInputTests.cpp
 //! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
 //! @created		2014-03-26
-//! @last-modified 	2014-10-07
+//! @last-modified 	2026-10-16
 //! @brief 			Contains test functions when standard main variables argc and argv variables are used an input.
 //! @details
 //!					See README.rst in root dir for more info.
@@ -57,7 +57,7 @@ namespace MClideTest
 		rxController.Run(argc, argv);
 
 		// Make sure the command WAS NOT detected
-		CHECK_EQUAL(cmdTestOption.isDetected, false);
+		CHECK_EQUAL(cmdTestOption.IsDetected(), false);
 
 		//Clide::Print::enableCmdLinePrinting = false;
 		//Clide::Print::enableErrorPrinting = false;
@@ -98,7 +98,7 @@ namespace MClideTest
 		rxController.Run(argc, argv);
 
 		CHECK_EQUAL(cmdTestParam.value, "param1");
-		CHECK_EQUAL(cmdTestOption.isDetected, true);
+		CHECK_EQUAL(cmdTestOption.IsDetected(), true);
 	}
 
 
@@ -135,7 +135,7 @@ namespace MClideTest
 		rxController.Run(argc, argv);
 
 		CHECK_EQUAL(cmdTestParam.value, "param1");
-		CHECK_EQUAL(cmdTestOption.isDetected, true);
+		CHECK_EQUAL(cmdTestOption.IsDetected(), true);
 	}
 
 	MTEST(TwoParamTwoOptionArgvRxTest1)
@@ -180,8 +180,8 @@ namespace MClideTest
 
 		CHECK_EQUAL(cmdTestParam1.value, "param1");
 		CHECK_EQUAL(cmdTestParam2.value, "param2");
-		CHECK_EQUAL(cmdTestOption1.isDetected, true);
-		CHECK_EQUAL(cmdTestOption2.isDetected, true);
+		CHECK_EQUAL(cmdTestOption1.IsDetected(), true);
+		CHECK_EQUAL(cmdTestOption2.IsDetected(), true);
 	}
 
 	MTEST(TwoParamTwoOptionArgvRxTest2)
@@ -226,8 +226,8 @@ namespace MClideTest
 
 		CHECK_EQUAL(cmdTestParam1.value, "param1");
 		CHECK_EQUAL(cmdTestParam2.value, "param2");
-		CHECK_EQUAL(cmdTestOption1.isDetected, true);
-		CHECK_EQUAL(cmdTestOption2.isDetected, true);
+		CHECK_EQUAL(cmdTestOption1.IsDetected(), true);
+		CHECK_EQUAL(cmdTestOption2.IsDetected(), true);
 	}
 
 	MTEST(TwoParamTwoOptionArgvRxTest3)
@@ -272,8 +272,8 @@ namespace MClideTest
 
 		CHECK_EQUAL(cmdTestParam1.value, "param1");
 		CHECK_EQUAL(cmdTestParam2.value, "param2");
-		CHECK_EQUAL(cmdTestOption1.isDetected, true);
-		CHECK_EQUAL(cmdTestOption2.isDetected, true);
+		CHECK_EQUAL(cmdTestOption1.IsDetected(), true);
+		CHECK_EQUAL(cmdTestOption2.IsDetected(), true);
 
 		// Create standard main variables
 		argv[0] = (char*)"test";
@@ -288,8 +288,8 @@ namespace MClideTest
 
 		CHECK_EQUAL(cmdTestParam1.value, "param1");
 		CHECK_EQUAL(cmdTestParam2.value, "param2");
-		CHECK_EQUAL(cmdTestOption1.isDetected, false);
-		CHECK_EQUAL(cmdTestOption2.isDetected, false);
+		CHECK_EQUAL(cmdTestOption1.IsDetected(), false);
+		CHECK_EQUAL(cmdTestOption2.IsDetected(), false);
 	}
 
 	MTEST(IgnoreFirstElementOfArgvRxTest)
@@ -327,7 +327,7 @@ namespace MClideTest
 		rxController.Run(argc, argv);
 
 		CHECK_EQUAL(cmdTestParam.value, "param1");
-		CHECK_EQUAL(cmdTestOption.isDetected, true);
+		CHECK_EQUAL(cmdTestOption.IsDetected(), true);
 	}
 
 } // namespace MClideTest
@@ -0,0 +1,259 @@
+//!
+//! @file 			StaticCmdTableTests.cpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! @created		2026-10-17
+//! @last-modified 	2026-10-17
+//! @brief 			Contains test functions for command tables built at compile time (StaticCmdTable and StaticRx).
+//! @details
+//!					See README.rst in root dir for more info.
+
+//===== SYSTEM LIBRARIES =====//
+#include <stdio.h>
+#include <string>
+
+//====== USER LIBRARIES =====//
+#include "MUnitTest/api/MUnitTestApi.hpp"
+
+//===== USER SOURCE =====//
+#include "../api/MClideApi.hpp"
+
+using namespace MbeddedNinja::MClideNs;
+
+namespace MClideTest
+{
+
+	static uint32_t _numStaticCalls = 0;
+	static const StaticCmd* _staticCmd = NULL;
+	static bool _staticVerbose = false;
+	static bool _staticAll = false;
+	static std::string _staticLevel;
+	static std::string _staticParam0;
+	static std::string _staticParam1;
+
+	//! @brief		Records what was received.
+	static bool StaticCallback(const StaticParseResult& result)
+	{
+		_numStaticCalls++;
+		_staticCmd = result.GetCmd();
+		_staticVerbose = result.IsDetected(0);
+		_staticAll = result.IsDetected(2);
+		_staticLevel = (result.GetValue(1) != NULL) ? result.GetValue(1) : "";
+		_staticParam0 = (result.GetParam(0) != NULL) ? result.GetParam(0) : "";
+		_staticParam1 = (result.GetParam(1) != NULL) ? result.GetParam(1) : "";
+		return true;
+	}
+
+	// Everything below is built by the compiler
+	constexpr StaticOption _staticCopyOptionA[] = {
+		StaticOption('v', "verbose", "Verbose.", false),
+		StaticOption('l', "level", "The level.", true),
+		StaticOption('a', "all", "Everything.", false),
+	};
+
+	constexpr StaticParam _staticCopyParamA[] = {
+		StaticParam("The source."),
+		StaticParam("The destination."),
+	};
+
+	constexpr StaticCmd _staticCmdA[] = {
+		StaticCmd("stop", "Stops.", &StaticCallback),
+		StaticCmd("copy", "Copies.", &StaticCallback, _staticCopyOptionA, _staticCopyParamA),
+		StaticCmd("reset", "Resets.", &StaticCallback, _staticCopyOptionA),
+		StaticCmd("stop", "Never found, the first 'stop' wins.", NULL),
+	};
+
+	constexpr StaticCmdTable<sizeof(_staticCmdA)/sizeof(_staticCmdA[0])> _staticCmdTable(_staticCmdA);
+
+	static_assert(StaticCmdTable<4>::NUM_BUCKETS == 4, "Four commands, four buckets.");
+	static_assert(_staticCmdA[1].shortOptionIndexA['l'] == 2, "Short option table is built by the compiler.");
+	static_assert(_staticCmdA[1].shortOptionIndexA['x'] == 0, "No option with this short name.");
+
+	//! @brief		Collects everything StaticRx prints.
+	class StaticRecorder
+	{
+		public:
+		void CmdLine(const char* msg)
+		{
+			this->output += msg;
+		}
+
+		std::string output;
+	};
+
+	MTEST(StaticCmdTableHashTest)
+	{
+		// The compile-time hash has to agree with the one used on received names
+		CHECK_EQUAL(HashIndex::ConstHash("copy"), HashIndex::Hash("copy", 4));
+		CHECK_EQUAL(HashIndex::ConstHash(""), HashIndex::Hash("", 0));
+		CHECK_EQUAL(_staticCmdA[1].nameHash, HashIndex::Hash("copy", 4));
+		CHECK_EQUAL(_staticCmdA[1].nameLen, 4);
+		CHECK_EQUAL(_staticCopyOptionA[0].longNameLen, 7);
+
+		StaticRx staticRx(_staticCmdTable);
+		CHECK_EQUAL(staticRx.FindCmd("copy", 4) == &_staticCmdA[1], true);
+		CHECK_EQUAL(staticRx.FindCmd("reset-all", 5) == &_staticCmdA[2], true);
+		CHECK_EQUAL(staticRx.FindCmd("stop", 4) == &_staticCmdA[0], true);
+		CHECK_EQUAL(staticRx.FindCmd("sto", 3) == nullptr, true);
+		CHECK_EQUAL(staticRx.FindCmd("go", 2) == nullptr, true);
+	}
+
+	MTEST(StaticCmdTableRunTest)
+	{
+		StaticRx staticRx(_staticCmdTable);
+
+		_numStaticCalls = 0;
+		CHECK_EQUAL(staticRx.Run("stop"), true);
+		CHECK_EQUAL(_numStaticCalls, 1);
+		CHECK_EQUAL(_staticCmd == &_staticCmdA[0], true);
+
+		// Short options, clustered, with a value in the same argument
+		CHECK_EQUAL(staticRx.Run("copy -va -l3 src dst"), true);
+		CHECK_EQUAL(_numStaticCalls, 2);
+		CHECK_EQUAL(_staticCmd == &_staticCmdA[1], true);
+		CHECK_EQUAL(_staticVerbose, true);
+		CHECK_EQUAL(_staticAll, true);
+		CHECK_EQUAL(_staticLevel == "3", true);
+		CHECK_EQUAL(_staticParam0 == "src", true);
+		CHECK_EQUAL(_staticParam1 == "dst", true);
+
+		// Long options, with the value in the next argument, after '=' and as a unique prefix
+		CHECK_EQUAL(staticRx.Run("copy src --level 7 dst --verb"), true);
+		CHECK_EQUAL(_staticVerbose, true);
+		CHECK_EQUAL(_staticAll, false);
+		CHECK_EQUAL(_staticLevel == "7", true);
+		CHECK_EQUAL(_staticParam0 == "src", true);
+		CHECK_EQUAL(_staticParam1 == "dst", true);
+
+		CHECK_EQUAL(staticRx.Run("copy --level=-1 src -- -dst"), true);
+		CHECK_EQUAL(_staticVerbose, false);
+		CHECK_EQUAL(_staticLevel == "-1", true);
+		CHECK_EQUAL(_staticParam1 == "-dst", true);
+
+		// Unrecognised options are ignored, like Rx
+		CHECK_EQUAL(staticRx.Run("reset -q --quiet -a"), true);
+		CHECK_EQUAL(_staticCmd == &_staticCmdA[2], true);
+		CHECK_EQUAL(_staticAll, true);
+
+		// Message does not have to be null-terminated
+		CHECK_EQUAL(staticRx.Run("stopped", 4), true);
+		CHECK_EQUAL(_staticCmd == &_staticCmdA[0], true);
+		CHECK_EQUAL(_numStaticCalls, 6);
+	}
+
+	MTEST(StaticCmdTableErrorTest)
+	{
+		StaticRx staticRx(_staticCmdTable);
+		StaticRecorder recorder;
+		staticRx.printSink.cmdLinePrintCallback =
+			MCallbacks::CallbackGen<StaticRecorder, void, const char*>(&recorder, &StaticRecorder::CmdLine);
+
+		_numStaticCalls = 0;
+		CHECK_EQUAL(staticRx.Run("go"), false);
+		CHECK_EQUAL(recorder.output == "error \"Command 'go' not recognised.\"\r\n", true);
+
+		recorder.output.clear();
+		CHECK_EQUAL(staticRx.Run("copy src"), false);
+		CHECK_EQUAL(recorder.output ==
+			"error \"Num. of received parameters ('1') does not match num. registered for cmd ('2').\"\r\n", true);
+
+		recorder.output.clear();
+		CHECK_EQUAL(staticRx.Run("  "), false);
+		CHECK_EQUAL(recorder.output == "error \"Received command contained no alpha-numeric characters.\"\r\n", true);
+
+		CHECK_EQUAL(_numStaticCalls, 0);
+	}
+
+	MTEST(StaticCmdTableOptionRulesTest)
+	{
+		// Options follow the same rules as Rx, since both use BasicOptionParser
+		StaticRx staticRx(_staticCmdTable);
+		StaticRecorder recorder;
+		staticRx.printSink.cmdLinePrintCallback =
+			MCallbacks::CallbackGen<StaticRecorder, void, const char*>(&recorder, &StaticRecorder::CmdLine);
+
+		// Unknown options and a missing value are ignored, an unambiguous prefix is accepted
+		_numStaticCalls = 0;
+		CHECK_EQUAL(staticRx.Run("reset --bogus -x --verb --level"), true);
+		CHECK_EQUAL(_numStaticCalls, 1);
+		CHECK_EQUAL(_staticVerbose, true);
+		CHECK_EQUAL(_staticLevel == "", true);
+		CHECK_EQUAL(recorder.output == "", true);
+
+		// Help is printed instead of calling the callback, even though the parameters are missing
+		_numStaticCalls = 0;
+		CHECK_EQUAL(staticRx.Run("copy -v --help"), true);
+		CHECK_EQUAL(_numStaticCalls, 0);
+		CHECK_EQUAL(recorder.output ==
+			"\r\n**********COMMAND HELP:**********\r\n"
+			"\tcopy\tCopies.\r\n"
+			"Command Parameters:\r\n"
+			"\tindex\tdescription\r\n"
+			"\t0\tThe source.\r\n"
+			"\t1\tThe destination.\r\n"
+			"Command Options:\r\n"
+			"\tshort\tlong\tdescription\r\n"
+			"\th\thelp\tPrints help for the command.\r\n"
+			"\tv\tverbose\tVerbose.\r\n"
+			"\tl\tlevel\tThe level.\r\n"
+			"\ta\tall\tEverything.\r\n", true);
+
+		recorder.output.clear();
+		CHECK_EQUAL(staticRx.Run("stop -h"), true);
+		CHECK_EQUAL(recorder.output.find("\tNO PARAMS\r\n") != std::string::npos, true);
+	}
+
+	constexpr StaticOption _staticNullOptionA[] = {
+		StaticOption('q', nullptr, nullptr, false),
+	};
+
+	constexpr StaticParam _staticNullParamA[] = {
+		StaticParam(nullptr),
+	};
+
+	constexpr StaticCmd _staticNullCmdA[] = {
+		StaticCmd("bare", nullptr, &StaticCallback, _staticNullOptionA, _staticNullParamA),
+	};
+
+	constexpr StaticCmdTable<sizeof(_staticNullCmdA)/sizeof(_staticNullCmdA[0])> _staticNullCmdTable(_staticNullCmdA);
+
+	MTEST(StaticCmdTableNullDescriptionTest)
+	{
+		// Missing descriptions are printed as empty strings, like a missing long name
+		StaticRx staticRx(_staticNullCmdTable);
+		StaticRecorder recorder;
+		staticRx.printSink.cmdLinePrintCallback =
+			MCallbacks::CallbackGen<StaticRecorder, void, const char*>(&recorder, &StaticRecorder::CmdLine);
+
+		CHECK_EQUAL(staticRx.Run("bare -h"), true);
+		CHECK_EQUAL(recorder.output ==
+			"\r\n**********COMMAND HELP:**********\r\n"
+			"\tbare\t\r\n"
+			"Command Parameters:\r\n"
+			"\tindex\tdescription\r\n"
+			"\t0\t\r\n"
+			"Command Options:\r\n"
+			"\tshort\tlong\tdescription\r\n"
+			"\th\thelp\tPrints help for the command.\r\n"
+			"\tq\t\t\r\n", true);
+	}
+
+	MTEST(StaticCmdTableArenaTest)
+	{
+		// More arguments than fit on the stack come out of the arena, and are freed after each Run()
+		static uint8_t arenaBuff[1024];
+		ParseArena arena(arenaBuff, sizeof(arenaBuff));
+		StaticRx staticRx(_staticCmdTable);
+		staticRx.parseArena = &arena;
+
+		std::string msg = "reset";
+		for(uint32_t x = 0; x < clide_NUM_INLINE_ARGS + 4; x++)
+			msg += " -v";
+
+		_numStaticCalls = 0;
+		CHECK_EQUAL(staticRx.Run(msg.c_str()), true);
+		CHECK_EQUAL(_numStaticCalls, 1);
+		CHECK_EQUAL(_staticVerbose, true);
+		CHECK_EQUAL(arena.GetUsed(), 0);
+	}
+
+} // namespace MClideTest
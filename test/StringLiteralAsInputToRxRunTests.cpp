@@ -2,7 +2,7 @@
 //! @file 			StringLiteralAsInputToRxRunTests.cpp
 //! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
 //! @created		2014-01-21
-//! @last-modified 	2014-10-07
+//! @last-modified 	2026-10-16
 //! @brief 			Contains test functions for directly inputting a string literal to Rx::Run().
 //! @details
 //!					See README.rst in root dir for more info.
@@ -44,7 +44,7 @@ namespace MClideTest
 
 		// Check that the command was processed successfully
 		CHECK_EQUAL(cmdTestParam.value, "param1");
-		CHECK_EQUAL(cmdTestOption.isDetected, true);
+		CHECK_EQUAL(cmdTestOption.IsDetected(), true);
 	}
 		
 } // namespace MClideTest
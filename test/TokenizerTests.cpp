@@ -0,0 +1,173 @@
+//!
+//! @file 			TokenizerTests.cpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! @created		2026-10-16
+//! @last-modified 	2026-10-16
+//! @brief 			Contains test functions for the Tokenizer, and for running Rx on read-only, non-null-terminated and long messages.
+//! @details
+//!					See README.rst in root dir for more info.
+
+//===== SYSTEM LIBRARIES =====//
+#include <stdio.h>
+#include <string.h>
+
+//====== USER LIBRARIES =====//
+#include "MUnitTest/api/MUnitTestApi.hpp"
+
+//===== USER SOURCE =====//
+#include "../api/MClideApi.hpp"
+#include "../include/Tokenizer.hpp"
+
+using namespace MbeddedNinja::MClideNs;
+
+namespace MClideTest
+{
+
+	static bool Callback(Cmd *cmd)
+	{
+		return true;
+	}
+
+	MTEST(TokenizerBasicTest)
+	{
+		const char* msg = "  test  param1 -a ";
+		TokenView tokenA[5];
+
+		uint32_t numTokens = Tokenizer::Run(msg, strlen(msg), ' ', tokenA, 5);
+
+		CHECK_EQUAL(numTokens, 3);
+		CHECK_EQUAL(tokenA[0].offset, 2);
+		CHECK_EQUAL(tokenA[0].length, 4);
+		CHECK_EQUAL(tokenA[1].offset, 8);
+		CHECK_EQUAL(tokenA[1].length, 6);
+		CHECK_EQUAL(tokenA[2].offset, 15);
+		CHECK_EQUAL(tokenA[2].length, 2);
+	}
+
+	MTEST(TokenizerQuotesTest)
+	{
+		// Delimiters inside quotes do not split, the quotes stay part of the token
+		const char* msg = "test \"a b\" c\"d e\"f \"unterminated g";
+		TokenView tokenA[5];
+
+		uint32_t numTokens = Tokenizer::Run(msg, strlen(msg), ' ', tokenA, 5);
+
+		CHECK_EQUAL(numTokens, 4);
+		CHECK_EQUAL(strncmp(&msg[tokenA[1].offset], "\"a b\"", tokenA[1].length), 0);
+		CHECK_EQUAL(tokenA[1].length, 5);
+		CHECK_EQUAL(strncmp(&msg[tokenA[2].offset], "c\"d e\"f", tokenA[2].length), 0);
+		CHECK_EQUAL(tokenA[2].length, 7);
+		// Unterminated quote runs to the end of the message
+		CHECK_EQUAL(tokenA[3].offset + tokenA[3].length, strlen(msg));
+	}
+
+	MTEST(TokenizerCountsTokensPastMaxTest)
+	{
+		const char* msg = "a b c d";
+		TokenView tokenA[2];
+
+		uint32_t numTokens = Tokenizer::Run(msg, strlen(msg), ' ', tokenA, 2);
+
+		CHECK_EQUAL(numTokens, 4);
+		CHECK_EQUAL(tokenA[1].offset, 2);
+	}
+
+	MTEST(RunReadOnlyNotNullTerminatedTest)
+	{
+		Rx rxController;
+
+		Cmd cmdTest("test", &Callback, "A test command.");
+		Param cmdTestParam("A test parameter.");
+		cmdTest.RegisterParam(&cmdTestParam);
+		Option cmdTestOption('a', "", NULL, "A test option.", true);
+		cmdTest.RegisterOption(&cmdTestOption);
+		rxController.RegisterCmd(&cmdTest);
+
+		// Only the first part of the buffer is the message, the rest must be ignored
+		static const char msg[] = "test -a \"-8\" param1GARBAGE";
+		const char* msgEnd = strstr(msg, "GARBAGE");
+
+		CHECK_EQUAL(rxController.Run(msg, (size_t)(msgEnd - msg)), true);
+
+		CHECK_EQUAL(cmdTest.IsDetected(), true);
+		CHECK_EQUAL(cmdTestOption.value, "\"-8\"");
+		CHECK_EQUAL(cmdTestParam.value, "param1");
+
+		// Message must be untouched
+		CHECK_EQUAL(strcmp(msg, "test -a \"-8\" param1GARBAGE"), 0);
+	}
+
+	MTEST(HundredArgumentsTest)
+	{
+		const uint32_t numParams = 99;
+
+		Rx rxController;
+
+		Cmd cmdTest("test", &Callback, "A test command.");
+		Param* paramA[numParams];
+		for(uint32_t x = 0; x < numParams; x++)
+		{
+			paramA[x] = new Param("A test parameter.");
+			cmdTest.RegisterParam(paramA[x]);
+		}
+		rxController.RegisterCmd(&cmdTest);
+
+		// Command name plus 99 parameters, far more than fit on the stack
+		char msg[500] = "test";
+		char param[10];
+		for(uint32_t x = 0; x < numParams; x++)
+		{
+			snprintf(param, sizeof(param), " p%u", (unsigned int)x);
+			strcat(msg, param);
+		}
+
+		CHECK_EQUAL(rxController.Run(msg), true);
+		CHECK_EQUAL(cmdTest.IsDetected(), true);
+		CHECK_EQUAL(paramA[0]->value, "p0");
+		CHECK_EQUAL(paramA[50]->value, "p50");
+		CHECK_EQUAL(paramA[98]->value, "p98");
+
+		for(uint32_t x = 0; x < numParams; x++)
+			delete paramA[x];
+	}
+
+	MTEST(HundredArgumentsUsesArenaTest)
+	{
+		const uint32_t numParams = 99;
+
+		Rx rxController;
+
+		static uint8_t arenaBuff[4096];
+		ParseArena arena(arenaBuff, sizeof(arenaBuff));
+		rxController.parseArena = &arena;
+
+		Cmd cmdTest("test", &Callback, "A test command.");
+		Param* paramA[numParams];
+		for(uint32_t x = 0; x < numParams; x++)
+		{
+			paramA[x] = new Param("A test parameter.");
+			cmdTest.RegisterParam(paramA[x]);
+		}
+		rxController.RegisterCmd(&cmdTest);
+
+		char msg[500] = "test";
+		for(uint32_t x = 0; x < numParams; x++)
+			strcat(msg, " a");
+
+		CHECK_EQUAL(rxController.Run(msg), true);
+		CHECK_EQUAL(paramA[98]->value, "a");
+
+		// Everything taken from the arena is given back once Run() returns
+		CHECK_EQUAL(arena.GetUsed(), 0);
+
+		// Too small an arena falls back to the heap
+		ParseArena smallArena(arenaBuff, 16);
+		rxController.parseArena = &smallArena;
+		CHECK_EQUAL(rxController.Run(msg), true);
+		CHECK_EQUAL(smallArena.GetUsed(), 0);
+
+		for(uint32_t x = 0; x < numParams; x++)
+			delete paramA[x];
+	}
+
+} // namespace MClideTest
@@ -0,0 +1,260 @@
+//!
+//! @file 			TypedValueTests.cpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
+//! @created		2026-10-17
+//! @last-modified 	2026-10-17
+//! @brief 			Contains test functions for typed parameters and option values (ValueSpec).
+//! @details
+//!					See README.rst in root dir for more info.
+
+//===== SYSTEM LIBRARIES =====//
+#include <stdio.h>
+#include <stdlib.h>		// strtod()
+#include <string.h>		// memcmp()
+#include <string>
+
+//====== USER LIBRARIES =====//
+#include "MUnitTest/api/MUnitTestApi.hpp"
+
+//===== USER SOURCE =====//
+#include "../api/MClideApi.hpp"
+
+using namespace MbeddedNinja::MClideNs;
+
+namespace MClideTest
+{
+
+	static const char* const _modeNameA[] = { "fast", "slow" };
+
+	static uint32_t _numTypedCalls = 0;
+	static int32_t _typedSpeed = 0;
+	static bool _typedEnable = false;
+	static uint32_t _typedMode = 0;
+	static bool _typedModeReceived = false;
+	static double _typedGain = 0.0;
+
+	//! @brief		Saves the converted values.
+	static bool TypedResultCallback(const ParseResult& result)
+	{
+		_numTypedCalls++;
+		Cmd* cmd = result.GetCmd();
+		_typedSpeed = result.GetTypedParam(0)->int32;
+		_typedEnable = result.GetTypedParam(1)->boolean;
+		_typedModeReceived = result.GetTypedValue(cmd->FindOptionByLongName("mode")) != NULL;
+		if(_typedModeReceived)
+			_typedMode = result.GetTypedValue(cmd->FindOptionByLongName("mode"))->enumIndex;
+		const Value* gain = result.GetTypedValue(cmd->FindOptionByShortName('g'));
+		_typedGain = (gain != NULL) ? gain->float64 : 0.0;
+		return true;
+	}
+
+	//! @brief		Collects the command-line output.
+	class TypedRecorder
+	{
+		public:
+		void CmdLine(const char* msg)
+		{
+			this->output += msg;
+		}
+
+		std::string output;
+	};
+
+	//! @brief		Owns an Rx with "motor <speed> <enable> [--mode fast|slow] [-g gain]".
+	class TypedParser
+	{
+		public:
+
+		Rx rxController;
+		Cmd cmdMotor;
+		Param paramSpeed;
+		Param paramEnable;
+		Option optionMode;
+		Option optionGain;
+		TypedRecorder recorder;
+
+		TypedParser() :
+			cmdMotor("motor", NULL, "Sets the motor."),
+			paramSpeed("The speed."),
+			paramEnable("On or off."),
+			optionMode('m', "mode", NULL, "The mode.", true),
+			optionGain('g', "", NULL, "The gain.", true)
+		{
+			this->paramSpeed.valueSpec = ValueSpec::Int32(0, 5000);
+			this->paramEnable.valueSpec = ValueSpec::Bool();
+			this->optionMode.valueSpec = ValueSpec::Enum(_modeNameA, 2);
+			this->optionGain.valueSpec = ValueSpec::Double(0.0, 10.0);
+
+			this->cmdMotor.RegisterParam(&this->paramSpeed);
+			this->cmdMotor.RegisterParam(&this->paramEnable);
+			this->cmdMotor.RegisterOption(&this->optionMode);
+			this->cmdMotor.RegisterOption(&this->optionGain);
+			this->cmdMotor.resultFunctionCallback = &TypedResultCallback;
+			this->rxController.RegisterCmd(&this->cmdMotor);
+
+			this->rxController.printSink.cmdLinePrintCallback =
+				MCallbacks::CallbackGen<TypedRecorder, void, const char*>(&this->recorder, &TypedRecorder::CmdLine);
+
+			_numTypedCalls = 0;
+		}
+	};
+
+	MTEST(TypedValueParseInt64Test)
+	{
+		int64_t value = 1;
+		CHECK_EQUAL(ValueSpec::ParseInt64("0", &value) == ValueSpec::Status::OK, true);
+		CHECK_EQUAL(value, 0);
+		CHECK_EQUAL(ValueSpec::ParseInt64("+12", &value) == ValueSpec::Status::OK, true);
+		CHECK_EQUAL(value, 12);
+		CHECK_EQUAL(ValueSpec::ParseInt64("-345", &value) == ValueSpec::Status::OK, true);
+		CHECK_EQUAL(value, -345);
+		CHECK_EQUAL(ValueSpec::ParseInt64("0x1F", &value) == ValueSpec::Status::OK, true);
+		CHECK_EQUAL(value, 31);
+		CHECK_EQUAL(ValueSpec::ParseInt64("-0x10", &value) == ValueSpec::Status::OK, true);
+		CHECK_EQUAL(value, -16);
+		CHECK_EQUAL(ValueSpec::ParseInt64("9223372036854775807", &value) == ValueSpec::Status::OK, true);
+		CHECK_EQUAL(value == INT64_MAX, true);
+		CHECK_EQUAL(ValueSpec::ParseInt64("-9223372036854775808", &value) == ValueSpec::Status::OK, true);
+		CHECK_EQUAL(value == INT64_MIN, true);
+
+		CHECK_EQUAL(ValueSpec::ParseInt64("9223372036854775808", &value) == ValueSpec::Status::OUT_OF_RANGE, true);
+		CHECK_EQUAL(ValueSpec::ParseInt64("-9223372036854775809", &value) == ValueSpec::Status::OUT_OF_RANGE, true);
+		CHECK_EQUAL(ValueSpec::ParseInt64("99999999999999999999x", &value) == ValueSpec::Status::INVALID, true);
+		CHECK_EQUAL(ValueSpec::ParseInt64("", &value) == ValueSpec::Status::INVALID, true);
+		CHECK_EQUAL(ValueSpec::ParseInt64("-", &value) == ValueSpec::Status::INVALID, true);
+		CHECK_EQUAL(ValueSpec::ParseInt64("0x", &value) == ValueSpec::Status::INVALID, true);
+		CHECK_EQUAL(ValueSpec::ParseInt64("12a", &value) == ValueSpec::Status::INVALID, true);
+		CHECK_EQUAL(ValueSpec::ParseInt64(" 1", &value) == ValueSpec::Status::INVALID, true);
+	}
+
+	MTEST(TypedValueParseDoubleTest)
+	{
+		// Plain decimals skip strtod(), but must give exactly the same value as it
+		const char* strA[] = {
+			"0", "-0", "2.5", "+7", "0.1", "-0.125", "1.", ".5", "123456789012345", "0.000000000000001",
+			"3.14159265358979", "1234567890123456", "0.1234567890123456", "1.5e3", "inf" };
+		for(uint32_t x = 0; x < sizeof(strA)/sizeof(strA[0]); x++)
+		{
+			double value = 1.0;
+			double expected = strtod(strA[x], NULL);
+			CHECK_EQUAL(ValueSpec::ParseDouble(strA[x], &value) == ValueSpec::Status::OK, true);
+			// Compared bit for bit, so "-0" must give -0.0
+			CHECK_EQUAL(memcmp(&value, &expected, sizeof(double)), 0);
+		}
+
+		double value;
+		CHECK_EQUAL(ValueSpec::ParseDouble(".", &value) == ValueSpec::Status::INVALID, true);
+		CHECK_EQUAL(ValueSpec::ParseDouble("-", &value) == ValueSpec::Status::INVALID, true);
+		CHECK_EQUAL(ValueSpec::ParseDouble("1.2.3", &value) == ValueSpec::Status::INVALID, true);
+		CHECK_EQUAL(ValueSpec::ParseDouble("1,5", &value) == ValueSpec::Status::INVALID, true);
+	}
+
+	MTEST(TypedValueConvertTest)
+	{
+		Value value;
+
+		CHECK_EQUAL(ValueSpec::Int32(-10, 10).Convert("-10", &value) == ValueSpec::Status::OK, true);
+		CHECK_EQUAL(value.int32, -10);
+		CHECK_EQUAL(ValueSpec::Int32(-10, 10).Convert("11", &value) == ValueSpec::Status::OUT_OF_RANGE, true);
+		CHECK_EQUAL(ValueSpec::Int32().Convert("2147483648", &value) == ValueSpec::Status::OUT_OF_RANGE, true);
+
+		CHECK_EQUAL(ValueSpec::UInt32().Convert("4294967295", &value) == ValueSpec::Status::OK, true);
+		CHECK_EQUAL(value.uint32, 4294967295u);
+		CHECK_EQUAL(ValueSpec::UInt32().Convert("-1", &value) == ValueSpec::Status::OUT_OF_RANGE, true);
+
+		CHECK_EQUAL(ValueSpec::Int64().Convert("-5000000000", &value) == ValueSpec::Status::OK, true);
+		CHECK_EQUAL(value.int64 == -5000000000LL, true);
+
+		CHECK_EQUAL(ValueSpec::Double().Convert("1.5e3", &value) == ValueSpec::Status::OK, true);
+		CHECK_EQUAL(value.float64 == 1500.0, true);
+		CHECK_EQUAL(ValueSpec::Double().Convert("1.5x", &value) == ValueSpec::Status::INVALID, true);
+		CHECK_EQUAL(ValueSpec::Double().Convert("", &value) == ValueSpec::Status::INVALID, true);
+		CHECK_EQUAL(ValueSpec::Double().Convert("1e999", &value) == ValueSpec::Status::OUT_OF_RANGE, true);
+		CHECK_EQUAL(ValueSpec::Double().Convert("nan", &value) == ValueSpec::Status::OUT_OF_RANGE, true);
+		CHECK_EQUAL(ValueSpec::Double(0.0, 1.0).Convert("-0.1", &value) == ValueSpec::Status::OUT_OF_RANGE, true);
+
+		CHECK_EQUAL(ValueSpec::Bool().Convert("ON", &value) == ValueSpec::Status::OK, true);
+		CHECK_EQUAL(value.boolean, true);
+		CHECK_EQUAL(ValueSpec::Bool().Convert("0", &value) == ValueSpec::Status::OK, true);
+		CHECK_EQUAL(value.boolean, false);
+		CHECK_EQUAL(ValueSpec::Bool().Convert("maybe", &value) == ValueSpec::Status::INVALID, true);
+
+		CHECK_EQUAL(ValueSpec::Enum(_modeNameA, 2).Convert("slow", &value) == ValueSpec::Status::OK, true);
+		CHECK_EQUAL(value.enumIndex, 1);
+		CHECK_EQUAL(ValueSpec::Enum(_modeNameA, 2).Convert("Slow", &value) == ValueSpec::Status::INVALID, true);
+
+		char rangeBuff[20];
+		ValueSpec::Enum(_modeNameA, 2).GetRangeString(rangeBuff, sizeof(rangeBuff));
+		CHECK_EQUAL(std::string(rangeBuff) == "fast, slow", true);
+		ValueSpec::Int32(0, 5000).GetRangeString(rangeBuff, sizeof(rangeBuff));
+		CHECK_EQUAL(std::string(rangeBuff) == "0 to 5000", true);
+		ValueSpec::Enum(_modeNameA, 2).GetRangeString(rangeBuff, 8);
+		CHECK_EQUAL(std::string(rangeBuff) == "fast, s", true);
+	}
+
+	MTEST(TypedValueRxTest)
+	{
+		TypedParser parser;
+
+		CHECK_EQUAL(parser.rxController.Run("motor 1200 on --mode slow -g 2.5"), true);
+		CHECK_EQUAL(_numTypedCalls, 1);
+		CHECK_EQUAL(_typedSpeed, 1200);
+		CHECK_EQUAL(_typedEnable, true);
+		CHECK_EQUAL(_typedModeReceived, true);
+		CHECK_EQUAL(_typedMode, 1);
+		CHECK_EQUAL(_typedGain == 2.5, true);
+
+		// Also written to the parameters and options, like their string values
+		CHECK_EQUAL(parser.paramSpeed.typedValue.int32, 1200);
+		CHECK_EQUAL(parser.optionMode.typedValue.enumIndex, 1);
+
+		// Options not received have no value
+		CHECK_EQUAL(parser.rxController.Run("motor 0 false"), true);
+		CHECK_EQUAL(_numTypedCalls, 2);
+		CHECK_EQUAL(_typedModeReceived, false);
+		CHECK_EQUAL(parser.recorder.output.empty(), true);
+	}
+
+	MTEST(TypedValueRejectTest)
+	{
+		TypedParser parser;
+
+		CHECK_EQUAL(parser.rxController.Run("motor 6000 on"), false);
+		CHECK_EQUAL(parser.recorder.output == "error \"Param 1 value '6000' is out of range (0 to 5000).\"\r\n", true);
+
+		parser.recorder.output.clear();
+		CHECK_EQUAL(parser.rxController.Run("motor 100 maybe"), false);
+		CHECK_EQUAL(parser.recorder.output == "error \"Param 2 value 'maybe' is not a valid bool (true, false).\"\r\n", true);
+
+		parser.recorder.output.clear();
+		CHECK_EQUAL(parser.rxController.Run("motor 100 on --mode medium"), false);
+		CHECK_EQUAL(parser.recorder.output == "error \"Option '--mode' value 'medium' is not a valid enum (fast, slow).\"\r\n", true);
+
+		parser.recorder.output.clear();
+		CHECK_EQUAL(parser.rxController.Run("motor 100 on -g 11"), false);
+		CHECK_EQUAL(parser.recorder.output == "error \"Option '-g' value '11' is out of range (0 to 10).\"\r\n", true);
+
+		// None of them got as far as the callback
+		CHECK_EQUAL(_numTypedCalls, 0);
+	}
+
+	MTEST(TypedValueSinglePassFrozenTest)
+	{
+		TypedParser parser;
+		parser.rxController.optionParserMode = Rx::OptionParserMode::SINGLE_PASS;
+		parser.rxController.Freeze();
+
+		CHECK_EQUAL(parser.rxController.Run("motor --mode=fast 4999 yes"), true);
+		CHECK_EQUAL(_numTypedCalls, 1);
+		CHECK_EQUAL(_typedSpeed, 4999);
+		CHECK_EQUAL(_typedEnable, true);
+		CHECK_EQUAL(_typedMode, 0);
+
+		// Only in the ParseResult once frozen
+		CHECK_EQUAL(parser.paramSpeed.typedValue.int32 == 4999, false);
+
+		CHECK_EQUAL(parser.rxController.Run("motor --mode=medium 1 yes"), false);
+		CHECK_EQUAL(_numTypedCalls, 1);
+	}
+
+} // namespace MClideTest
@@ -2,7 +2,7 @@
 //! @file 			WorksInAClassTests.cpp
 //! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.mbedded.ninja)
 //! @created		2014-04-02
-//! @last-modified 	2014-10-07
+//! @last-modified 	2026-10-16
 //! @brief 			Contains tests to make sure MClide works when used as part of a class.
 //! @details
 //!					See README.rst in root dir for more info.
@@ -73,7 +73,7 @@ namespace MClideTest
 		myTestClass.Run();
 
 		CHECK_EQUAL(myTestClass.cmdTestParam.value, "param1");
-		CHECK_EQUAL(myTestClass.cmdTestOption.isDetected, true);
+		CHECK_EQUAL(myTestClass.cmdTestOption.IsDetected(), true);
 		CHECK_EQUAL(myTestClass.callbackCalled, true);
 	}
 		